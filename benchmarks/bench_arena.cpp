@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <BURST/configuration_space.hpp>
+#include <BURST/memory.hpp>
+#include <BURST/geometry.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <vector>
+
+/*
+ * This file is built twice: as bench_arena with BURST_ENABLE_ARENA and as bench_arena_heap without it
+ * Comparing the two reports shows how many global heap allocations the arena removes per query and what that saves in time
+ * Allocations made directly through malloc (GMP and MPFR limbs) bypass operator new and are not counted
+ */
+
+// -- HEAP ALLOCATION COUNTING -------------------------------------------------
+
+namespace {
+    std::atomic<size_t> heap_allocations{0};
+
+    void* counted_allocate(std::size_t size, std::size_t alignment) {
+        heap_allocations.fetch_add(1, std::memory_order_relaxed);
+        void* pointer = nullptr;
+        if (alignment <= alignof(std::max_align_t)) pointer = std::malloc(size == 0 ? 1 : size);
+        else pointer = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+        if (pointer == nullptr) throw std::bad_alloc{};
+        return pointer;
+    }
+}
+
+void* operator new(std::size_t size) { return counted_allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return counted_allocate(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return counted_allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return counted_allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+// Report heap and arena allocation counts per query alongside the timings
+static void report_allocations(benchmark::State& state, size_t heap_before, const BURST::memory::ArenaStats& arena) {
+    double queries = static_cast<double>(state.iterations());
+    state.counters["heap_allocs_per_query"] = static_cast<double>(heap_allocations.load(std::memory_order_relaxed) - heap_before) / queries;
+    state.counters["arena_allocs_per_query"] = static_cast<double>(arena.allocations) / queries;
+    state.counters["arena_peak_bytes"] = static_cast<double>(arena.peak_bytes);
+    state.counters["arena_reserved_bytes"] = static_cast<double>(arena.bytes_reserved);
+}
+
+// -- ARENA BENCHMARKS ---------------------------------------------------------
+
+// Cast rays along curve-typed paths from boundary vertices, counting the allocations made by each temporary arrangement
+// Straight segment paths walk the compact boundary instead and build no arrangement, so they are not measured here
+static void BM_RayCastAllocations(benchmark::State& state) {
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), bench::radius_argument(state.range(1)));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    std::vector<BURST::geometry::Point2D> intersections;
+    intersections.reserve(64);
+    size_t query = 0;
+    BURST::memory::reset_stats();
+    size_t heap_before = heap_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        const BURST::geometry::Point2D& origin = environment->starts[query % environment->starts.size()];
+        double angle = CGAL::to_double(bench::inward_angle(origin, query));
+        BURST::geometry::Ray2D ray{origin, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)}};
+
+        intersections.clear();
+        size_t count = environment->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::MonotoneCurve2D>(ray, std::back_inserter(intersections));
+        benchmark::DoNotOptimize(count);
+        query++;
+    }
+    report_allocations(state, heap_before, BURST::memory::stats());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RayCastAllocations)
+    ->ArgNames({"vertices", "radius_x100"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <cmath>
+#include <vector>
+
+// -- CONFIGURATION SPACE CONSTRUCTION BENCHMARKS ------------------------------
+
+// Build the configuration space of a pillared room for a robot of the given radius
+static void BM_ConfigurationSpaceBuild(benchmark::State& state) {
+    auto wall_space = bench::regular_room(static_cast<int>(state.range(0)), 50.0, static_cast<int>(state.range(2)));
+    auto robot = BURST::Robot<>::create(bench::radius_argument(state.range(1)), BURST::geometry::Point2D{0, 0}, 0);
+    if (!wall_space || !robot) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        bool generated = wall_space->generateConfigurationSpace(*robot);
+        benchmark::DoNotOptimize(generated);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigurationSpaceBuild)
+    ->ArgNames({"vertices", "radius_x100", "pillars"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}, {0, 4, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+// Build the configuration space of seeded star rooms to measure scaling in boundary and hole count
+static void BM_ConfigurationSpaceBuildStar(benchmark::State& state) {
+    auto wall_space = bench::star_room(state.range(0), state.range(1));
+    auto robot = BURST::Robot<>::create(BURST::numeric::fscalar{0.5}, BURST::geometry::Point2D{0, 0}, 0);
+    if (!wall_space || !robot) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        bool generated = wall_space->generateConfigurationSpace(*robot);
+        benchmark::DoNotOptimize(generated);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigurationSpaceBuildStar)
+    ->ArgNames({"vertices", "holes"})
+    ->ArgsProduct({{64, 256, 1024}, {0, 16, 64}})
+    ->Unit(benchmark::kMillisecond);
+
+// Build the configuration space of seeded cluttered warehouses
+static void BM_ConfigurationSpaceBuildWarehouse(benchmark::State& state) {
+    auto wall_space = bench::warehouse(state.range(0), state.range(1));
+    auto robot = BURST::Robot<>::create(BURST::numeric::fscalar{0.5}, BURST::geometry::Point2D{0, 0}, 0);
+    if (!wall_space || !robot) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        bool generated = wall_space->generateConfigurationSpace(*robot);
+        benchmark::DoNotOptimize(generated);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigurationSpaceBuildWarehouse)
+    ->ArgNames({"shelves", "clutter"})
+    ->ArgsProduct({{4, 16}, {0, 32}})
+    ->Unit(benchmark::kMillisecond);
+
+// Build the configuration space of seeded star rooms for a translating regular-polygon robot, to compare with BM_ConfigurationSpaceBuildStar
+static void BM_ConfigurationSpaceBuildPolygonal(benchmark::State& state) {
+    auto wall_space = bench::star_room(state.range(0), state.range(1));
+    auto robot = BURST::Robot<>::create(BURST::numeric::fscalar{0.5}, BURST::geometry::Point2D{0, 0}, 0);
+    // Regular footprint circumscribed by the disc robot's outline
+    std::vector<BURST::geometry::Point2D> vertices;
+    for (int64_t i = 0; i < state.range(2); ++i) {
+        double angle = 2.0 * CGAL_PI * static_cast<double>(i) / static_cast<double>(state.range(2));
+        vertices.emplace_back(0.5 * std::cos(angle), 0.5 * std::sin(angle));
+    }
+    auto footprint = BURST::geometry::construct_polygon(vertices);
+    if (!wall_space || !robot || !footprint) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        bool generated = wall_space->generateConfigurationSpace(*robot, *footprint);
+        benchmark::DoNotOptimize(generated);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigurationSpaceBuildPolygonal)
+    ->ArgNames({"vertices", "holes", "sides"})
+    ->ArgsProduct({{64, 256, 1024}, {0, 16, 64}, {4, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+// Place an already built configuration space of a pillared room at a new position and orientation
+static void BM_ConfigurationSpaceTransform(benchmark::State& state) {
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), bench::radius_argument(25), 50.0, static_cast<int>(state.range(1)));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    // Rotation with rational sine and cosine (3-4-5 triangle) followed by a translation
+    BURST::geometry::Transformation placement{BURST::numeric::fscalar{4} / 5, BURST::numeric::fscalar{-3} / 5, 100, BURST::numeric::fscalar{3} / 5, BURST::numeric::fscalar{4} / 5, -40};
+
+    for (auto _ : state) {
+        auto moved = environment->configuration_space->transformed(placement);
+        benchmark::DoNotOptimize(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConfigurationSpaceTransform)
+    ->ArgNames({"vertices", "pillars"})
+    ->ArgsProduct({{8, 32, 128}, {0, 4, 16}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+#include <BURST/robot.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/coverage.hpp>
+#include <BURST/pipeline.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <optional>
+#include <span>
+#include <vector>
+
+// -- COVERAGE BENCHMARKS ------------------------------------------------------
+
+// Compute the stadium swept by a single move from a fixed boundary start
+static void BM_CoveredArea(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(state.range(1));
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    auto robot = BURST::Robot<>::create(radius, environment->starts.front(), 0);
+    robot->setConfigurationEnvironment(environment->configuration_space);
+
+    size_t query = 0;
+    for (auto _ : state) {
+        auto stadium = robot->coveredArea(bench::inward_angle(robot->getPosition(), query));
+        benchmark::DoNotOptimize(stadium);
+        query++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CoveredArea)
+    ->ArgNames({"vertices", "radius_x100"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Accumulate the union of the stadiums swept by consecutive moves, as coverage accounting does
+static void BM_CoverageAccumulation(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(state.range(1));
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto robot = BURST::Robot<>::create(radius, environment->starts.front(), 0.05, 42);
+        robot->setConfigurationEnvironment(environment->configuration_space);
+
+        BURST::geometry::CurvilinearPolygonSet2D covered;
+        for (int64_t step = 0; step < state.range(2); ++step) {
+            BURST::numeric::fscalar angle = bench::inward_angle(robot->getPosition(), static_cast<size_t>(step));
+            std::optional<BURST::geometry::CurvilinearPolygonSet2D> stadium = robot->coveredArea(angle);
+            if (stadium) covered.join(*stadium);
+            robot->move(angle);
+        }
+        benchmark::DoNotOptimize(covered);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(2));
+}
+BENCHMARK(BM_CoverageAccumulation)
+    ->ArgNames({"vertices", "radius_x100", "steps"})
+    ->ArgsProduct({{8, 32}, {25, 100}, {16}})
+    ->Unit(benchmark::kMillisecond);
+
+// Shrink the uncovered set move by move and query the largest gap after every step, as adaptive strategies do
+static void BM_UncoveredRegions(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(state.range(1));
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    for (auto _ : state) {
+        auto robot = BURST::Robot<>::create(radius, environment->starts.front(), 0.05, 42);
+        robot->setConfigurationEnvironment(environment->configuration_space);
+        auto coverage = BURST::geometry::AreaCoverage::create(environment->configuration_space);
+
+        for (int64_t step = 0; step < state.range(2); ++step) {
+            BURST::numeric::fscalar angle = bench::inward_angle(robot->getPosition(), static_cast<size_t>(step));
+            std::optional<BURST::geometry::CurvilinearPolygonSet2D> stadium = robot->coveredArea(angle);
+            if (stadium) coverage->add(*stadium);
+            robot->move(angle);
+            benchmark::DoNotOptimize(coverage->largest());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(2));
+}
+BENCHMARK(BM_UncoveredRegions)
+    ->ArgNames({"vertices", "radius_x100", "steps"})
+    ->ArgsProduct({{8, 32}, {25, 100}, {16}})
+    ->Unit(benchmark::kMillisecond);
+
+// Run robots through a pipeline with coverage, trajectory, and statistics stages; producers = 0 runs the stages inline after each move
+static void BM_PipelineRun(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(25);
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    std::size_t robot_count = static_cast<std::size_t>(state.range(1));
+    std::size_t steps = static_cast<std::size_t>(state.range(3));
+    auto policy = [step = std::size_t{0}](const BURST::Robot<>& robot) mutable {
+        return bench::inward_angle(robot.getPosition(), step++);
+    };
+
+    for (auto _ : state) {
+        std::vector<BURST::Robot<>> robots;
+        for (std::size_t i = 0; i < robot_count; ++i) {
+            auto robot = BURST::Robot<>::create(radius, environment->starts[i % environment->starts.size()], 0.05, 42 + i);
+            robot->setConfigurationEnvironment(environment->configuration_space);
+            robots.push_back(*robot);
+        }
+        auto coverage = BURST::geometry::AreaCoverage::create(environment->configuration_space);
+        std::vector<std::vector<BURST::geometry::Point2D>> trajectories;
+        BURST::MoveStatistics statistics;
+        auto area = BURST::Pipeline<>::coverage(*coverage);
+        auto recorder = BURST::Pipeline<>::recorder(trajectories);
+        auto totals = BURST::Pipeline<>::statistics(statistics);
+
+        if (state.range(2) == 0) {
+            auto serial_policy = policy;
+            for (std::size_t step = 0; step < steps; ++step) {
+                for (std::size_t i = 0; i < robots.size(); ++i) {
+                    BURST::MoveRecord record{i, step, robots[i].getPosition(), radius, {}};
+                    record.result = robots[i].step(serial_policy(robots[i]), true);
+                    area(record);
+                    recorder(record);
+                    totals(record);
+                }
+            }
+        } else {
+            BURST::Pipeline<> pipeline;
+            pipeline.addStage(area).addStage(recorder).addStage(totals);
+            pipeline.run(std::span{robots}, policy, steps, static_cast<std::size_t>(state.range(2)), true);
+        }
+        benchmark::DoNotOptimize(coverage->coveredFraction());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1) * state.range(3));
+}
+BENCHMARK(BM_PipelineRun)
+    ->ArgNames({"vertices", "robots", "producers", "steps"})
+    ->ArgsProduct({{32}, {1, 4}, {0, 1, 2}, {16}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+#ifndef BENCH_HELPERS_HPP
+#define BENCH_HELPERS_HPP
+
+#include <benchmark/benchmark.h>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/numeric.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/environments.hpp>
+
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// -- HELPER FIXTURES ----------------------------------------------------------
+
+namespace bench {
+
+    constexpr double PI = 3.14159265358979323846;
+
+    // Fixed offsets cycled through when aiming rays, so every benchmark run performs the same queries
+    constexpr double ANGLE_JITTER[] = {0.0, 0.31, -0.27, 0.52, -0.49, 0.11, -0.08, 0.67};
+    constexpr size_t ANGLE_JITTER_COUNT = sizeof(ANGLE_JITTER) / sizeof(ANGLE_JITTER[0]);
+
+    // Convert a benchmark argument in hundredths to an exact robot radius
+    inline BURST::numeric::fscalar radius_argument(int64_t hundredths) {
+        return BURST::numeric::fscalar{static_cast<double>(hundredths) / 100.0};
+    }
+
+    // Axis-aligned square pillar of half-width `half` centred at (cx, cy)
+    inline BURST::geometry::Polygon2D square_pillar(double cx, double cy, double half) {
+        return *BURST::geometry::construct_polygon({
+            BURST::geometry::Point2D{cx - half, cy - half},
+            BURST::geometry::Point2D{cx + half, cy - half},
+            BURST::geometry::Point2D{cx + half, cy + half},
+            BURST::geometry::Point2D{cx - half, cy + half}
+        });
+    }
+
+    // Regular `vertices`-gon room of circumradius `size` with `pillars` square pillars on a ring around its centre
+    // Pillars make the configuration space curvilinear, which is the common case for the hot paths
+    inline std::optional<BURST::geometry::WallSpace> regular_room(int vertices, double size, int pillars) {
+        std::vector<BURST::geometry::Point2D> outer;
+        outer.reserve(vertices);
+        for (int i = 0; i < vertices; ++i) {
+            double angle = 2 * PI * i / vertices;
+            outer.emplace_back(size * std::cos(angle), size * std::sin(angle));
+        }
+
+        std::vector<BURST::geometry::Polygon2D> holes;
+        holes.reserve(pillars);
+        for (int i = 0; i < pillars; ++i) {
+            double angle = 2 * PI * (i + 0.5) / pillars;
+            holes.push_back(square_pillar(0.45 * size * std::cos(angle), 0.45 * size * std::sin(angle), 0.05 * size));
+        }
+        return BURST::geometry::WallSpace::create(outer, holes);
+    }
+
+    // Configuration-space vertices are exact boundary points, which makes them valid robot start positions
+    inline std::vector<BURST::geometry::Point2D> boundary_points(const BURST::geometry::ConfigurationSpace& configuration_space) {
+        std::vector<BURST::geometry::Point2D> points;
+        for (auto vertex_it = configuration_space.arrangement().vertices_begin(); vertex_it != configuration_space.arrangement().vertices_end(); ++vertex_it) {
+            auto point = vertex_it->point();
+            points.push_back(BURST::geometry::convert_point<BURST::geometry::Point2D, decltype(point)>(point, BURST::numeric::sqrt_to_fscalar<decltype(point.x())>));
+        }
+        return points;
+    }
+
+    // Heading from `from` towards the room centre, offset by the `index`-th jitter value
+    inline BURST::numeric::fscalar inward_angle(const BURST::geometry::Point2D& from, size_t index) {
+        double angle = std::atan2(-CGAL::to_double(from.y()), -CGAL::to_double(from.x()));
+        return BURST::numeric::fscalar{angle + ANGLE_JITTER[index % ANGLE_JITTER_COUNT]};
+    }
+
+    // Room, its configuration space for a given radius, and the exact boundary points usable as starts
+    struct Environment {
+        std::shared_ptr<BURST::geometry::ConfigurationSpace> configuration_space;
+        std::vector<BURST::geometry::Point2D> starts;
+    };
+
+    inline std::optional<Environment> make_environment(const std::optional<BURST::geometry::WallSpace>& wall_space, const BURST::numeric::fscalar& robot_radius) {
+        if (!wall_space) return std::nullopt;
+
+        // Generate the configuration space through a throwaway robot since construction is not public
+        auto robot = BURST::Robot<>::create(robot_radius, BURST::geometry::Point2D{0, 0}, 0);
+        if (!robot || !wall_space->generateConfigurationSpace(*robot)) return std::nullopt;
+
+        Environment environment{robot->getConfigurationEnvironmentPtr(), {}};
+        environment.starts = boundary_points(*environment.configuration_space);
+        if (environment.starts.empty()) return std::nullopt;
+        return environment;
+    }
+
+    inline std::optional<Environment> make_environment(int vertices, const BURST::numeric::fscalar& robot_radius, double size = 50.0, int pillars = 4) {
+        return make_environment(regular_room(vertices, size, pillars), robot_radius);
+    }
+
+    // Seeded star room centred on the origin, so inward_angle still aims across the room
+    inline std::optional<BURST::geometry::WallSpace> star_room(int64_t vertices, int64_t holes) {
+        BURST::environments::StarParameters parameters;
+        parameters.vertex_count = static_cast<size_t>(vertices);
+        parameters.hole_count = static_cast<size_t>(holes);
+        parameters.radius = 50.0;
+        return BURST::environments::star_room(parameters, 2024);
+    }
+
+    // Seeded warehouse with `shelves` shelves per row and `clutter` scattered obstacles
+    inline std::optional<BURST::geometry::WallSpace> warehouse(int64_t shelves, int64_t clutter) {
+        BURST::environments::WarehouseParameters parameters;
+        parameters.shelves_per_row = static_cast<size_t>(shelves);
+        parameters.clutter_count = static_cast<size_t>(clutter);
+        parameters.width = 12.0 * static_cast<double>(shelves) + 10.0;
+        return BURST::environments::warehouse(parameters, 2024);
+    }
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include <BURST/configuration_space.hpp>
+#include <BURST/grid.hpp>
+#include <BURST/geometry.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <cmath>
+#include <optional>
+#include <random>
+
+/*
+ * Compares the boundary indices of a ConfigurationSpace on first-hit ray queries
+ * The index argument selects the bounding volume hierarchy (0) or the uniform grid (1)
+ * Headings follow a golden-angle sequence so every direction is sampled, including rays leaving through nearby walls
+ */
+
+// -- HELPERS ------------------------------------------------------------------
+
+namespace {
+    constexpr double GOLDEN_ANGLE = 2.399963229728653;
+
+    BURST::geometry::BoundaryIndex index_argument(int64_t index) {
+        return index == 0 ? BURST::geometry::BoundaryIndex::Hierarchy : BURST::geometry::BoundaryIndex::Grid;
+    }
+
+    void run_first_hits(benchmark::State& state, std::optional<bench::Environment> environment, int64_t index) {
+        if (!environment) {
+            state.SkipWithError("Failed to construct benchmark environment");
+            return;
+        }
+        environment->configuration_space->useBoundaryIndex(index_argument(index));
+
+        size_t query = 0;
+        size_t hits = 0;
+        for (auto _ : state) {
+            const BURST::geometry::Point2D& origin = environment->starts[query % environment->starts.size()];
+            double angle = GOLDEN_ANGLE * static_cast<double>(query);
+            BURST::geometry::Ray2D ray{origin, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)}};
+            auto hit = environment->configuration_space->firstIntersection(ray);
+            hits += hit.has_value() ? 1 : 0;
+            benchmark::DoNotOptimize(hit);
+            query++;
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["hit_fraction"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+        state.counters["boundary_curves"] = static_cast<double>(environment->configuration_space->boundary().size());
+    }
+}
+
+// -- FIRST HIT BENCHMARKS -----------------------------------------------------
+
+// First hits in a regular room with pillars
+static void BM_FirstHitRoom(benchmark::State& state) {
+    run_first_hits(state, bench::make_environment(static_cast<int>(state.range(0)), bench::radius_argument(25)), state.range(1));
+}
+BENCHMARK(BM_FirstHitRoom)
+    ->ArgNames({"vertices", "index"})
+    ->ArgsProduct({{32, 128}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// First hits in a dense warehouse, the layout the grid targets
+static void BM_FirstHitWarehouse(benchmark::State& state) {
+    run_first_hits(state, bench::make_environment(bench::warehouse(state.range(0), state.range(1)), bench::radius_argument(25)), state.range(2));
+}
+BENCHMARK(BM_FirstHitWarehouse)
+    ->ArgNames({"shelves", "clutter", "index"})
+    ->ArgsProduct({{5, 10}, {0, 20}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// -- CONSTRUCTION BENCHMARKS --------------------------------------------------
+
+// Bucket the boundary curves of a warehouse into a grid at several densities
+static void BM_GridBuild(benchmark::State& state) {
+    auto environment = bench::make_environment(bench::warehouse(10, 20), bench::radius_argument(25));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    double cells_per_curve = static_cast<double>(state.range(0)) / 4.0;
+    for (auto _ : state) {
+        BURST::geometry::BoundaryGrid grid{environment->configuration_space->boundary(), cells_per_curve};
+        benchmark::DoNotOptimize(grid);
+    }
+    BURST::geometry::BoundaryGrid grid{environment->configuration_space->boundary(), cells_per_curve};
+    state.counters["cells"] = static_cast<double>(grid.columns() * grid.rows());
+    state.counters["entries_per_curve"] = static_cast<double>(grid.entries()) / static_cast<double>(environment->configuration_space->boundary().size());
+}
+BENCHMARK(BM_GridBuild)
+    ->ArgName("cells_per_curve_x4")
+    ->Arg(1)->Arg(4)->Arg(16)
+    ->Unit(benchmark::kMicrosecond);
+
+// -- BOUNDARY SAMPLING BENCHMARKS ---------------------------------------------
+
+// Draw uniform start positions on the boundary of a warehouse, the setup cost of every Monte-Carlo run
+static void BM_SampleBoundary(benchmark::State& state) {
+    auto environment = bench::make_environment(bench::warehouse(10, 20), bench::radius_argument(25));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    std::mt19937_64 engine{7};
+    size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        auto samples = environment->configuration_space->sampleBoundary(count, engine);
+        benchmark::DoNotOptimize(samples);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["boundary_curves"] = static_cast<double>(environment->configuration_space->boundary().size());
+}
+BENCHMARK(BM_SampleBoundary)
+    ->ArgName("samples")
+    ->Arg(1)->Arg(1024)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
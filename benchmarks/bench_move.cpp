@@ -0,0 +1,192 @@
+#include <benchmark/benchmark.h>
+#include <BURST/robot.hpp>
+#include <BURST/world.hpp>
+#include <BURST/swarm.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+// -- ROBOT MOVE BENCHMARKS ----------------------------------------------------
+
+// Repeatedly move a robot across the room, aiming roughly at the centre from wherever it stopped
+static void BM_RobotMove(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(state.range(1));
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    auto robot = BURST::Robot<>::create(radius, environment->starts.front(), 0.05, 42);
+    robot->setConfigurationEnvironment(environment->configuration_space);
+
+    size_t step = 0;
+    size_t successful_moves = 0;
+    for (auto _ : state) {
+        bool moved = robot->move(bench::inward_angle(robot->getPosition(), step), state.range(2) != 0);
+        if (moved) successful_moves++;
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["success_rate"] = benchmark::Counter(static_cast<double>(successful_moves) / static_cast<double>(std::max<size_t>(step, 1)));
+}
+BENCHMARK(BM_RobotMove)
+    ->ArgNames({"vertices", "radius_x100", "perturbed"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Same walk along constant-curvature arcs, with zero curvature as the straight-line reference
+static void BM_RobotArcMove(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(25);
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    BURST::numeric::fscalar curvature{static_cast<double>(state.range(1)) / 100.0};
+    auto robot = BURST::Robot<BURST::geometry::ArcTrajectory>::create(radius, environment->starts.front(), BURST::models::RotationModel<>{0.05, 42}, BURST::models::ArcMovementModel{curvature});
+    robot->setConfigurationEnvironment(environment->configuration_space);
+
+    size_t step = 0;
+    size_t successful_moves = 0;
+    for (auto _ : state) {
+        bool moved = robot->move(bench::inward_angle(robot->getPosition(), step));
+        if (moved) successful_moves++;
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["success_rate"] = benchmark::Counter(static_cast<double>(successful_moves) / static_cast<double>(std::max<size_t>(step, 1)));
+}
+BENCHMARK(BM_RobotArcMove)
+    ->ArgNames({"vertices", "curvature_x100"})
+    ->ArgsProduct({{32, 128}, {0, 5, 20}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Step a swarm of robots spread uniformly along the boundary, each aiming roughly at the centre
+static void BM_WorldStep(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(5);
+    auto environment = bench::make_environment(32, radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    std::mt19937_64 engine{2024};
+    std::vector<BURST::geometry::Point2D> starts = environment->configuration_space->sampleBoundary(static_cast<size_t>(state.range(0)), engine);
+    std::vector<BURST::Robot<>> robots;
+    robots.reserve(starts.size());
+    for (size_t i = 0; i < starts.size(); ++i) {
+        auto robot = BURST::Robot<>::create(radius, starts[i], 0.05, static_cast<unsigned int>(i));
+        robot->setConfigurationEnvironment(environment->configuration_space);
+        robots.push_back(*robot);
+    }
+    auto world = BURST::World<>::create(std::move(robots), static_cast<size_t>(state.range(1)));
+    if (!world) {
+        state.SkipWithError("Failed to construct benchmark world");
+        return;
+    }
+
+    size_t step = 0;
+    size_t contacts = 0;
+    std::vector<BURST::numeric::fscalar> angles(world->size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < world->size(); ++i) angles[i] = bench::inward_angle(world->robot(i).getPosition(), step + i);
+        auto outcomes = world->step(angles, true);
+        if (outcomes) contacts += static_cast<size_t>(std::count(outcomes->begin(), outcomes->end(), BURST::MoveOutcome::Contact));
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(world->size()));
+    state.counters["contact_rate"] = benchmark::Counter(static_cast<double>(contacts) / static_cast<double>(std::max<size_t>(step * world->size(), 1)));
+}
+BENCHMARK(BM_WorldStep)
+    ->ArgNames({"robots", "threads"})
+    ->ArgsProduct({{256, 2048}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Step the same swarm with every worker reading one shared configuration space, or with per-NUMA-node replicas and pinned workers
+// On single-node machines the replicated variant falls back to the shared space and reports nodes = 1
+static void BM_WorldStepNuma(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(5);
+    auto environment = bench::make_environment(128, radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    std::mt19937_64 engine{2024};
+    std::vector<BURST::geometry::Point2D> starts = environment->configuration_space->sampleBoundary(static_cast<size_t>(state.range(0)), engine);
+    std::vector<BURST::Robot<>> robots;
+    robots.reserve(starts.size());
+    for (size_t i = 0; i < starts.size(); ++i) {
+        auto robot = BURST::Robot<>::create(radius, starts[i], 0.05, static_cast<unsigned int>(i));
+        robot->setConfigurationEnvironment(environment->configuration_space);
+        robots.push_back(*robot);
+    }
+    size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto world = BURST::World<>::create(std::move(robots), threads);
+    if (!world) {
+        state.SkipWithError("Failed to construct benchmark world");
+        return;
+    }
+    size_t replicas = state.range(1) != 0 ? world->distributeAcrossNodes() : 0;
+
+    size_t step = 0;
+    std::vector<BURST::numeric::fscalar> angles(world->size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < world->size(); ++i) angles[i] = bench::inward_angle(world->robot(i).getPosition(), step + i);
+        benchmark::DoNotOptimize(world->step(angles, true));
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(world->size()));
+    state.counters["threads"] = static_cast<double>(threads);
+    state.counters["nodes"] = static_cast<double>(std::max<size_t>(replicas, 1));
+}
+BENCHMARK(BM_WorldStepNuma)
+    ->ArgNames({"robots", "replicas"})
+    ->ArgsProduct({{4096, 16384}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// -- SWARM BENCHMARKS ---------------------------------------------------------
+
+// Step independent robots held as compact states over one shared model, each aiming roughly at the centre
+static void BM_SwarmStep(benchmark::State& state) {
+    BURST::numeric::fscalar radius = bench::radius_argument(5);
+    auto environment = bench::make_environment(32, radius);
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    auto model = BURST::RobotModel<>::create(radius, 0.05, environment->configuration_space);
+    std::mt19937_64 engine{2024};
+    std::vector<BURST::geometry::Point2D> starts = environment->configuration_space->sampleBoundary(static_cast<size_t>(state.range(0)), engine);
+    auto swarm = BURST::Swarm<>::create(std::make_shared<const BURST::RobotModel<>>(std::move(*model)), starts, 42, static_cast<size_t>(state.range(1)));
+    if (!swarm) {
+        state.SkipWithError("Failed to construct benchmark swarm");
+        return;
+    }
+
+    size_t step = 0;
+    size_t moves = 0;
+    std::vector<BURST::numeric::fscalar> angles(swarm->size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < swarm->size(); ++i) angles[i] = bench::inward_angle(swarm->state(i).position, step + i);
+        auto results = swarm->step(angles, true);
+        if (results) moves += static_cast<size_t>(std::count_if(results->begin(), results->end(), [](const BURST::StepResult& result) { return result.status == BURST::StepStatus::Moved; }));
+        step++;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(swarm->size()));
+    state.counters["success_rate"] = benchmark::Counter(static_cast<double>(moves) / static_cast<double>(std::max<size_t>(step * swarm->size(), 1)));
+    state.counters["bytes_per_robot"] = static_cast<double>(swarm->memoryUsage().total()) / static_cast<double>(swarm->size());
+}
+BENCHMARK(BM_SwarmStep)
+    ->ArgNames({"robots", "threads"})
+    ->ArgsProduct({{256, 2048}, {1, 4}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <BURST/numeric.hpp>
+#include <BURST/geometry.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/mpfr.hpp>
+
+// -- NUMERIC CONVERSION BENCHMARKS --------------------------------------------
+
+// Convert an exact field value to the MPFR-backed high-precision scalar
+static void BM_ToHighPrecision(benchmark::State& state) {
+    BURST::numeric::fscalar value = BURST::numeric::fscalar{1} / 3;
+    for (auto _ : state) {
+        BURST::numeric::hpscalar converted = BURST::numeric::to_high_precision(value);
+        benchmark::DoNotOptimize(converted);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToHighPrecision);
+
+// Convert a high-precision scalar back into the exact field
+static void BM_ToFieldScalar(benchmark::State& state) {
+    BURST::numeric::hpscalar value = boost::multiprecision::cos(BURST::numeric::hpscalar{1});
+    for (auto _ : state) {
+        BURST::numeric::fscalar converted = BURST::numeric::to_fscalar(value);
+        benchmark::DoNotOptimize(converted);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToFieldScalar);
+
+// Build the unit direction vector for a heading the way MovementModel does
+static void BM_DirectionVector(benchmark::State& state) {
+    BURST::numeric::fscalar angle = BURST::numeric::fscalar{0.7};
+    for (auto _ : state) {
+        BURST::numeric::hpscalar hp_angle = BURST::numeric::to_high_precision(angle);
+        BURST::geometry::Vector2D direction{boost::multiprecision::cos(hp_angle), boost::multiprecision::sin(hp_angle)};
+        benchmark::DoNotOptimize(direction);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DirectionVector);
+
+// Evaluate the square-root extension coordinates of configuration-space vertices into the exact field
+static void BM_SqrtToFieldScalar(benchmark::State& state) {
+    auto environment = bench::make_environment(8, BURST::numeric::fscalar{1});
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    std::vector<std::remove_cvref_t<decltype(environment->configuration_space->arrangement().vertices_begin()->point().x())>> coordinates;
+    for (auto vertex_it = environment->configuration_space->arrangement().vertices_begin(); vertex_it != environment->configuration_space->arrangement().vertices_end(); ++vertex_it) {
+        coordinates.push_back(vertex_it->point().x());
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        BURST::numeric::fscalar converted = BURST::numeric::sqrt_to_fscalar(coordinates[index % coordinates.size()]);
+        benchmark::DoNotOptimize(converted);
+        index++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SqrtToFieldScalar);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <BURST/configuration_space.hpp>
+#include <BURST/geometry.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <iterator>
+#include <vector>
+
+// -- RAY CAST BENCHMARKS ------------------------------------------------------
+
+// Cast rays from boundary vertices towards the interior, collecting every boundary hit
+static void BM_RayCast(benchmark::State& state) {
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), bench::radius_argument(state.range(1)));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    std::vector<BURST::geometry::Point2D> intersections;
+    size_t query = 0;
+    for (auto _ : state) {
+        const BURST::geometry::Point2D& origin = environment->starts[query % environment->starts.size()];
+        double angle = CGAL::to_double(bench::inward_angle(origin, query));
+        BURST::geometry::Ray2D ray{origin, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)}};
+
+        intersections.clear();
+        size_t count = environment->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::Segment2D>(ray, std::back_inserter(intersections));
+        benchmark::DoNotOptimize(count);
+        query++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["boundary_vertices"] = static_cast<double>(environment->starts.size());
+}
+BENCHMARK(BM_RayCast)
+    ->ArgNames({"vertices", "radius_x100"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Cast rays across seeded star rooms to measure scaling in boundary and hole count
+static void BM_RayCastStar(benchmark::State& state) {
+    auto environment = bench::make_environment(bench::star_room(state.range(0), state.range(1)), BURST::numeric::fscalar{0.5});
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+
+    std::vector<BURST::geometry::Point2D> intersections;
+    size_t query = 0;
+    for (auto _ : state) {
+        const BURST::geometry::Point2D& origin = environment->starts[query % environment->starts.size()];
+        double angle = CGAL::to_double(bench::inward_angle(origin, query));
+        BURST::geometry::Ray2D ray{origin, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)}};
+
+        intersections.clear();
+        size_t count = environment->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::Segment2D>(ray, std::back_inserter(intersections));
+        benchmark::DoNotOptimize(count);
+        query++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["boundary_vertices"] = static_cast<double>(environment->starts.size());
+}
+BENCHMARK(BM_RayCastStar)
+    ->ArgNames({"vertices", "holes"})
+    ->ArgsProduct({{64, 256, 1024}, {0, 16, 64}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
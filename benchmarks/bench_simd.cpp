@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <BURST/configuration_space.hpp>
+#include <BURST/boundary.hpp>
+#include <BURST/simd.hpp>
+#include <BURST/geometry.hpp>
+
+#include "bench_helpers.hpp"
+
+// Utility includes for benchmarks
+#include <random>
+#include <vector>
+
+/*
+ * Kernel benchmarks test one query segment against a pool of random leaves, so items processed count curves tested
+ * bench_simd is compiled with AVX2 when the compiler supports it; kernels not compiled in are skipped
+ */
+
+// -- KERNEL BENCHMARKS --------------------------------------------------------
+
+namespace {
+    constexpr std::size_t LEAF_POOL = 1024;
+
+    // Random leaves mixing segments and arcs, with about `arc_percent` percent arcs
+    std::vector<BURST::simd::CurveLeaf> random_leaves(int64_t arc_percent) {
+        std::mt19937 generator(12345);
+        std::uniform_real_distribution<double> coordinate(-50, 50);
+        std::uniform_int_distribution<int64_t> percent(0, 99);
+        std::vector<BURST::simd::CurveLeaf> leaves(LEAF_POOL);
+        for (BURST::simd::CurveLeaf& leaf : leaves) {
+            leaf.count = BURST::simd::LANES;
+            for (std::size_t lane = 0; lane < BURST::simd::LANES; ++lane) {
+                leaf.x0[lane] = coordinate(generator);
+                leaf.y0[lane] = coordinate(generator);
+                leaf.x1[lane] = leaf.x0[lane] + coordinate(generator) / 10;
+                leaf.y1[lane] = leaf.y0[lane] + coordinate(generator) / 10;
+                if (percent(generator) < arc_percent) {
+                    leaf.center_x[lane] = leaf.x0[lane];
+                    leaf.center_y[lane] = leaf.y0[lane] + 1;
+                    leaf.radius[lane] = 1;
+                }
+            }
+        }
+        return leaves;
+    }
+
+    template <typename Kernel>
+    void run_kernel(benchmark::State& state, const Kernel& kernel) {
+        std::vector<BURST::simd::CurveLeaf> leaves = random_leaves(state.range(0));
+        BURST::simd::RaySegment ray = BURST::simd::make_ray_segment(-60, -7, 60, 11, 50);
+        BURST::simd::LeafHits hits;
+        std::size_t reported = 0;
+        for (auto _ : state) {
+            for (const BURST::simd::CurveLeaf& leaf : leaves) reported += __builtin_popcount(kernel(leaf, ray, hits));
+            benchmark::DoNotOptimize(reported);
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(LEAF_POOL * BURST::simd::LANES));
+        state.counters["reported_fraction"] = static_cast<double>(reported) / static_cast<double>(state.iterations() * LEAF_POOL * BURST::simd::LANES);
+    }
+}
+
+// Scalar reference kernel
+static void BM_LeafScalar(benchmark::State& state) {
+    run_kernel(state, [](const BURST::simd::CurveLeaf& leaf, const BURST::simd::RaySegment& ray, BURST::simd::LeafHits& hits) {
+        return BURST::simd::leaf_hits_scalar(leaf, ray, hits);
+    });
+}
+BENCHMARK(BM_LeafScalar)->ArgName("arc_percent")->Arg(0)->Arg(50)->Arg(100);
+
+// SSE2 kernel, two lanes per instruction
+static void BM_LeafSSE2(benchmark::State& state) {
+#ifdef __SSE2__
+    run_kernel(state, [](const BURST::simd::CurveLeaf& leaf, const BURST::simd::RaySegment& ray, BURST::simd::LeafHits& hits) {
+        return BURST::simd::leaf_hits_sse2(leaf, ray, hits);
+    });
+#else
+    state.SkipWithError("SSE2 kernel not compiled in");
+#endif
+}
+BENCHMARK(BM_LeafSSE2)->ArgName("arc_percent")->Arg(0)->Arg(50)->Arg(100);
+
+// AVX2 kernel, four lanes per instruction
+static void BM_LeafAVX2(benchmark::State& state) {
+#ifdef __AVX2__
+    run_kernel(state, [](const BURST::simd::CurveLeaf& leaf, const BURST::simd::RaySegment& ray, BURST::simd::LeafHits& hits) {
+        return BURST::simd::leaf_hits_avx2(leaf, ray, hits);
+    });
+#else
+    state.SkipWithError("AVX2 kernel not compiled in");
+#endif
+}
+BENCHMARK(BM_LeafAVX2)->ArgName("arc_percent")->Arg(0)->Arg(50)->Arg(100);
+
+// -- BOUNDARY BENCHMARKS ------------------------------------------------------
+
+// Collect candidate curves for rays cast from boundary vertices, before exact refinement
+static void BM_SegmentCandidates(benchmark::State& state) {
+    auto environment = bench::make_environment(static_cast<int>(state.range(0)), bench::radius_argument(state.range(1)));
+    if (!environment) {
+        state.SkipWithError("Failed to construct benchmark environment");
+        return;
+    }
+    const BURST::geometry::CompactBoundary& boundary = environment->configuration_space->boundary();
+
+    size_t query = 0;
+    size_t candidates = 0;
+    for (auto _ : state) {
+        const BURST::geometry::Point2D& origin = environment->starts[query % environment->starts.size()];
+        double angle = CGAL::to_double(bench::inward_angle(origin, query));
+        BURST::geometry::Point2D target = origin + BURST::geometry::Vector2D{200 * std::cos(angle), 200 * std::sin(angle)};
+        boundary.segmentCandidates(origin, target, [&candidates](std::size_t) { candidates++; });
+        benchmark::DoNotOptimize(candidates);
+        query++;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["candidates_per_query"] = static_cast<double>(candidates) / static_cast<double>(state.iterations());
+    state.counters["boundary_curves"] = static_cast<double>(boundary.size());
+}
+BENCHMARK(BM_SegmentCandidates)
+    ->ArgNames({"vertices", "radius_x100"})
+    ->ArgsProduct({{8, 32, 128}, {25, 100}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Run BURST benchmarks and compare them against a checked-in baseline.
+
+Each benchmark executable is run with repetitions and JSON output. Every
+benchmark is summarised by the median and the median absolute deviation (MAD)
+of its per-repetition real time, which keeps single noisy repetitions from
+moving the result. A benchmark counts as a regression only when its median is
+slower than the baseline by more than the relative threshold AND by more than
+a multiple of the combined MAD, so noise alone never fails a run.
+
+Usage:
+    compare_baseline.py --baseline baseline.json BENCH [BENCH ...]
+    compare_baseline.py --baseline baseline.json --update BENCH [BENCH ...]
+    compare_baseline.py --baseline baseline.json --results result.json [...]
+
+The exit status is 1 if any benchmark regressed, 2 on usage or run errors or
+when the baseline has no entry for any benchmark that ran, and 0 otherwise.
+Benchmarks that ran without a baseline entry are listed in a warning.
+"""
+
+import argparse
+import json
+import math
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+
+BASELINE_VERSION = 1
+
+# Google Benchmark time units relative to nanoseconds
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def median_and_mad(samples):
+    median = statistics.median(samples)
+    mad = statistics.median(abs(sample - median) for sample in samples)
+    return median, mad
+
+
+def collect_samples(report):
+    """Group per-repetition real times (in ns) by benchmark name from a Google Benchmark JSON report."""
+    samples = {}
+    for entry in report.get("benchmarks", []):
+        # Aggregates (mean/median/stddev) are recomputed here from the raw repetitions
+        if entry.get("run_type") == "aggregate" or entry.get("error_occurred"):
+            continue
+        name = entry.get("run_name", entry["name"])
+        scale = TIME_UNITS[entry.get("time_unit", "ns")]
+        samples.setdefault(name, []).append(entry["real_time"] * scale)
+    return samples
+
+
+def summarise(samples):
+    summary = {}
+    for name, values in samples.items():
+        median, mad = median_and_mad(values)
+        summary[name] = {"median_ns": median, "mad_ns": mad, "repetitions": len(values)}
+    return summary
+
+
+def run_benchmark(executable, repetitions, benchmark_filter, min_time):
+    with tempfile.TemporaryDirectory() as directory:
+        output = os.path.join(directory, "result.json")
+        command = [
+            executable,
+            f"--benchmark_repetitions={repetitions}",
+            "--benchmark_report_aggregates_only=false",
+            f"--benchmark_out={output}",
+            "--benchmark_out_format=json",
+        ]
+        if benchmark_filter:
+            command.append(f"--benchmark_filter={benchmark_filter}")
+        if min_time:
+            command.append(f"--benchmark_min_time={min_time}")
+        print(f"Running {os.path.basename(executable)} ({repetitions} repetitions)", file=sys.stderr)
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+        with open(output) as file:
+            return json.load(file)
+
+
+def load_baseline(path):
+    if not os.path.exists(path):
+        return {}
+    with open(path) as file:
+        baseline = json.load(file)
+    if baseline.get("version") != BASELINE_VERSION:
+        raise ValueError(f"{path}: unsupported baseline version {baseline.get('version')}")
+    return baseline.get("benchmarks", {})
+
+
+def write_baseline(path, summary, merge_with):
+    benchmarks = dict(merge_with)
+    benchmarks.update(summary)
+    baseline = {
+        "version": BASELINE_VERSION,
+        "context": {
+            "machine": platform.machine(),
+            "system": platform.system(),
+        },
+        "benchmarks": {name: benchmarks[name] for name in sorted(benchmarks)},
+    }
+    with open(path, "w") as file:
+        json.dump(baseline, file, indent=2)
+        file.write("\n")
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def compare(baseline, summary, threshold, mad_multiplier):
+    """Return table rows and the number of regressions."""
+    rows = []
+    regressions = 0
+    for name in sorted(set(baseline) | set(summary)):
+        old = baseline.get(name)
+        new = summary.get(name)
+        if old is None:
+            rows.append((name, "-", format_time(new["median_ns"]), "-", "new"))
+            continue
+        if new is None:
+            rows.append((name, format_time(old["median_ns"]), "-", "-", "missing"))
+            continue
+
+        delta = new["median_ns"] - old["median_ns"]
+        relative = delta / old["median_ns"] if old["median_ns"] > 0 else math.inf
+        noise = mad_multiplier * math.hypot(old["mad_ns"], new["mad_ns"])
+        if relative > threshold and delta > noise:
+            status = "REGRESSION"
+            regressions += 1
+        elif relative < -threshold and -delta > noise:
+            status = "improved"
+        else:
+            status = "ok"
+        rows.append((name, format_time(old["median_ns"]), format_time(new["median_ns"]), f"{relative * 100:+.1f}%", status))
+    return rows, regressions
+
+
+def print_table(rows):
+    header = ("Benchmark", "Baseline", "Current", "Delta", "Status")
+    widths = [max(len(str(row[i])) for row in [header, *rows]) for i in range(len(header))]
+    line = "  ".join(f"{{:<{widths[0]}}}" if i == 0 else f"{{:>{width}}}" for i, width in enumerate(widths))
+    print(line.format(*header))
+    print("  ".join("-" * width for width in widths))
+    for row in rows:
+        print(line.format(*row))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("executables", nargs="*", help="benchmark executables to run")
+    parser.add_argument("--baseline", required=True, help="baseline JSON file to compare against or update")
+    parser.add_argument("--results", nargs="+", default=[], help="existing Google Benchmark JSON reports to use instead of running executables")
+    parser.add_argument("--update", action="store_true", help="write the current results into the baseline instead of comparing")
+    parser.add_argument("--repetitions", type=int, default=10, help="repetitions per benchmark (default: 10)")
+    parser.add_argument("--filter", default="", help="only run benchmarks matching this regex")
+    parser.add_argument("--min-time", default="", help="forwarded as --benchmark_min_time")
+    parser.add_argument("--threshold", type=float, default=0.10, help="relative slowdown counted as a regression (default: 0.10)")
+    parser.add_argument("--mad-multiplier", type=float, default=3.0, help="slowdown must also exceed this many combined MADs (default: 3)")
+    args = parser.parse_args()
+
+    if not args.executables and not args.results:
+        parser.error("expected benchmark executables or --results")
+
+    samples = {}
+    try:
+        reports = [run_benchmark(executable, args.repetitions, args.filter, args.min_time) for executable in args.executables]
+        for path in args.results:
+            with open(path) as file:
+                reports.append(json.load(file))
+        for report in reports:
+            for name, values in collect_samples(report).items():
+                samples.setdefault(name, []).extend(values)
+        baseline = load_baseline(args.baseline)
+    except (OSError, ValueError, subprocess.CalledProcessError) as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 2
+
+    summary = summarise(samples)
+    if args.update:
+        write_baseline(args.baseline, summary, baseline)
+        print(f"Updated {args.baseline} with {len(summary)} benchmarks")
+        return 0
+
+    # Only compare benchmarks that were run, so filtered runs do not report everything else as missing
+    if args.filter or args.results:
+        baseline = {name: value for name, value in baseline.items() if name in summary}
+    # A baseline without the benchmarks that ran cannot catch anything, so do not let it pass silently
+    unrecorded = sorted(name for name in summary if name not in baseline)
+    if summary and len(unrecorded) == len(summary):
+        print(f"error: {args.baseline} has no entries for any of the {len(summary)} benchmarks that ran; record one with --update (the bench_baseline target)", file=sys.stderr)
+        return 2
+    if unrecorded:
+        print(f"warning: {len(unrecorded)} benchmark(s) have no baseline entry and were not compared:", file=sys.stderr)
+        for name in unrecorded:
+            print(f"warning:   {name}", file=sys.stderr)
+
+    rows, regressions = compare(baseline, summary, args.threshold, args.mad_multiplier)
+    print_table(rows)
+    print(f"\n{regressions} regression(s) beyond {args.threshold * 100:.0f}% and {args.mad_multiplier:g} MAD")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
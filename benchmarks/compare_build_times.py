@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Time clean builds of a target with and without BURST_compiled.
+
+Two build trees are configured from the same source tree, one with
+-DBUILD_COMPILED_LIBRARY=OFF and one with ON, and the target is rebuilt with
+--clean-first in each. The ON time therefore includes building BURST_compiled
+itself, which later targets of the same build share. The reported times are
+wall-clock medians over the repetitions.
+
+Usage:
+    compare_build_times.py --source . --target test_robot [--repetitions 3]
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def configure(source, build, compiled, extra):
+    command = ["cmake", "-S", source, "-B", build, "-DBUILD_TESTING=ON", f"-DBUILD_COMPILED_LIBRARY={'ON' if compiled else 'OFF'}", *extra]
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+
+
+def timed_build(build, target, jobs):
+    command = ["cmake", "--build", build, "--target", target, f"-j{jobs}", "--clean-first"]
+    start = time.perf_counter()
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--source", default=".", help="BURST source tree (default: .)")
+    parser.add_argument("--target", default="test_robot", help="target to time (default: test_robot)")
+    parser.add_argument("--repetitions", type=int, default=3, help="clean builds per configuration (default: 3)")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="parallel build jobs (default: all cores)")
+    parser.add_argument("--cmake-arg", action="append", default=[], help="extra argument forwarded to both configure steps")
+    args = parser.parse_args()
+
+    results = {}
+    try:
+        with tempfile.TemporaryDirectory() as directory:
+            for compiled in (False, True):
+                build = os.path.join(directory, "compiled" if compiled else "header_only")
+                configure(args.source, build, compiled, args.cmake_arg)
+                times = [timed_build(build, args.target, args.jobs) for _ in range(args.repetitions)]
+                results[compiled] = statistics.median(times)
+    except (OSError, subprocess.CalledProcessError) as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 2
+
+    before, after = results[False], results[True]
+    print(f"{args.target} clean build, median of {args.repetitions}:")
+    print(f"  BUILD_COMPILED_LIBRARY=OFF  {before:.1f} s")
+    print(f"  BUILD_COMPILED_LIBRARY=ON   {after:.1f} s  ({(after - before) / before * 100:+.1f}%)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,48 @@
+#ifndef BURST_ARENA_ARRANGEMENT_HPP
+#define BURST_ARENA_ARRANGEMENT_HPP
+
+/**
+ * @file arena_arrangement.hpp
+ * @brief CGAL arrangements whose DCEL records are served by @ref BURST::memory::ArenaAllocator.
+ *
+ * Kept apart from memory.hpp so that the arena and footprint utilities do not pull in the CGAL
+ * arrangement headers.
+ */
+
+#include <CGAL/Arr_dcel_base.h>
+#include <CGAL/Arrangement_2.h>
+#include "memory.hpp"
+
+namespace BURST::memory {
+
+    /**
+     * @brief Arrangement DCEL whose vertices, halfedges, faces, and curves come from @ref ArenaAllocator.
+     *
+     * Mirrors CGAL's default DCEL apart from the allocator.
+     *
+     * @tparam Traits Arrangement geometry traits.
+     */
+    template <typename Traits>
+    class ArenaDcel : public CGAL::Arr_dcel_base<
+        CGAL::Arr_vertex_base<typename Traits::Point_2>,
+        CGAL::Arr_halfedge_base<typename Traits::X_monotone_curve_2>,
+        CGAL::Arr_face_base,
+        ArenaAllocator<int>
+    > {
+    public:
+        /** @brief Rebind to other traits, as required by @ref CGAL::Arrangement_2. */
+        template <typename OtherTraits>
+        struct rebind {
+            using other = ArenaDcel<OtherTraits>;
+        };
+
+        ArenaDcel() {}
+    };
+
+    /** @brief Arrangement whose DCEL records live in the thread arena while a scope is open. */
+    template <typename Traits>
+    using ArenaArrangement = CGAL::Arrangement_2<Traits, ArenaDcel<Traits>>;
+
+}
+
+#endif
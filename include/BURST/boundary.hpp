@@ -0,0 +1,1023 @@
+#ifndef BURST_BOUNDARY_HPP
+#define BURST_BOUNDARY_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <numeric>
+#include <iterator>
+#include <optional>
+#include <variant>
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <array>
+
+#include <boost/container/small_vector.hpp>
+
+#include "numeric.hpp"
+#include "geometry.hpp"
+#include "simd.hpp"
+#include "memory.hpp"
+
+/**
+ * @file boundary.hpp
+ * @brief Immutable structure-of-arrays view of a configuration-space boundary with a bounding volume hierarchy.
+ */
+
+namespace BURST::geometry {
+
+    /** @brief Boundary point nearest to a query, with the curve it lies on and its exact squared distance. */
+    struct BoundaryPoint {
+        std::size_t curve;
+        Point2D point;
+        numeric::fscalar squared_distance;
+    };
+
+    /** @brief Double-precision nearest boundary point, with the curve it lies on and its distance. */
+    struct ApproximateBoundaryPoint {
+        std::size_t curve;
+        double x, y;
+        double distance;
+    };
+
+    /**
+     * @brief Read-only, contiguous representation of the curves bounding a @ref CurvilinearPolygonSet2D.
+     *
+     * Each boundary curve is stored once, split across parallel arrays: double-precision endpoints,
+     * arc centres/radii/angles, conservative per-curve bounding boxes, loop membership, and the
+     * indices of its neighbours along the loop. A bounding volume hierarchy with leaves of at most
+     * @ref LEAF_SIZE curves is built over those boxes, and the curves are reordered so that every
+     * leaf covers a contiguous index range. The exact @ref MonotoneCurve2D for each index is kept
+     * alongside for the exact refinement step, so every query answers exactly what the polygon set
+     * would while touching only the few candidates whose boxes the double-precision filter admits.
+     * Each leaf is also packed into a @ref simd::CurveLeaf so segment queries test all of its curves
+     * at once with the vectorised kernels of simd.hpp.
+     */
+    class CompactBoundary {
+    public:
+        /** @brief Maximum number of curves per hierarchy leaf. */
+        static constexpr std::size_t LEAF_SIZE = 4;
+
+        /**
+         * @brief Hierarchy node; leaves have a non-zero `count`, inner nodes store their left child in `first` and the right child follows it.
+         *
+         * Leaves also store the index of their packed curves in `leaf`.
+         */
+        struct Node {
+            double xmin, ymin, xmax, ymax;
+            std::uint32_t first;
+            std::uint32_t count;
+            std::uint32_t leaf;
+        };
+
+    private:
+        // Double-precision curve geometry, one entry per curve
+        std::vector<double> source_x, source_y, target_x, target_y;
+        // Arc geometry; radius is zero for segments and the angles are measured from the centre to the source and target
+        std::vector<double> center_x, center_y, arc_radius, start_angle, end_angle;
+        // Conservative bounding boxes
+        std::vector<double> box_xmin, box_ymin, box_xmax, box_ymax;
+        // +1 for counterclockwise arcs, -1 for clockwise arcs, 0 for segments
+        std::vector<std::int8_t> arc_orientation;
+        // Loop membership and neighbours along the loop
+        std::vector<std::uint32_t> loop_id, next_curve, previous_curve;
+        // Exact curves for refinement
+        std::vector<MonotoneCurve2D> exact_curves;
+        // Bounding volume hierarchy, root at index 0
+        std::vector<Node> nodes;
+        // Leaf curves packed lane by lane for the SIMD filters, and the largest coordinate magnitude they bound
+        std::vector<simd::CurveLeaf> packed_leaves;
+        double coordinate_scale;
+        std::size_t loop_count;
+        // Whether each loop bounds a hole rather than the outside of a polygon
+        std::vector<bool> hole_loops;
+        // Arc length from the first curve to the start of each curve, with the perimeter as the final entry
+        std::vector<double> cumulative_length;
+        CurvedTraits traits;
+
+        // Relative slack absorbing the rounding of double coordinates in the filters
+        static constexpr double FILTER_EPSILON = 1e-9;
+
+        struct Pending {
+            MonotoneCurve2D curve;
+            std::uint32_t loop;
+            std::uint32_t next;
+            std::uint32_t previous;
+            BoundingBox2D box;
+        };
+
+        static BoundingBox2D interval_box(const Point2D& point) {
+            auto x = CGAL::to_interval(point.x());
+            auto y = CGAL::to_interval(point.y());
+            return BoundingBox2D{x.first, y.first, x.second, y.second};
+        }
+
+        static double slack(double xmin, double ymin, double xmax, double ymax) {
+            double scale = std::max({std::abs(xmin), std::abs(ymin), std::abs(xmax), std::abs(ymax), 1.0});
+            return FILTER_EPSILON * scale;
+        }
+
+        // Recursively build the hierarchy over `order[first, first + count)`, returning the node index
+        std::uint32_t build(std::vector<std::uint32_t>& order, const std::vector<Pending>& pending, std::size_t first, std::size_t count) {
+            std::uint32_t index = static_cast<std::uint32_t>(this->nodes.size());
+            this->nodes.push_back(Node{
+                std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+                -std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(count), 0
+            });
+            for (std::size_t i = first; i < first + count; ++i) {
+                const BoundingBox2D& box = pending[order[i]].box;
+                Node& node = this->nodes[index];
+                node.xmin = std::min(node.xmin, box.xmin());
+                node.ymin = std::min(node.ymin, box.ymin());
+                node.xmax = std::max(node.xmax, box.xmax());
+                node.ymax = std::max(node.ymax, box.ymax());
+            }
+            if (count <= LEAF_SIZE) return index;
+
+            // Split at the median centroid along the longer axis, keeping the left half a whole number of leaves
+            const Node& node = this->nodes[index];
+            bool split_x = node.xmax - node.xmin >= node.ymax - node.ymin;
+            std::size_t half = (count / 2 + LEAF_SIZE - 1) / LEAF_SIZE * LEAF_SIZE;
+            if (half >= count) half = count / 2;
+            auto centroid = [&pending, split_x](std::uint32_t curve) {
+                const BoundingBox2D& box = pending[curve].box;
+                return split_x ? box.xmin() + box.xmax() : box.ymin() + box.ymax();
+            };
+            std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count, [&centroid](std::uint32_t a, std::uint32_t b) {
+                return centroid(a) < centroid(b);
+            });
+
+            std::uint32_t left = this->build(order, pending, first, half);
+            this->build(order, pending, first + half, count - half);
+            this->nodes[index].first = left;
+            this->nodes[index].count = 0;
+            return index;
+        }
+
+        // Visit every leaf node whose box passes `accept`
+        template <typename Accept, typename VisitLeaf>
+        void traverseLeaves(const Accept& accept, const VisitLeaf& visit_leaf) const {
+            if (this->nodes.empty()) return;
+            boost::container::small_vector<std::uint32_t, 32> stack{0};
+            while (!stack.empty()) {
+                const Node& node = this->nodes[stack.back()];
+                stack.pop_back();
+                if (!accept(node.xmin, node.ymin, node.xmax, node.ymax)) continue;
+                if (node.count > 0) visit_leaf(node);
+                else {
+                    stack.push_back(node.first + 1);
+                    stack.push_back(node.first);
+                }
+            }
+        }
+
+        // Visit every leaf whose box passes `accept`, calling `visit` with each curve index it holds whose box passes too
+        template <typename Accept, typename Visit>
+        void traverse(const Accept& accept, const Visit& visit) const {
+            this->traverseLeaves(accept, [this, &accept, &visit](const Node& node) {
+                for (std::uint32_t curve = node.first; curve < node.first + node.count; ++curve) {
+                    if (accept(this->box_xmin[curve], this->box_ymin[curve], this->box_xmax[curve], this->box_ymax[curve])) visit(curve);
+                }
+            });
+        }
+
+        // Pack the curves of every leaf lane by lane, once the arrays are in leaf order
+        void packLeaves() {
+            for (Node& node : this->nodes) {
+                if (node.count == 0) continue;
+                node.leaf = static_cast<std::uint32_t>(this->packed_leaves.size());
+                simd::CurveLeaf& leaf = this->packed_leaves.emplace_back();
+                leaf.count = node.count;
+                for (std::uint32_t lane = 0; lane < node.count; ++lane) {
+                    std::uint32_t curve = node.first + lane;
+                    leaf.x0[lane] = this->source_x[curve];
+                    leaf.y0[lane] = this->source_y[curve];
+                    leaf.x1[lane] = this->target_x[curve];
+                    leaf.y1[lane] = this->target_y[curve];
+                    leaf.center_x[lane] = this->center_x[curve];
+                    leaf.center_y[lane] = this->center_y[curve];
+                    leaf.radius[lane] = this->arc_radius[curve];
+                }
+            }
+            const Node& root = this->nodes.front();
+            this->coordinate_scale = std::max({std::abs(root.xmin), std::abs(root.ymin), std::abs(root.xmax), std::abs(root.ymax), 1.0});
+        }
+
+        // Exact test for a traits point lying on the curve at `index`
+        bool onCurve(std::size_t index, const CurvedTraits::Point_2& point) const {
+            const MonotoneCurve2D& curve = this->exact_curves[index];
+            auto compare_x = this->traits.compare_x_2_object();
+            if (compare_x(point, this->traits.construct_min_vertex_2_object()(curve)) == CGAL::SMALLER) return false;
+            if (compare_x(point, this->traits.construct_max_vertex_2_object()(curve)) == CGAL::LARGER) return false;
+            return this->traits.compare_y_at_x_2_object()(point, curve) == CGAL::EQUAL;
+        }
+
+        // Angle swept by the arc at `index` from its source to its target, in [0, 2 pi)
+        double arcSweep(std::size_t index) const {
+            constexpr double full_turn = 2.0 * CGAL_PI;
+            double turn = (this->end_angle[index] - this->start_angle[index]) * this->arc_orientation[index];
+            return std::fmod(turn + 2.0 * full_turn, full_turn);
+        }
+
+        // Whether the polar angle `angle` about the arc centre lies within the arc at `index`
+        bool withinArc(std::size_t index, double angle) const {
+            constexpr double full_turn = 2.0 * CGAL_PI;
+            // Measure counterclockwise from whichever endpoint starts the counterclockwise sweep
+            double from = this->arc_orientation[index] > 0 ? this->start_angle[index] : this->end_angle[index];
+            double offset = std::fmod(angle - from + 2.0 * full_turn, full_turn);
+            return offset <= this->arcSweep(index);
+        }
+
+        // Accumulate curve lengths in storage order so arc-length lookups are a binary search
+        void measureLengths() {
+            this->cumulative_length.assign(1, 0.0);
+            this->cumulative_length.reserve(this->size() + 1);
+            for (std::size_t i = 0; i < this->size(); ++i) this->cumulative_length.push_back(this->cumulative_length.back() + this->length(i));
+        }
+
+        // Closest point to (x, y) on the curve at `index` in doubles, returning its squared distance
+        double approximateClosest(std::size_t index, double x, double y, double& closest_x, double& closest_y) const {
+            double sx = this->source_x[index], sy = this->source_y[index];
+            double tx = this->target_x[index], ty = this->target_y[index];
+            if (this->arc_orientation[index] == 0) {
+                double dx = tx - sx, dy = ty - sy;
+                double length = dx * dx + dy * dy;
+                double t = length > 0.0 ? std::clamp(((x - sx) * dx + (y - sy) * dy) / length, 0.0, 1.0) : 0.0;
+                closest_x = sx + t * dx;
+                closest_y = sy + t * dy;
+            } else {
+                double vx = x - this->center_x[index], vy = y - this->center_y[index];
+                double angle = std::atan2(vy, vx);
+                if ((vx != 0.0 || vy != 0.0) && this->withinArc(index, angle)) {
+                    closest_x = this->center_x[index] + this->arc_radius[index] * std::cos(angle);
+                    closest_y = this->center_y[index] + this->arc_radius[index] * std::sin(angle);
+                } else {
+                    // Otherwise the nearest point of the arc is one of its endpoints
+                    bool source_nearer = (x - sx) * (x - sx) + (y - sy) * (y - sy) <= (x - tx) * (x - tx) + (y - ty) * (y - ty);
+                    closest_x = source_nearer ? sx : tx;
+                    closest_y = source_nearer ? sy : ty;
+                }
+            }
+            return (x - closest_x) * (x - closest_x) + (y - closest_y) * (y - closest_y);
+        }
+
+        // Exact closest point to `point` on the curve at `index`
+        Point2D exactClosest(std::size_t index, const Point2D& point) const {
+            using traits_point_t = CurvedTraits::Point_2;
+            using converted_ft = decltype(std::declval<traits_point_t>().x());
+            const MonotoneCurve2D& curve = this->exact_curves[index];
+            Point2D source = convert_point<Point2D, traits_point_t>(curve.source(), numeric::sqrt_to_fscalar<converted_ft>);
+            Point2D target = convert_point<Point2D, traits_point_t>(curve.target(), numeric::sqrt_to_fscalar<converted_ft>);
+
+            if (!curve.is_circular()) {
+                // Project onto the supporting line and clamp to the segment
+                Vector2D direction = target - source;
+                numeric::fscalar t = ((point - source) * direction) / direction.squared_length();
+                if (t <= 0) return source;
+                if (t >= 1) return target;
+                return source + direction * t;
+            }
+            // Project radially onto the supporting circle, keeping the projection if it lies on the arc
+            const Point2D& center = curve.supporting_circle().center();
+            Vector2D offset = point - center;
+            numeric::fscalar length = offset.squared_length();
+            if (length > 0) {
+                Point2D projection = center + offset * (CGAL::sqrt(curve.supporting_circle().squared_radius()) / CGAL::sqrt(length));
+                if (this->onCurve(index, traits_point_t{projection.x(), projection.y()})) return projection;
+            }
+            return CGAL::compare_distance_to_point(point, source, target) != CGAL::LARGER ? source : target;
+        }
+
+        // Smallest approximate sweep along `trajectory` at which its circle (cx, cy, r) meets the curve at `index`
+        // Infinity when the curve is certainly clear of the circle, zero when a near-tangent or near-endpoint contact cannot be placed
+        double approximateCircleEntry(std::size_t index, const ArcTrajectory& trajectory, double cx, double cy, double r, double pad) const {
+            constexpr double none = std::numeric_limits<double>::infinity();
+            double closest_x, closest_y;
+            if (std::sqrt(this->approximateClosest(index, cx, cy, closest_x, closest_y)) > r + pad) return none;
+
+            double sx = this->source_x[index], sy = this->source_y[index];
+            double tx = this->target_x[index], ty = this->target_y[index];
+            double entry = none;
+            bool uncertain = false;
+            auto offer = [&entry, &trajectory](double x, double y) { entry = std::min(entry, trajectory.sweep(x, y)); };
+            if (this->arc_orientation[index] == 0) {
+                double far = std::sqrt(std::max((sx - cx) * (sx - cx) + (sy - cy) * (sy - cy), (tx - cx) * (tx - cx) + (ty - cy) * (ty - cy)));
+                if (far < r - pad) return none;
+                // Solve |s + t (t - s) - c| = r for the parameters of the crossings
+                double dx = tx - sx, dy = ty - sy;
+                double a = dx * dx + dy * dy;
+                if (!(a > 0.0)) return 0.0;
+                double half_b = dx * (sx - cx) + dy * (sy - cy);
+                double c = (sx - cx) * (sx - cx) + (sy - cy) * (sy - cy) - r * r;
+                double discriminant = half_b * half_b - a * c;
+                uncertain = discriminant <= pad * a * (r + 1.0);
+                double root = std::sqrt(std::max(discriminant, 0.0));
+                for (double t : {(-half_b - root) / a, (-half_b + root) / a}) {
+                    if (t >= -FILTER_EPSILON && t <= 1.0 + FILTER_EPSILON) offer(sx + t * dx, sy + t * dy);
+                    else if (t >= -1e-6 && t <= 1.0 + 1e-6) uncertain = true;
+                }
+            } else {
+                double ax = this->center_x[index], ay = this->center_y[index], radius = this->arc_radius[index];
+                double distance = std::hypot(ax - cx, ay - cy);
+                if (distance > r + radius + pad || distance < std::abs(r - radius) - pad) return none;
+                // Concentric circles either overlap entirely or not at all, which only the exact test can tell
+                if (distance <= pad) return 0.0;
+                double along = (distance * distance + r * r - radius * radius) / (2.0 * distance);
+                double height_squared = r * r - along * along;
+                uncertain = height_squared <= pad * (r + 1.0);
+                double height = std::sqrt(std::max(height_squared, 0.0));
+                double ux = (ax - cx) / distance, uy = (ay - cy) / distance;
+                double tolerance = 4.0 * std::sqrt(pad * (radius + 1.0)) + pad;
+                for (double side : {-1.0, 1.0}) {
+                    double x = cx + along * ux - side * height * uy, y = cy + along * uy + side * height * ux;
+                    if (this->withinArc(index, std::atan2(y - ay, x - ax))) offer(x, y);
+                    else if (std::hypot(x - sx, y - sy) <= tolerance || std::hypot(x - tx, y - ty) <= tolerance) uncertain = true;
+                }
+            }
+            if (entry == none) return uncertain ? 0.0 : none;
+            return uncertain ? 0.0 : entry;
+        }
+
+        // Visit every curve whose approximate distance to (x, y) is at most `reach`
+        template <typename Visit>
+        void curvesWithin(double x, double y, double reach, const Visit& visit) const {
+            double reach_squared = reach * reach;
+            auto box_distance = [x, y](double xmin, double ymin, double xmax, double ymax) {
+                double dx = std::max({xmin - x, 0.0, x - xmax});
+                double dy = std::max({ymin - y, 0.0, y - ymax});
+                return dx * dx + dy * dy;
+            };
+            this->traverse([&box_distance, reach_squared](double xmin, double ymin, double xmax, double ymax) {
+                return box_distance(xmin, ymin, xmax, ymax) <= reach_squared;
+            }, [this, x, y, reach_squared, &visit](std::uint32_t curve) {
+                double closest_x, closest_y;
+                if (this->approximateClosest(curve, x, y, closest_x, closest_y) <= reach_squared) visit(static_cast<std::size_t>(curve));
+            });
+        }
+
+    public:
+        CompactBoundary() : coordinate_scale{1.0}, loop_count{0}, traits{} {}
+
+        /**
+         * @brief Build the compact boundary of every loop (outer boundaries and holes) of `shape`.
+         * @param shape Polygon set whose boundary is flattened.
+         */
+        explicit CompactBoundary(const CurvilinearPolygonSet2D& shape) : coordinate_scale{1.0}, loop_count{0}, traits{} {
+            // Gather the curves loop by loop so adjacency can be recorded before reordering
+            std::vector<Pending> pending;
+            auto add_loop = [&pending, this](const CurvilinearPolygon2D& loop, bool hole) {
+                std::uint32_t first = static_cast<std::uint32_t>(pending.size());
+                std::uint32_t size = static_cast<std::uint32_t>(loop.size());
+                std::uint32_t position = 0;
+                for (auto curve_it = loop.curves_begin(); curve_it != loop.curves_end(); ++curve_it, ++position) {
+                    pending.push_back(Pending{
+                        *curve_it,
+                        static_cast<std::uint32_t>(this->loop_count),
+                        first + (position + 1) % size,
+                        first + (position + size - 1) % size,
+                        curve_it->bbox()
+                    });
+                }
+                this->hole_loops.push_back(hole);
+                this->loop_count++;
+            };
+            boost::container::small_vector<HoledCurvilinearPolygon2D, 1> polygons;
+            shape.polygons_with_holes(std::back_inserter(polygons));
+            for (const HoledCurvilinearPolygon2D& polygon : polygons) {
+                add_loop(polygon.outer_boundary(), false);
+                for (auto hole_it = polygon.holes_begin(); hole_it != polygon.holes_end(); ++hole_it) add_loop(*hole_it, true);
+            }
+            if (pending.empty()) return;
+
+            // Build the hierarchy over an index permutation, then lay the arrays out in leaf order
+            std::vector<std::uint32_t> order(pending.size());
+            std::iota(order.begin(), order.end(), 0);
+            this->nodes.reserve(2 * (pending.size() / LEAF_SIZE + 1));
+            this->build(order, pending, 0, order.size());
+
+            std::vector<std::uint32_t> position(pending.size());
+            for (std::size_t i = 0; i < order.size(); ++i) position[order[i]] = static_cast<std::uint32_t>(i);
+
+            std::size_t size = pending.size();
+            for (auto* column : {&this->source_x, &this->source_y, &this->target_x, &this->target_y, &this->center_x, &this->center_y, &this->arc_radius, &this->start_angle, &this->end_angle, &this->box_xmin, &this->box_ymin, &this->box_xmax, &this->box_ymax}) column->reserve(size);
+            this->arc_orientation.reserve(size);
+            this->loop_id.reserve(size);
+            this->next_curve.reserve(size);
+            this->previous_curve.reserve(size);
+            this->exact_curves.reserve(size);
+
+            for (std::uint32_t original : order) {
+                const Pending& entry = pending[original];
+                const MonotoneCurve2D& curve = entry.curve;
+                double sx = CGAL::to_double(curve.source().x()), sy = CGAL::to_double(curve.source().y());
+                double tx = CGAL::to_double(curve.target().x()), ty = CGAL::to_double(curve.target().y());
+                this->source_x.push_back(sx);
+                this->source_y.push_back(sy);
+                this->target_x.push_back(tx);
+                this->target_y.push_back(ty);
+                if (curve.is_circular()) {
+                    double cx = CGAL::to_double(curve.supporting_circle().center().x());
+                    double cy = CGAL::to_double(curve.supporting_circle().center().y());
+                    this->center_x.push_back(cx);
+                    this->center_y.push_back(cy);
+                    this->arc_radius.push_back(std::sqrt(CGAL::to_double(curve.supporting_circle().squared_radius())));
+                    this->start_angle.push_back(std::atan2(sy - cy, sx - cx));
+                    this->end_angle.push_back(std::atan2(ty - cy, tx - cx));
+                    this->arc_orientation.push_back(curve.orientation() == CGAL::COUNTERCLOCKWISE ? 1 : -1);
+                } else {
+                    this->center_x.push_back(0.0);
+                    this->center_y.push_back(0.0);
+                    this->arc_radius.push_back(0.0);
+                    this->start_angle.push_back(0.0);
+                    this->end_angle.push_back(0.0);
+                    this->arc_orientation.push_back(0);
+                }
+                this->box_xmin.push_back(entry.box.xmin());
+                this->box_ymin.push_back(entry.box.ymin());
+                this->box_xmax.push_back(entry.box.xmax());
+                this->box_ymax.push_back(entry.box.ymax());
+                this->loop_id.push_back(entry.loop);
+                this->next_curve.push_back(position[entry.next]);
+                this->previous_curve.push_back(position[entry.previous]);
+                this->exact_curves.push_back(curve);
+            }
+            this->packLeaves();
+            this->measureLengths();
+        }
+
+        /** @brief Number of boundary curves. */
+        std::size_t size() const noexcept { return this->exact_curves.size(); }
+        /** @brief Number of boundary loops (outer boundaries and holes). */
+        std::size_t loops() const noexcept { return this->loop_count; }
+        /** @brief Whether `loop` bounds a hole rather than the outside of a polygon. */
+        bool isHole(std::size_t loop) const { return this->hole_loops[loop]; }
+        /** @brief Whether the boundary has no curves. */
+        bool empty() const noexcept { return this->exact_curves.empty(); }
+        /** @brief Hierarchy nodes, root first. */
+        const std::vector<Node>& hierarchy() const noexcept { return this->nodes; }
+        /** @brief Packed curves of every leaf, indexed by @ref Node::leaf. */
+        const std::vector<simd::CurveLeaf>& leaves() const noexcept { return this->packed_leaves; }
+        /**
+         * @brief Estimated footprint of the flattened curves and the hierarchy.
+         *
+         * The exact curves are copies sharing their exact numbers with the polygon set they were
+         * flattened from, so only the copies themselves are counted.
+         */
+        memory::MemoryUsage memoryUsage() const noexcept {
+            memory::MemoryUsage usage;
+            for (const std::vector<double>* values : {&this->source_x, &this->source_y, &this->target_x, &this->target_y, &this->center_x, &this->center_y, &this->arc_radius, &this->start_angle, &this->end_angle, &this->box_xmin, &this->box_ymin, &this->box_xmax, &this->box_ymax, &this->cumulative_length}) {
+                usage.structure += memory::container_bytes(*values);
+            }
+            usage.structure += memory::container_bytes(this->arc_orientation) + memory::container_bytes(this->loop_id) + memory::container_bytes(this->next_curve) + memory::container_bytes(this->previous_curve);
+            usage.structure += memory::container_bytes(this->exact_curves) + memory::container_bytes(this->nodes) + memory::container_bytes(this->packed_leaves) + memory::container_bytes(this->hole_loops);
+            return usage;
+        }
+
+        /** @brief Exact curve at `index`. */
+        const MonotoneCurve2D& curve(std::size_t index) const { return this->exact_curves[index]; }
+        /** @brief Whether the curve at `index` is a circular arc. */
+        bool isArc(std::size_t index) const { return this->arc_orientation[index] != 0; }
+        /** @brief Arc orientation at `index`: +1 counterclockwise, -1 clockwise, 0 for segments. */
+        int orientation(std::size_t index) const { return this->arc_orientation[index]; }
+        /** @brief Approximate source of the curve at `index`. */
+        std::pair<double, double> source(std::size_t index) const { return {this->source_x[index], this->source_y[index]}; }
+        /** @brief Approximate target of the curve at `index`. */
+        std::pair<double, double> target(std::size_t index) const { return {this->target_x[index], this->target_y[index]}; }
+        /** @brief Approximate arc centre at `index` (zero for segments). */
+        std::pair<double, double> center(std::size_t index) const { return {this->center_x[index], this->center_y[index]}; }
+        /** @brief Approximate arc radius at `index` (zero for segments). */
+        double radius(std::size_t index) const { return this->arc_radius[index]; }
+        /** @brief Approximate polar angles of the arc source and target about its centre (zero for segments). */
+        std::pair<double, double> angles(std::size_t index) const { return {this->start_angle[index], this->end_angle[index]}; }
+        /** @brief Conservative bounding box of the curve at `index`. */
+        BoundingBox2D box(std::size_t index) const { return BoundingBox2D{this->box_xmin[index], this->box_ymin[index], this->box_xmax[index], this->box_ymax[index]}; }
+        /** @brief Loop containing the curve at `index`. */
+        std::size_t loop(std::size_t index) const { return this->loop_id[index]; }
+        /** @brief Approximate length of the curve at `index`. */
+        double length(std::size_t index) const {
+            if (this->arc_orientation[index] == 0) return std::hypot(this->target_x[index] - this->source_x[index], this->target_y[index] - this->source_y[index]);
+            return this->arc_radius[index] * this->arcSweep(index);
+        }
+        /** @brief Approximate total length of every loop. */
+        double perimeter() const noexcept { return this->cumulative_length.empty() ? 0.0 : this->cumulative_length.back(); }
+        /** @brief Next curve along the loop of the curve at `index`. */
+        std::size_t next(std::size_t index) const { return this->next_curve[index]; }
+        /** @brief Previous curve along the loop of the curve at `index`. */
+        std::size_t previous(std::size_t index) const { return this->previous_curve[index]; }
+
+        /**
+         * @brief Conservative bounding box of the whole boundary.
+         * @return Box of the hierarchy root, or an empty box if there are no curves.
+         */
+        BoundingBox2D bbox() const noexcept {
+            if (this->nodes.empty()) return BoundingBox2D{};
+            const Node& root = this->nodes.front();
+            return BoundingBox2D{root.xmin, root.ymin, root.xmax, root.ymax};
+        }
+
+        /**
+         * @brief Visit the index of every curve whose bounding box overlaps `query`.
+         * @param visit Callable taking a `std::size_t` curve index.
+         */
+        template <typename Visit>
+        void candidates(const BoundingBox2D& query, const Visit& visit) const {
+            double pad = slack(query.xmin(), query.ymin(), query.xmax(), query.ymax());
+            this->traverse([&query, pad](double xmin, double ymin, double xmax, double ymax) {
+                return xmin <= query.xmax() + pad && query.xmin() - pad <= xmax && ymin <= query.ymax() + pad && query.ymin() - pad <= ymax;
+            }, [&visit](std::uint32_t curve) { visit(static_cast<std::size_t>(curve)); });
+        }
+
+        /**
+         * @brief Visit every curve the segment from `a` to `b` may meet, with a conservative interval of the meeting points.
+         *
+         * Hierarchy boxes are rejected only if they are disjoint from the segment's box or lie entirely
+         * on one side of its supporting line by more than the rounding slack; the curves of each
+         * surviving leaf are then tested together by @ref simd::leaf_hits. No true hit is ever skipped,
+         * and every true meeting point `a + t * (b - a)` has `t` within the reported interval.
+         *
+         * @param visit Callable taking a `std::size_t` curve index and the `double` bounds of the interval in `[0, 1]`.
+         */
+        template <typename Visit>
+        void segmentHits(const Point2D& a, const Point2D& b, const Visit& visit) const {
+            BoundingBox2D segment_box = interval_box(a) + interval_box(b);
+            double ax = CGAL::to_double(a.x()), ay = CGAL::to_double(a.y());
+            double bx = CGAL::to_double(b.x()), by = CGAL::to_double(b.y());
+            double dx = bx - ax, dy = by - ay;
+            double pad = slack(segment_box.xmin(), segment_box.ymin(), segment_box.xmax(), segment_box.ymax());
+            double side_pad = pad * (std::abs(dx) + std::abs(dy) + 1.0) * 4.0;
+            simd::RaySegment ray = simd::make_ray_segment(ax, ay, bx, by, this->coordinate_scale);
+            simd::LeafHits hits;
+            this->traverseLeaves([&segment_box, ax, ay, dx, dy, pad, side_pad](double xmin, double ymin, double xmax, double ymax) {
+                if (xmin > segment_box.xmax() + pad || segment_box.xmin() - pad > xmax || ymin > segment_box.ymax() + pad || segment_box.ymin() - pad > ymax) return false;
+                // Separating axis along the segment normal: reject boxes strictly on one side of the line
+                double corners[4] = {
+                    dx * (ymin - ay) - dy * (xmin - ax),
+                    dx * (ymin - ay) - dy * (xmax - ax),
+                    dx * (ymax - ay) - dy * (xmin - ax),
+                    dx * (ymax - ay) - dy * (xmax - ax)
+                };
+                bool all_positive = std::all_of(std::begin(corners), std::end(corners), [side_pad](double side) { return side > side_pad; });
+                bool all_negative = std::all_of(std::begin(corners), std::end(corners), [side_pad](double side) { return side < -side_pad; });
+                return !all_positive && !all_negative;
+            }, [this, &ray, &hits, &visit](const Node& node) {
+                unsigned mask = simd::leaf_hits(this->packed_leaves[node.leaf], ray, hits);
+                for (std::uint32_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+                    if (mask & 1u) visit(static_cast<std::size_t>(node.first + lane), hits.t_min[lane], hits.t_max[lane]);
+                }
+            });
+        }
+
+        /**
+         * @brief Visit the index of every curve the segment from `a` to `b` may meet.
+         * @param visit Callable taking a `std::size_t` curve index.
+         */
+        template <typename Visit>
+        void segmentCandidates(const Point2D& a, const Point2D& b, const Visit& visit) const {
+            this->segmentHits(a, b, [&visit](std::size_t curve, double, double) { visit(curve); });
+        }
+
+        /**
+         * @brief Index of a curve containing `point`, if any.
+         *
+         * When `point` is a vertex shared by several curves, any one of them may be returned.
+         *
+         * @return Curve index, or `std::nullopt` if `point` is not on the boundary.
+         */
+        std::optional<std::size_t> locate(const Point2D& point) const {
+            CurvedTraits::Point_2 converted_point{point.x(), point.y()};
+            std::optional<std::size_t> found;
+            this->candidates(interval_box(point), [this, &converted_point, &found](std::size_t curve) {
+                if (!found && this->onCurve(curve, converted_point)) found = curve;
+            });
+            return found;
+        }
+
+        /**
+         * @brief Whether `point` lies exactly on the boundary.
+         * @return True if some boundary curve contains `point`.
+         */
+        bool onEdge(const Point2D& point) const {
+            return this->locate(point).has_value();
+        }
+
+        /**
+         * @brief Whether `point` is an endpoint of the curve at `index`.
+         * @return True if `point` equals the exact source or target of the curve.
+         */
+        bool isEndpoint(std::size_t index, const Point2D& point) const {
+            CurvedTraits::Point_2 converted_point{point.x(), point.y()};
+            const MonotoneCurve2D& curve = this->exact_curves[index];
+            auto equal = this->traits.equal_2_object();
+            return equal(converted_point, curve.source()) || equal(converted_point, curve.target());
+        }
+
+        /**
+         * @brief Exactly intersect `query_curve` with the curve at `index`, reporting every meeting point.
+         *
+         * Isolated crossings and touching points are reported as they are; an overlap reports its two endpoints.
+         *
+         * @param report Callable taking a `CurvedTraits::Point_2`.
+         */
+        template <typename Report>
+        void refine(std::size_t index, const MonotoneCurve2D& query_curve, const Report& report) const {
+            using intersection_t = std::variant<std::pair<CurvedTraits::Point_2, CurvedTraits::Multiplicity>, MonotoneCurve2D>;
+            boost::container::small_vector<intersection_t, 4> results;
+            this->traits.intersect_2_object()(query_curve, this->exact_curves[index], std::back_inserter(results));
+            for (const intersection_t& result : results) {
+                if (const auto* point = std::get_if<0>(&result)) report(point->first);
+                else {
+                    const MonotoneCurve2D& overlap = std::get<1>(result);
+                    report(overlap.source());
+                    report(overlap.target());
+                }
+            }
+        }
+
+        /**
+         * @brief Append the distinct points where `path` meets the boundary, excluding `excluded`.
+         *
+         * Isolated crossings and touching points are reported as they are, and a stretch where the
+         * path runs along a boundary curve contributes the endpoints of the overlap, matching the
+         * vertices that inserting `path` into the boundary arrangement would create.
+         *
+         * @param path Query segment.
+         * @param excluded Point never reported (the ray origin).
+         * @param output Back-insert iterator receiving the points.
+         * @return Number of points appended.
+         */
+        template <typename OutputIteratorCollection>
+        std::size_t segmentIntersections(const Segment2D& path, const Point2D& excluded, std::back_insert_iterator<OutputIteratorCollection>& output) const {
+            return this->segmentIntersections(path, excluded, output, [this](const Point2D& a, const Point2D& b, const auto& visit) {
+                this->segmentCandidates(a, b, visit);
+            });
+        }
+
+        /**
+         * @brief As @ref segmentIntersections, drawing candidate curves from another index over this boundary.
+         * @param candidates Callable taking the segment endpoints and a visitor of `std::size_t` curve indices; it must visit every curve the segment may meet.
+         */
+        template <typename OutputIteratorCollection, typename Candidates>
+        std::size_t segmentIntersections(const Segment2D& path, const Point2D& excluded, std::back_insert_iterator<OutputIteratorCollection>& output, const Candidates& candidates) const {
+            using traits_point_t = CurvedTraits::Point_2;
+            using converted_ft = decltype(std::declval<traits_point_t>().x());
+
+            MonotoneCurve2D query_curve = construct_curve(path);
+            boost::container::small_vector<Point2D, 8> found;
+            auto report = [&found, &path, &excluded](const traits_point_t& point) {
+                Point2D converted = convert_point<Point2D, traits_point_t>(point, numeric::sqrt_to_fscalar<converted_ft>);
+                if (converted == excluded || !path.has_on(converted)) return;
+                if (std::find(found.begin(), found.end(), converted) == found.end()) found.push_back(converted);
+            };
+            candidates(path.source(), path.target(), [this, &query_curve, &report](std::size_t curve) {
+                this->refine(curve, query_curve, report);
+            });
+
+            for (const Point2D& point : found) output = point;
+            return found.size();
+        }
+
+        /**
+         * @brief Running closest hit along a query segment, shared by the first-hit searches of the boundary indices.
+         */
+        struct SegmentFirstHit {
+            const Segment2D& path;
+            const Point2D& excluded;
+            std::optional<Point2D> best{};
+            // Approximate parameter of `best` along the path in [0, 1]
+            double best_t = std::numeric_limits<double>::infinity();
+
+            /** @brief Consider an exact meeting point, keeping it if it is on the path, not excluded, and closer than the best so far. */
+            void offer(const CurvedTraits::Point_2& point) {
+                using converted_ft = decltype(std::declval<CurvedTraits::Point_2>().x());
+                Point2D converted = convert_point<Point2D, CurvedTraits::Point_2>(point, numeric::sqrt_to_fscalar<converted_ft>);
+                if (converted == this->excluded || !this->path.has_on(converted)) return;
+                if (this->best && CGAL::compare_distance_to_point(this->path.source(), *this->best, converted) != CGAL::LARGER) return;
+                this->best = converted;
+                Vector2D direction = this->path.to_vector();
+                this->best_t = CGAL::to_double((converted - this->path.source()) * direction) / CGAL::to_double(direction.squared_length());
+            }
+
+            /** @brief Whether the best hit so far certainly lies before any hit with parameter at least `t`. */
+            bool certifiedBefore(double t) const {
+                return this->best.has_value() && this->best_t + FILTER_EPSILON < t;
+            }
+        };
+
+        /**
+         * @brief Point where `path` first meets the boundary after leaving `path.source()`, excluding `excluded`.
+         *
+         * Candidates are refined in order of their conservative hit intervals, and the search stops
+         * once the closest exact hit so far lies before every remaining interval.
+         *
+         * @param path Query segment.
+         * @param excluded Point never reported (the ray origin).
+         * @return Closest point reported by @ref segmentIntersections, or `std::nullopt` if there is none.
+         */
+        std::optional<Point2D> firstSegmentIntersection(const Segment2D& path, const Point2D& excluded) const {
+            struct Candidate {
+                std::size_t curve;
+                double t_min;
+            };
+            boost::container::small_vector<Candidate, 16> ordered;
+            this->segmentHits(path.source(), path.target(), [&ordered](std::size_t curve, double t_min, double) {
+                ordered.push_back(Candidate{curve, t_min});
+            });
+            std::sort(ordered.begin(), ordered.end(), [](const Candidate& a, const Candidate& b) { return a.t_min < b.t_min; });
+
+            SegmentFirstHit first_hit{path, excluded};
+            MonotoneCurve2D query_curve = construct_curve(path);
+            for (const Candidate& candidate : ordered) {
+                if (first_hit.certifiedBefore(candidate.t_min)) break;
+                this->refine(candidate.curve, query_curve, [&first_hit](const CurvedTraits::Point_2& point) { first_hit.offer(point); });
+            }
+            return first_hit.best;
+        }
+
+        /**
+         * @brief Point where a curved trajectory first meets the boundary after leaving its origin.
+         *
+         * Hierarchy boxes and curves are filtered against the annulus around the trajectory's circle,
+         * and the crossings of each surviving segment or arc are placed approximately by their sweep
+         * from the origin. Candidates are refined exactly against the two halves of the circle in
+         * sweep order, and the search stops once the best exact hit lies before every remaining
+         * candidate. A stretch where the circle runs along a boundary arc contributes its endpoints.
+         *
+         * @param trajectory Curved trajectory; straight trajectories have no circle and find nothing.
+         * @return First exact hit other than the origin, or `std::nullopt` if the circle meets nothing else.
+         */
+        std::optional<Point2D> firstArcIntersection(const ArcTrajectory& trajectory) const {
+            using traits_point_t = CurvedTraits::Point_2;
+            using converted_ft = decltype(std::declval<traits_point_t>().x());
+            if (trajectory.isStraight() || this->empty()) return std::nullopt;
+
+            double cx = CGAL::to_double(trajectory.center().x()), cy = CGAL::to_double(trajectory.center().y());
+            double r = std::sqrt(CGAL::to_double(trajectory.squaredRadius()));
+            double pad = 4.0 * slack(cx - r, cy - r, cx + r, cy + r);
+            // Crossings placed in doubles can be off by the square root of the rounding near tangencies
+            double angle_pad = 4.0 * std::sqrt(pad / r) + pad / r;
+
+            struct Candidate {
+                std::size_t curve;
+                double sweep;
+            };
+            boost::container::small_vector<Candidate, 16> ordered;
+            this->traverse([cx, cy, r, pad](double xmin, double ymin, double xmax, double ymax) {
+                // Keep boxes that reach the circle without lying entirely inside it
+                double near_x = std::max({xmin - cx, 0.0, cx - xmax}), near_y = std::max({ymin - cy, 0.0, cy - ymax});
+                if (near_x * near_x + near_y * near_y > (r + pad) * (r + pad)) return false;
+                double far_x = std::max(std::abs(xmin - cx), std::abs(xmax - cx)), far_y = std::max(std::abs(ymin - cy), std::abs(ymax - cy));
+                return r <= pad || far_x * far_x + far_y * far_y >= (r - pad) * (r - pad);
+            }, [this, &trajectory, &ordered, cx, cy, r, pad, angle_pad](std::uint32_t curve) {
+                double entry = this->approximateCircleEntry(curve, trajectory, cx, cy, r, pad);
+                if (entry == std::numeric_limits<double>::infinity()) return;
+                // Crossings just short of a full turn may be just past the origin
+                double key = entry > 2.0 * CGAL_PI - angle_pad ? 0.0 : std::max(entry - angle_pad, 0.0);
+                ordered.push_back(Candidate{curve, key});
+            });
+            std::sort(ordered.begin(), ordered.end(), [](const Candidate& a, const Candidate& b) { return a.sweep < b.sweep; });
+
+            // The supporting circle split into its lower and upper x-monotone halves
+            const Point2D& center = trajectory.center();
+            numeric::fscalar radius = CGAL::sqrt(trajectory.squaredRadius());
+            CGAL::Circle_2<Kernel> circle{center, trajectory.squaredRadius()};
+            std::array<MonotoneCurve2D, 2> halves{
+                MonotoneCurve2D{circle, traits_point_t{center.x() - radius, center.y()}, traits_point_t{center.x() + radius, center.y()}, CGAL::COUNTERCLOCKWISE},
+                MonotoneCurve2D{circle, traits_point_t{center.x() + radius, center.y()}, traits_point_t{center.x() - radius, center.y()}, CGAL::COUNTERCLOCKWISE}
+            };
+
+            std::optional<Point2D> best;
+            double best_sweep = std::numeric_limits<double>::infinity();
+            auto offer = [&trajectory, &best, &best_sweep](const traits_point_t& point) {
+                Point2D converted = convert_point<Point2D, traits_point_t>(point, numeric::sqrt_to_fscalar<converted_ft>);
+                if (converted == trajectory.source()) return;
+                if (best && !trajectory.before(converted, *best)) return;
+                best = converted;
+                best_sweep = trajectory.sweep(CGAL::to_double(converted.x()), CGAL::to_double(converted.y()));
+            };
+            for (const Candidate& candidate : ordered) {
+                if (best && best_sweep + angle_pad < candidate.sweep) break;
+                for (const MonotoneCurve2D& half : halves) this->refine(candidate.curve, half, offer);
+            }
+            return best;
+        }
+
+        /**
+         * @brief Nearest boundary point to (`x`, `y`) in double precision.
+         *
+         * Searches the hierarchy best first, visiting nodes in order of their box distance and
+         * pruning every node farther than the best curve found so far.
+         *
+         * @param bound Known upper bound on the distance (for instance from a nearby query); nodes beyond it are never visited.
+         * @return Nearest point, or `std::nullopt` if the boundary is empty or no curve lies within `bound`.
+         */
+        std::optional<ApproximateBoundaryPoint> approximateNearest(double x, double y, double bound = std::numeric_limits<double>::infinity()) const {
+            if (this->nodes.empty()) return std::nullopt;
+            auto box_distance = [x, y](const Node& node) {
+                double dx = std::max({node.xmin - x, 0.0, x - node.xmax});
+                double dy = std::max({node.ymin - y, 0.0, y - node.ymax});
+                return dx * dx + dy * dy;
+            };
+
+            std::optional<ApproximateBoundaryPoint> best;
+            double best_squared = bound * bound;
+            // Min-heap of (squared box distance, node)
+            using entry_t = std::pair<double, std::uint32_t>;
+            boost::container::small_vector<entry_t, 32> heap{entry_t{box_distance(this->nodes.front()), 0}};
+            auto farther = [](const entry_t& a, const entry_t& b) { return a.first > b.first; };
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), farther);
+                auto [node_distance, node_index] = heap.back();
+                heap.pop_back();
+                if (node_distance > best_squared) break;
+
+                const Node& node = this->nodes[node_index];
+                if (node.count > 0) {
+                    for (std::uint32_t curve = node.first; curve < node.first + node.count; ++curve) {
+                        double closest_x, closest_y;
+                        double distance = this->approximateClosest(curve, x, y, closest_x, closest_y);
+                        if (distance <= best_squared) {
+                            best_squared = distance;
+                            best = ApproximateBoundaryPoint{curve, closest_x, closest_y, 0.0};
+                        }
+                    }
+                } else {
+                    for (std::uint32_t child : {node.first, node.first + 1}) {
+                        double child_distance = box_distance(this->nodes[child]);
+                        if (child_distance > best_squared) continue;
+                        heap.push_back(entry_t{child_distance, child});
+                        std::push_heap(heap.begin(), heap.end(), farther);
+                    }
+                }
+            }
+            if (best) best->distance = std::sqrt(best_squared);
+            return best;
+        }
+
+        /**
+         * @brief Approximate distances from many points to the boundary.
+         *
+         * Consecutive queries warm-start each other: the previous distance plus the step between the
+         * points bounds the next distance, so spatially coherent batches prune most of the hierarchy.
+         *
+         * @param points Query points.
+         * @param distances Output, one entry per point (infinity for an empty boundary).
+         */
+        void approximateDistances(std::span<const Point2D> points, std::span<double> distances) const {
+            double previous_x = 0.0, previous_y = 0.0;
+            double previous_distance = std::numeric_limits<double>::infinity();
+            for (std::size_t i = 0; i < points.size() && i < distances.size(); ++i) {
+                double x = CGAL::to_double(points[i].x()), y = CGAL::to_double(points[i].y());
+                double step = std::hypot(x - previous_x, y - previous_y);
+                // Widen the warm-start bound slightly so rounding never prunes the true nearest curve
+                double bound = (previous_distance + step) * (1.0 + FILTER_EPSILON) + FILTER_EPSILON * this->coordinate_scale;
+                std::optional<ApproximateBoundaryPoint> nearest = this->approximateNearest(x, y, bound);
+                if (!nearest) nearest = this->approximateNearest(x, y);
+                distances[i] = nearest ? nearest->distance : std::numeric_limits<double>::infinity();
+                previous_x = x;
+                previous_y = y;
+                previous_distance = distances[i];
+            }
+        }
+
+        /**
+         * @brief Exact nearest boundary point to `point`.
+         *
+         * The double-precision search bounds the distance; every curve within that bound (plus the
+         * rounding slack) is then resolved exactly, so ties and near-ties are decided exactly.
+         *
+         * @param hint Optional upper bound on the distance forwarded to @ref approximateNearest.
+         * @return Nearest point with its curve and exact squared distance, or `std::nullopt` for an empty boundary.
+         */
+        std::optional<BoundaryPoint> nearest(const Point2D& point, double hint = std::numeric_limits<double>::infinity()) const {
+            double x = CGAL::to_double(point.x()), y = CGAL::to_double(point.y());
+            std::optional<ApproximateBoundaryPoint> approximate = this->approximateNearest(x, y, hint);
+            if (!approximate && hint != std::numeric_limits<double>::infinity()) approximate = this->approximateNearest(x, y);
+            if (!approximate) return std::nullopt;
+
+            double scale = std::max({this->coordinate_scale, std::abs(x), std::abs(y)});
+            double reach = approximate->distance * (1.0 + FILTER_EPSILON) + 4.0 * FILTER_EPSILON * scale;
+            std::optional<BoundaryPoint> best;
+            this->curvesWithin(x, y, reach, [this, &point, &best](std::size_t curve) {
+                Point2D closest = this->exactClosest(curve, point);
+                if (best && CGAL::compare_distance_to_point(point, best->point, closest) != CGAL::LARGER) return;
+                best = BoundaryPoint{curve, closest, 0};
+            });
+            if (best) best->squared_distance = CGAL::squared_distance(point, best->point);
+            return best;
+        }
+
+        /**
+         * @brief Exact nearest boundary points to many points, warm-starting each search from the previous answer.
+         * @param points Query points.
+         * @return One entry per point, `std::nullopt` only for an empty boundary.
+         */
+        std::vector<std::optional<BoundaryPoint>> nearest(std::span<const Point2D> points) const {
+            std::vector<std::optional<BoundaryPoint>> results;
+            results.reserve(points.size());
+            std::vector<double> distances(points.size());
+            this->approximateDistances(points, distances);
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                // Each exact search only needs to confirm the distance the batch pass already found
+                double hint = distances[i] * (1.0 + FILTER_EPSILON) + 4.0 * FILTER_EPSILON * this->coordinate_scale;
+                results.push_back(this->nearest(points[i], hint));
+            }
+            return results;
+        }
+
+        /**
+         * @brief Exact point on the curve at `index` at approximately the fraction `t` of its length.
+         *
+         * The fraction is resolved in doubles, but the returned point lies exactly on the curve, so
+         * @ref onEdge holds for it. Segments interpolate linearly; arcs take the exact point of the
+         * x-monotone arc above or below the approximate x-coordinate.
+         *
+         * @param index Curve index.
+         * @param t Fraction of the curve's length from its source, clamped to [0, 1].
+         * @return Exact point on the curve; the curve's endpoints for `t` of 0 and 1.
+         */
+        Point2D pointOnCurve(std::size_t index, double t) const {
+            using traits_point_t = CurvedTraits::Point_2;
+            using converted_ft = decltype(std::declval<traits_point_t>().x());
+            const MonotoneCurve2D& curve = this->exact_curves[index];
+            Point2D source = convert_point<Point2D, traits_point_t>(curve.source(), numeric::sqrt_to_fscalar<converted_ft>);
+            Point2D target = convert_point<Point2D, traits_point_t>(curve.target(), numeric::sqrt_to_fscalar<converted_ft>);
+            if (!(t > 0.0)) return source;
+            if (t >= 1.0) return target;
+
+            if (!curve.is_circular()) return source + (target - source) * numeric::fscalar(t);
+
+            // Approximate the x-coordinate, then clamp it to the arc's exact x-range
+            double angle = this->start_angle[index] + this->arc_orientation[index] * t * this->arcSweep(index);
+            numeric::fscalar x(this->center_x[index] + this->arc_radius[index] * std::cos(angle));
+            numeric::fscalar left = CGAL::min(source.x(), target.x());
+            numeric::fscalar right = CGAL::max(source.x(), target.x());
+            if (x < left) x = left;
+            if (x > right) x = right;
+            // Moving left to right clockwise traces the upper half of the circle
+            bool upper = (curve.orientation() == CGAL::CLOCKWISE) == (source.x() < target.x());
+            const Point2D& center = curve.supporting_circle().center();
+            numeric::fscalar height = CGAL::sqrt(curve.supporting_circle().squared_radius() - CGAL::square(x - center.x()));
+            return Point2D{x, upper ? center.y() + height : center.y() - height};
+        }
+
+        /**
+         * @brief Approximate arc length from the source of the curve at `index` to `point`.
+         *
+         * The point is projected onto the curve in doubles, so points near but off the curve are
+         * measured at their projection.
+         *
+         * @return Length in [0, @ref length(index)].
+         */
+        double offsetOnCurve(std::size_t index, const Point2D& point) const {
+            double x = CGAL::to_double(point.x()), y = CGAL::to_double(point.y());
+            double sx = this->source_x[index], sy = this->source_y[index];
+            if (this->arc_orientation[index] == 0) {
+                double dx = this->target_x[index] - sx, dy = this->target_y[index] - sy;
+                double length = std::hypot(dx, dy);
+                if (!(length > 0.0)) return 0.0;
+                return std::clamp(((x - sx) * dx + (y - sy) * dy) / length, 0.0, length);
+            }
+            constexpr double full_turn = 2.0 * CGAL_PI;
+            double angle = std::atan2(y - this->center_y[index], x - this->center_x[index]);
+            double turn = std::fmod((angle - this->start_angle[index]) * this->arc_orientation[index] + 2.0 * full_turn, full_turn);
+            // Projections just before the source wrap to a full turn, so fold them back onto the arc
+            if (turn > this->arcSweep(index)) turn = turn - this->arcSweep(index) < full_turn - turn ? this->arcSweep(index) : 0.0;
+            return this->arc_radius[index] * turn;
+        }
+
+        /**
+         * @brief Curve and local fraction at a normalised arc length along the boundary.
+         *
+         * Arc length runs through the curves in storage order (loop by loop is not guaranteed), which
+         * is all uniform sampling needs. Lookup is a binary search over the cumulative lengths.
+         *
+         * @param fraction Normalised arc length in [0, 1], clamped.
+         * @return Curve index and fraction of that curve's length, or `std::nullopt` for an empty boundary.
+         */
+        std::optional<std::pair<std::size_t, double>> locateArcLength(double fraction) const {
+            if (this->empty() || !(this->perimeter() > 0.0)) return std::nullopt;
+            double target = std::clamp(fraction, 0.0, 1.0) * this->perimeter();
+            auto upper = std::upper_bound(this->cumulative_length.begin() + 1, this->cumulative_length.end() - 1, target);
+            std::size_t index = static_cast<std::size_t>(upper - this->cumulative_length.begin()) - 1;
+            double length = this->cumulative_length[index + 1] - this->cumulative_length[index];
+            double t = length > 0.0 ? std::clamp((target - this->cumulative_length[index]) / length, 0.0, 1.0) : 0.0;
+            return std::make_pair(index, t);
+        }
+
+        /**
+         * @brief Exact boundary point at a normalised arc length.
+         * @param fraction Normalised arc length in [0, 1], clamped.
+         * @return Point exactly on the boundary, or `std::nullopt` for an empty boundary.
+         */
+        std::optional<Point2D> pointAtArcLength(double fraction) const {
+            std::optional<std::pair<std::size_t, double>> located = this->locateArcLength(fraction);
+            if (!located) return std::nullopt;
+            return this->pointOnCurve(located->first, located->second);
+        }
+    };
+
+}
+
+#endif
@@ -9,10 +9,15 @@
 #include <optional>
 #include <variant>
 #include <memory>
+#include <mutex>
 #include <ranges>
 #include <iterator>
 #include <functional>
 #include <algorithm>
+#include <vector>
+#include <span>
+#include <limits>
+#include <random>
 #include <source_location>
 
 #include <CGAL/Arr_naive_point_location.h>
@@ -21,15 +26,28 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include "extern_templates.hpp"
 #include "numeric.hpp"
 #include "geometry.hpp"
 #include "renderable.hpp"
+#include "tracing.hpp"
+#include "memory.hpp"
+#include "arena_arrangement.hpp"
+#include "boundary.hpp"
+#include "grid.hpp"
+#include "measure.hpp"
 
 namespace BURST::geometry {
     
     // Forward declare WallSpace for ConfigurationSpace
     class WallSpace;
 
+    /** @brief Spatial index serving the segment queries of a @ref ConfigurationSpace. */
+    enum class BoundaryIndex {
+        Hierarchy, ///< Bounding volume hierarchy of the @ref CompactBoundary (default)
+        Grid       ///< Uniform @ref BoundaryGrid walked with a DDA
+    };
+
     /**
      * @brief Free space available to the robot’s reference point for a given wall layout and radius.
      *
@@ -44,39 +62,96 @@ namespace BURST::geometry {
     class ConfigurationSpace : public renderable::Renderable {
     private:
         std::shared_ptr<CurvilinearPolygonSet2D> configuration_shape;
-        mutable std::optional<BoundingBox2D> bounding_box;
+        // Flattened copy of the boundary serving the read-only queries
+        CompactBoundary compact_boundary;
+        // Index used for segment queries; the grid is only built when selected
+        BoundaryIndex boundary_index;
+        std::optional<BoundaryGrid> boundary_grid;
+        double grid_cells_per_curve;
+        // Conservative box of the boundary, taken from the compact boundary at construction
+        BoundingBox2D bounding_box;
+        // Area and perimeter, computed once on first request from any thread; copies share them with the shape
+        struct MeasureCache {
+            std::once_flag exact_once;
+            std::once_flag approximate_once;
+            std::optional<ShapeMeasure<numeric::hpscalar>> exact;
+            std::optional<ShapeMeasure<double>> approximate;
+        };
+        std::shared_ptr<MeasureCache> measures;
 
-        ConfigurationSpace(std::unique_ptr<CurvilinearPolygonSet2D>&& shape) noexcept : Renderable{}, configuration_shape{std::move(shape)}, bounding_box{} {}
+        // Builds the compact boundary, so it allocates; `shape` must not be null (checked by create)
+        ConfigurationSpace(std::unique_ptr<CurvilinearPolygonSet2D>&& shape) : Renderable{}, configuration_shape{std::move(shape)}, compact_boundary{*this->configuration_shape}, boundary_index{BoundaryIndex::Hierarchy}, boundary_grid{}, grid_cells_per_curve{BoundaryGrid::DEFAULT_CELLS_PER_CURVE}, bounding_box{this->compact_boundary.bbox()}, measures{std::make_shared<MeasureCache>()} {}
 
-        static std::shared_ptr<ConfigurationSpace> create(std::unique_ptr<CurvilinearPolygonSet2D>&& shape) noexcept {
+        static std::shared_ptr<ConfigurationSpace> create(std::unique_ptr<CurvilinearPolygonSet2D>&& shape, const std::source_location location = std::source_location::current()) {
+            if (shape == nullptr) {
+                burst_error("Cannot create a configuration space without a shape", location);
+                return nullptr;
+            }
             return std::shared_ptr<ConfigurationSpace>{new ConfigurationSpace{std::move(shape)}};
         }
         
-        /** 
-         * @internal Lazy bounding-box computation; `flag` is unused (overload disambiguation only).
-         * @return Cached bounding box (computed on first request).
+        /**
+         * @internal Append the vertices of `arrangement` created by inserting `long_path` (other than `ray_source`).
+         * @return Number of points appended.
          */
-        BoundingBox2D& bbox(const std::monostate& flag) const noexcept {
-            if (!this->bounding_box.has_value()) {
-                // Create small vector with buffer of 1, since we expect most configuration spaces to be a single holed polygon
-                boost::container::small_vector<HoledCurvilinearPolygon2D, 1> polygons;
-                this->configuration_shape->polygons_with_holes(std::back_inserter(polygons));
-                this->bounding_box = BoundingBox2D{};
-                for (const HoledCurvilinearPolygon2D& polygon : polygons) *this->bounding_box += polygon.outer_boundary().bbox();
+        template <typename Arrangement, valid_path_type Path, typename OutputIteratorCollection>
+        static size_t collectIntersections(const Arrangement& arrangement, const Point2D& ray_source, const Path& long_path, std::back_insert_iterator<OutputIteratorCollection>& intersection_points) {
+            // Convert the ray source to the traits required for the source containment check
+            auto converted_source = CurvedTraits::Point_2(ray_source.x(), ray_source.y());
+            // Track the number of intersections found
+            size_t intersection_count = 0;
+
+            /*
+             * Iterate through the arrangement vertices to find the intersection point
+             * Existing polygon vertices will have a degree of 2
+             * Intersections will have a degree greater than that since the long segment will increase the number of edges incident to the vertex
+             */
+            for (auto vertex_it = arrangement.vertices_begin(); vertex_it != arrangement.vertices_end(); ++vertex_it) {
+                if (vertex_it->point() == converted_source) continue; // Skip the source of the ray since that's not an intersection
+                // Skip if edge or endpoint
+                if (vertex_it->degree() <= 2) continue;
+
+                // Convert the vertex point back to a Point2D and return it as the intersection point
+                auto intersection_point = vertex_it->point();
+                Point2D to_add = convert_point<Point2D, decltype(intersection_point)>(intersection_point, numeric::sqrt_to_fscalar<decltype(intersection_point.x())>);
+                // Add the point to the output collection using the provided output iterator, given it is not the source of the ray and it lies on the ray path
+                if (to_add != ray_source && long_path.has_on(to_add)) {
+                    intersection_points = to_add;
+                    intersection_count++;
+                }
             }
-            return this->bounding_box.value();
+            return intersection_count; // Return the number of intersections found
+        }
+
+        /**
+         * @internal Extend the ray from `ray_source` along `ray_vector` far enough to pass through the whole bounding box.
+         */
+        template <valid_path_type Path>
+        Path longPath(const Point2D& ray_source, const Vector2D& ray_vector) const {
+            // Identify the margin of the bounding box to determine an extreme magnitude for the ray to be clipped at
+            numeric::fscalar margin = this->bbox().xmax() - this->bbox().xmin() + this->bbox().ymax() - this->bbox().ymin();
+            // Compute the maximum distance between the ray source and an edge of the bounding box to guarantee the ray passes through the bounding box in its entirety
+            numeric::fscalar displacement = std::max({
+                numeric::abs(ray_source.x() - this->bbox().xmin()), 
+                numeric::abs(ray_source.x() - this->bbox().xmax()),
+                numeric::abs(ray_source.y() - this->bbox().ymin()),
+                numeric::abs(ray_source.y() - this->bbox().ymax())
+            });
+            // Create a segment from the ray with the identified margin
+            return Path{ray_source, ray_source + ray_vector * (margin + displacement)};
         }
 
     public:
         /**
          * @brief Axis-aligned bounding box of the configuration region.
          *
-         * The box is computed on first use and cached for subsequent queries.
+         * The box is computed at construction from the compact boundary, so it may be slightly
+         * larger than the exact region but never smaller, and reading it is safe from any thread.
          *
-         * @return Cached bounding box of the configuration region.
+         * @return Bounding box of the configuration region.
          */
         const BoundingBox2D& bbox() const noexcept {
-            return this->bbox(std::monostate{});
+            return this->bounding_box;
         }
         /**
          * @brief CGAL arrangement backing the configuration polygon set.
@@ -89,6 +164,23 @@ namespace BURST::geometry {
         auto& arrangement() const noexcept {
             return this->configuration_shape->arrangement();
         }
+        /**
+         * @brief Polygon set describing the configuration region.
+         * @return Const reference to the underlying polygon set.
+         */
+        const CurvilinearPolygonSet2D& shape() const noexcept {
+            return *this->configuration_shape;
+        }
+        /**
+         * @brief Compact structure-of-arrays copy of the boundary built at creation.
+         *
+         * Backs the read-only queries below; exposed for callers that scan boundary curves at high rates.
+         *
+         * @return Const reference to the compact boundary.
+         */
+        const CompactBoundary& boundary() const noexcept {
+            return this->compact_boundary;
+        }
         
         /**
          * @brief Whether `point` lies on the boundary of the configuration space.
@@ -97,9 +189,8 @@ namespace BURST::geometry {
          * @return True if `point` lies on the configuration-space boundary.
          */
         bool onEdge(const Point2D& point) const noexcept {
-            // Convert the point to the traits required for the intersection check
-            auto converted_point = CurvedTraits::Point_2(point.x(), point.y());
-            return this->configuration_shape->oriented_side(converted_point) == CGAL::ON_ORIENTED_BOUNDARY;
+            // Only the curves whose boxes contain the point are tested exactly
+            return this->compact_boundary.onEdge(point);
         }
 
         /**
@@ -109,12 +200,137 @@ namespace BURST::geometry {
          * @return True if `point` is inside or on the boundary of the configuration space.
          */
         bool contains(const Point2D& point) const noexcept {
+            // Points outside the boundary's bounding box cannot be contained
+            BoundingBox2D box = this->compact_boundary.bbox();
+            auto x = CGAL::to_interval(point.x());
+            auto y = CGAL::to_interval(point.y());
+            if (x.second < box.xmin() || x.first > box.xmax() || y.second < box.ymin() || y.first > box.ymax()) return false;
             // Convert the point to the traits required for the containment check
             auto converted_point = CurvedTraits::Point_2(point.x(), point.y());
             auto orientation = this->configuration_shape->oriented_side(converted_point);
             return orientation == CGAL::ON_ORIENTED_BOUNDARY || orientation == CGAL::ON_POSITIVE_SIDE;
         }
 
+        /**
+         * @brief Exact nearest point on the configuration-space boundary to `point`.
+         *
+         * Works for points anywhere in the plane; combine with @ref contains to tell clearance inside
+         * the free space from penetration outside it.
+         *
+         * @param point Query point in workspace coordinates.
+         * @return Nearest boundary point, its curve, and exact squared distance; `std::nullopt` only for an empty boundary.
+         */
+        std::optional<BoundaryPoint> nearestBoundaryPoint(const Point2D& point) const noexcept {
+            return this->compact_boundary.nearest(point);
+        }
+
+        /**
+         * @brief Exact nearest boundary points to many query points.
+         *
+         * Queries are answered in order and warm-start each other, so spatially coherent batches
+         * (grids, trajectories) are much cheaper than independent calls.
+         *
+         * @param points Query points in workspace coordinates.
+         * @return One entry per point, as for @ref nearestBoundaryPoint.
+         */
+        std::vector<std::optional<BoundaryPoint>> nearestBoundaryPoints(std::span<const Point2D> points) const {
+            return this->compact_boundary.nearest(points);
+        }
+
+        /**
+         * @brief Approximate (double-precision) distance from `point` to the configuration-space boundary.
+         *
+         * @param point Query point in workspace coordinates.
+         * @return Distance, accurate to the rounding of the boundary coordinates; infinity for an empty boundary.
+         */
+        double distanceToBoundary(const Point2D& point) const noexcept {
+            std::optional<ApproximateBoundaryPoint> nearest = this->compact_boundary.approximateNearest(CGAL::to_double(point.x()), CGAL::to_double(point.y()));
+            return nearest ? nearest->distance : std::numeric_limits<double>::infinity();
+        }
+
+        /**
+         * @brief Approximate distances from many points to the boundary, warm-starting each query from the previous one.
+         * @param points Query points in workspace coordinates.
+         * @param distances Output with one entry per point.
+         */
+        void distancesToBoundary(std::span<const Point2D> points, std::span<double> distances) const noexcept {
+            this->compact_boundary.approximateDistances(points, distances);
+        }
+
+        /**
+         * @brief High-precision area and perimeter of the configuration region (see @ref geometry::measure).
+         *
+         * Computed on first use and cached, so coverage ratios against the free area cost a division.
+         * Concurrent first requests compute it once.
+         *
+         * @return Cached area and perimeter.
+         */
+        const ShapeMeasure<numeric::hpscalar>& measure() const {
+            std::call_once(this->measures->exact_once, [this]() { this->measures->exact = geometry::measure<numeric::hpscalar>(*this->configuration_shape); });
+            return *this->measures->exact;
+        }
+
+        /**
+         * @brief Double-precision area and perimeter of the configuration region, computed on first use and cached.
+         * @return Cached area and perimeter.
+         */
+        const ShapeMeasure<double>& approximateMeasure() const {
+            std::call_once(this->measures->approximate_once, [this]() { this->measures->approximate = geometry::measure<double>(*this->configuration_shape); });
+            return *this->measures->approximate;
+        }
+
+        /** @brief High-precision area of the configuration region; see @ref measure. */
+        const numeric::hpscalar& area() const {
+            return this->measure().area;
+        }
+
+        /** @brief Double-precision area of the configuration region; see @ref approximateMeasure. */
+        double approximateArea() const {
+            return this->approximateMeasure().area;
+        }
+
+        /**
+         * @brief Approximate total length of the configuration-space boundary, holes included.
+         * @return Perimeter in workspace units; zero for an empty boundary.
+         */
+        double perimeter() const noexcept {
+            return this->compact_boundary.perimeter();
+        }
+
+        /**
+         * @brief Boundary point at a normalised arc length, in O(log n) over the boundary curves.
+         *
+         * The returned point lies exactly on the boundary, so it satisfies @ref onEdge and is a valid
+         * start position for a @ref Robot.
+         *
+         * @param fraction Normalised arc length in [0, 1], clamped.
+         * @return Boundary point, or `std::nullopt` for an empty boundary.
+         */
+        std::optional<Point2D> pointAtArcLength(double fraction) const {
+            return this->compact_boundary.pointAtArcLength(fraction);
+        }
+
+        /**
+         * @brief Draw boundary points uniformly by arc length.
+         *
+         * Fractions are drawn from the top 53 bits of each output of `engine`, the same portable
+         * scheme as the environment generators, so a seed reproduces the samples on every platform.
+         *
+         * @param count Number of samples.
+         * @param engine Random engine, advanced once per sample.
+         * @return `count` points exactly on the boundary, or none for an empty boundary.
+         */
+        std::vector<Point2D> sampleBoundary(std::size_t count, std::mt19937_64& engine) const {
+            std::vector<Point2D> samples;
+            if (this->compact_boundary.empty()) return samples;
+            samples.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                double fraction = static_cast<double>(engine() >> 11) * 0x1.0p-53;
+                samples.push_back(*this->compact_boundary.pointAtArcLength(fraction));
+            }
+            return samples;
+        }
+
         /**
          * @brief Classify boundary incidence for a point on the configuration space boundary.
          *
@@ -126,24 +342,15 @@ namespace BURST::geometry {
          * @return `std::nullopt` if `point` is in a face interior; otherwise the incident curve or vertex point.
          */
         std::optional<std::variant<MonotoneCurve2D, Point2D>> intersection(const Point2D& point) const noexcept {
-            using arrangement_t = CurvilinearPolygonSet2D::Arrangement_2;
-            using converted_point_t = arrangement_t::Point_2;
-            using converted_ft = decltype(std::declval<converted_point_t>().x());
-
-            // Attempt to find the point in the arrangement of the configuration space using a landmarks point location
-            auto converted_point = convert_point<converted_point_t>(point);
-            auto result = CGAL::Arr_naive_point_location<arrangement_t>{this->configuration_shape->arrangement()}.locate(converted_point);
-
-            // Handle according to the type of the result
-            // If the point is located on a face, then it's not an intersection since the point is not on the boundary of the configuration space
-            if (std::holds_alternative<arrangement_t::Face_const_handle>(result)) return std::nullopt;
-            // If the point is located on an edge, then it's an intersection with the configuration space boundary
-            if (std::holds_alternative<arrangement_t::Halfedge_const_handle>(result)) {
-                return std::get<arrangement_t::Halfedge_const_handle>(result)->curve();
-            }
-            // Otherwise, the point is located on a vertex, and it's an intersection with the configuration space boundary
+            // Find a boundary curve containing the point among the curves whose boxes contain it
+            std::optional<std::size_t> curve = this->compact_boundary.locate(point);
+            // If no curve contains the point, then it's not an intersection since the point is not on the boundary of the configuration space
+            if (!curve) return std::nullopt;
+            // If the point is an endpoint of the curve, then it's located on a vertex of the boundary
             // In practice, this should be a very rare case since the robot would have to traverse exactly to a vertex, but handle it anyway
-            return convert_point<Point2D, converted_point_t>(std::get<arrangement_t::Vertex_const_handle>(result)->point(), numeric::sqrt_to_fscalar<converted_ft>);
+            if (this->compact_boundary.isEndpoint(*curve, point)) return point;
+            // Otherwise the point is located on the interior of an edge
+            return this->compact_boundary.curve(*curve);
         }
         
         /**
@@ -172,50 +379,130 @@ namespace BURST::geometry {
                 SourceFunc source = &Trajectory::source,
                 VectorizeFunc vectorize = &Trajectory::to_vector
             ) const noexcept {
+            tracing::Span span{"ConfigurationSpace::intersection"};
             Point2D ray_source = std::invoke(source, trajectory);
-            Vector2D ray_vector = std::invoke(vectorize, trajectory);
+            Path long_path = this->longPath<Path>(ray_source, std::invoke(vectorize, trajectory));
 
-            // Identify the margin of the bounding box to determine an extreme magnitude for the ray to be clipped at
-            numeric::fscalar margin = this->bbox().xmax() - this->bbox().xmin() + this->bbox().ymax() - this->bbox().ymin();
-            // Compute the maximum distance between the ray source and an edge of the bounding box to guarantee the ray passes through the bounding box in its entirety
-            numeric::fscalar displacement = std::max({
-                numeric::abs(ray_source.x() - this->bbox().xmin()), 
-                numeric::abs(ray_source.x() - this->bbox().xmax()),
-                numeric::abs(ray_source.y() - this->bbox().ymin()),
-                numeric::abs(ray_source.y() - this->bbox().ymax())
-            });
-            // Create a segment from the ray with the identified margin
-            Path long_path{ray_source, ray_source + ray_vector * (margin + displacement)};
+            // Straight paths are intersected against the candidate curves of the selected index only
+            if constexpr (std::same_as<Path, Segment2D>) {
+                if (this->boundary_grid) return this->boundary_grid->segmentIntersections(this->compact_boundary, long_path, ray_source, intersection_points);
+                return this->compact_boundary.segmentIntersections(long_path, ray_source, intersection_points);
+            } else {
+#ifdef BURST_ENABLE_ARENA
+                // The query arrangement only lives for this call, so serve its DCEL records and curves from the thread arena
+                memory::ArenaScope scope;
+                std::vector<MonotoneCurve2D, memory::ArenaAllocator<MonotoneCurve2D>> boundary_curves;
+                boundary_curves.reserve(this->configuration_shape->arrangement().number_of_edges());
+                for (auto edge_it = this->configuration_shape->arrangement().edges_begin(); edge_it != this->configuration_shape->arrangement().edges_end(); ++edge_it) {
+                    boundary_curves.push_back(edge_it->curve());
+                }
+                // Boundary curves are interior-disjoint, so they can be inserted without intersection tests
+                memory::ArenaArrangement<CurvedTraits> arrangement;
+                CGAL::insert_non_intersecting_curves(arrangement, boundary_curves.begin(), boundary_curves.end());
+#else
+                // Get the arrangement of the ConfigurationSpace to insert the segment into for intersection checking
+                CurvilinearPolygonSet2D::Arrangement_2 arrangement = this->configuration_shape->arrangement();
+#endif
+                // Insert the long segment into the arrangement
+                CGAL::insert(arrangement, long_path);
+                return collectIntersections(arrangement, ray_source, long_path, intersection_points);
+            }
+        }
 
-            // Get the arrangement of the ConfigurationSpace to insert the segment into for intersection checking
-            CurvilinearPolygonSet2D::Arrangement_2 arrangement = this->configuration_shape->arrangement();
-            // Insert the long segment into the arrangement
-            CGAL::insert(arrangement, long_path);
-            // Convert the ray source to the traits required for the source containment check
-            auto converted_source = CurvedTraits::Point_2(ray_source.x(), ray_source.y());
-            // Track the number of intersections found
-            size_t intersection_count = 0;
+        /**
+         * @brief Closest boundary point hit by a directed trajectory, other than its origin.
+         *
+         * Equivalent to the nearest point appended by @ref intersection with a @ref Segment2D path,
+         * but the selected index stops refining candidates once the first hit is certified.
+         *
+         * @tparam Trajectory Trajectory type satisfying @ref valid_trajectory_type.
+         * @param trajectory Instance to query.
+         * @param source     Defaults to `&Trajectory::source`.
+         * @param vectorize  Defaults to `&Trajectory::to_vector`.
+         * @return First boundary hit, or `std::nullopt` if the trajectory leaves without hitting the boundary.
+         */
+        template <valid_trajectory_type Trajectory, typename SourceFunc = const Point2D&(Trajectory::*)() const, typename VectorizeFunc = Vector2D(Trajectory::*)() const>
+        std::optional<Point2D> firstIntersection(
+                const Trajectory& trajectory,
+                SourceFunc source = &Trajectory::source,
+                VectorizeFunc vectorize = &Trajectory::to_vector
+            ) const noexcept {
+            tracing::Span span{"ConfigurationSpace::firstIntersection"};
+            Point2D ray_source = std::invoke(source, trajectory);
+            Segment2D long_path = this->longPath<Segment2D>(ray_source, std::invoke(vectorize, trajectory));
+            if (this->boundary_grid) return this->boundary_grid->firstSegmentIntersection(this->compact_boundary, long_path, ray_source);
+            return this->compact_boundary.firstSegmentIntersection(long_path, ray_source);
+        }
 
-            /*
-             * Iterate through the arrangement vertices to find the intersection point
-             * Existing polygon vertices will have a degree of 2
-             * Intersections will have a degree greater than that since the long segment will increase the number of edges incident to the vertex
-             */
-            for (auto vertex_it = arrangement.vertices_begin(); vertex_it != arrangement.vertices_end(); ++vertex_it) {
-                if (vertex_it->point() == converted_source) continue; // Skip the source of the ray since that's not an intersection
-                // Skip if edge or endpoint
-                if (vertex_it->degree() <= 2) continue;
+        /**
+         * @brief Closest boundary point reached by a constant-curvature trajectory, other than its origin.
+         *
+         * Curved trajectories are answered natively by @ref CompactBoundary::firstArcIntersection on
+         * the hierarchy, whichever index is selected; straight ones are answered as a @ref Ray2D.
+         *
+         * @param trajectory Trajectory starting on or inside the configuration space.
+         * @return First boundary hit along the trajectory, or `std::nullopt` if there is none.
+         */
+        std::optional<Point2D> firstIntersection(const ArcTrajectory& trajectory) const noexcept {
+            if (trajectory.isStraight()) return this->firstIntersection<Ray2D>(trajectory.ray());
+            tracing::Span span{"ConfigurationSpace::firstArcIntersection"};
+            return this->compact_boundary.firstArcIntersection(trajectory);
+        }
 
-                // Convert the vertex point back to a Point2D and return it as the intersection point
-                auto intersection_point = vertex_it->point();
-                Point2D to_add = convert_point<Point2D, decltype(intersection_point)>(intersection_point, numeric::sqrt_to_fscalar<decltype(intersection_point.x())>);
-                // Add the point to the output collection using the provided output iterator, given it is not the source of the ray and it lies on the ray path
-                if (to_add != ray_source && long_path.has_on(to_add)) {
-                    intersection_points = to_add;
-                    intersection_count++;
-                }
+        /**
+         * @brief Select the index serving segment queries.
+         *
+         * Selecting @ref BoundaryIndex::Grid builds a @ref BoundaryGrid over the compact boundary;
+         * selecting @ref BoundaryIndex::Hierarchy releases it. Results are identical either way.
+         * Select the index before sharing the configuration space between threads.
+         *
+         * @param index Index to use.
+         * @param cells_per_curve Grid density, ignored for the hierarchy.
+         */
+        void useBoundaryIndex(BoundaryIndex index, double cells_per_curve = BoundaryGrid::DEFAULT_CELLS_PER_CURVE) {
+            this->boundary_index = index;
+            this->grid_cells_per_curve = cells_per_curve;
+            if (index == BoundaryIndex::Grid) this->boundary_grid.emplace(this->compact_boundary, cells_per_curve);
+            else this->boundary_grid.reset();
+        }
+
+        /** @brief Index currently serving segment queries. */
+        BoundaryIndex boundaryIndex() const noexcept {
+            return this->boundary_index;
+        }
+
+        /**
+         * @brief Estimated footprint of the exact region, its compact boundary, and the boundary indices.
+         * @return Memory usage; the region's arrangement and exact numbers dominate for large layouts.
+         */
+        memory::MemoryUsage memoryUsage() const {
+            memory::MemoryUsage usage = memory::arrangement_usage(this->configuration_shape->arrangement());
+            usage += this->compact_boundary.memoryUsage();
+            if (this->boundary_grid) usage += this->boundary_grid->memoryUsage();
+            usage.structure += sizeof(*this) + sizeof(CurvilinearPolygonSet2D);
+            return usage;
+        }
+
+        /**
+         * @brief Copy of this configuration space moved by the rigid motion `transformation`.
+         *
+         * The boundary curves are mapped directly, so a layout placed at another position or
+         * orientation skips the offset and boolean operations of @ref WallSpace construction. The
+         * compact boundary and the selected index are rebuilt from the moved curves.
+         *
+         * @param transformation Rotation followed by a translation (see @ref is_rigid_motion); near-unit
+         *        rotations are normalised first (see @ref normalize_rigid_motion).
+         * @return Moved configuration space, or `nullptr` if `transformation` is not a rigid motion.
+         */
+        std::shared_ptr<ConfigurationSpace> transformed(const Transformation& transformation, const std::source_location location = std::source_location::current()) const {
+            tracing::Span span{"ConfigurationSpace::transformed"};
+            if (!is_rigid_motion(transformation)) {
+                burst_error("Cannot move a configuration space by a transformation that is not a rigid motion", location);
+                return nullptr;
             }
-            return intersection_count; // Return the number of intersections found
+            std::shared_ptr<ConfigurationSpace> moved = create(std::make_unique<CurvilinearPolygonSet2D>(transform_shape(*this->configuration_shape, normalize_rigid_motion(transformation))), location);
+            moved->useBoundaryIndex(this->boundary_index, this->grid_cells_per_curve);
+            return moved;
         }
 
         /** 
@@ -256,5 +543,15 @@ namespace BURST::geometry {
 
         friend class BURST::geometry::WallSpace; // For access to private constructor
     };
+
+#ifdef BURST_EXTERN_TEMPLATES
+    // The linear ray query used by the default movement model is instantiated once in the compiled BURST library (src/instantiations.cpp)
+    extern template size_t ConfigurationSpace::intersection<Ray2D, Segment2D, std::vector<Point2D>>(
+        const Ray2D&, std::back_insert_iterator<std::vector<Point2D>>, const Point2D&(Ray2D::*)() const, Vector2D(Ray2D::*)() const
+    ) const noexcept;
+    extern template std::optional<Point2D> ConfigurationSpace::firstIntersection<Ray2D>(
+        const Ray2D&, const Point2D&(Ray2D::*)() const, Vector2D(Ray2D::*)() const
+    ) const noexcept;
+#endif
  }
 #endif
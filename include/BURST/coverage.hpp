@@ -0,0 +1,408 @@
+#ifndef BURST_COVERAGE_HPP
+#define BURST_COVERAGE_HPP
+
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <queue>
+#include <map>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <source_location>
+
+#include <boost/container/small_vector.hpp>
+
+#include "geometry.hpp"
+#include "boundary.hpp"
+#include "measure.hpp"
+#include "configuration_space.hpp"
+#include "logging.hpp"
+#include "memory.hpp"
+
+/**
+ * @file coverage.hpp
+ * @brief Incremental coverage tracking over a @ref BURST::geometry::ConfigurationSpace: uncovered area and touched boundary.
+ */
+
+namespace BURST::geometry {
+
+    /**
+     * @brief One connected uncovered component of a configuration space.
+     */
+    struct UncoveredRegion {
+        /** @brief Exact component, possibly with holes where coverage lies inside it. */
+        HoledCurvilinearPolygon2D polygon;
+        /** @brief Double-precision area of the component. */
+        double area;
+        /** @brief Approximate point of the component farthest from its boundary (covered territory or walls). */
+        Point2D deepest;
+        /** @brief Approximate distance from @ref deepest to the boundary of the component. */
+        double clearance;
+    };
+
+    /**
+     * @brief Uncovered part of a configuration space, shrunk incrementally as coverage grows.
+     *
+     * Each covered shape (typically a @ref Robot::coveredArea result) is subtracted from the
+     * current uncovered set only, so a step costs one set difference against the remaining gaps
+     * instead of a union over everything covered so far. The connected uncovered components,
+     * ranked by area with their points of maximum clearance, are computed on request and cached
+     * until the next @ref add.
+     *
+     * Clearance points are found with a best-first subdivision of each component's bounding box
+     * (the "pole of inaccessibility"), using the approximate nearest-boundary search of a
+     * @ref CompactBoundary over the component.
+     */
+    class AreaCoverage {
+    public:
+        /** @brief Default clearance tolerance, relative to the larger side of a component's bounding box. */
+        static constexpr double DEFAULT_PRECISION = 1e-3;
+
+    private:
+        std::shared_ptr<const ConfigurationSpace> configuration_space;
+        CurvilinearPolygonSet2D uncovered;
+        double total_area;
+        mutable std::optional<std::vector<UncoveredRegion>> ranked_regions;
+        mutable double ranked_precision;
+
+        AreaCoverage(std::shared_ptr<const ConfigurationSpace> configuration_space) : configuration_space{std::move(configuration_space)}, uncovered{this->configuration_space->shape()}, total_area{this->configuration_space->approximateArea()}, ranked_regions{}, ranked_precision{DEFAULT_PRECISION} {}
+
+        // Square cell of the clearance search with the signed distance from its centre to the component boundary
+        struct Cell {
+            double x, y, half, distance;
+            double potential() const { return this->distance + this->half * std::sqrt(2.0); }
+        };
+
+        // Point of `polygon` approximately farthest from its boundary, to within `precision` (positive) of its bounding box
+        static std::pair<Point2D, double> deepestPoint(const HoledCurvilinearPolygon2D& polygon, double precision) {
+            CurvilinearPolygonSet2D region{polygon};
+            CompactBoundary boundary{region};
+            BoundingBox2D box = boundary.bbox();
+            double width = box.xmax() - box.xmin(), height = box.ymax() - box.ymin();
+            double side = std::min(width, height);
+            double scale = std::max(width, height);
+            // A degenerate box still needs a positive tolerance, or the subdivision never stops
+            double tolerance = (scale > 0.0 ? scale : 1.0) * precision;
+
+            auto make_cell = [&region, &boundary](double x, double y, double half) {
+                std::optional<ApproximateBoundaryPoint> nearest = boundary.approximateNearest(x, y);
+                double distance = nearest ? nearest->distance : 0.0;
+                auto orientation = region.oriented_side(CurvedTraits::Point_2{numeric::fscalar{x}, numeric::fscalar{y}});
+                return Cell{x, y, half, orientation == CGAL::ON_NEGATIVE_SIDE ? -distance : distance};
+            };
+            auto lower = [](const Cell& a, const Cell& b) { return a.potential() < b.potential(); };
+            std::priority_queue<Cell, std::vector<Cell>, decltype(lower)> queue{lower};
+
+            // Cover the bounding box with square cells of the shorter side
+            if (!(side > 0.0)) side = std::max({width, height, 1.0});
+            for (double x = box.xmin(); x < box.xmax(); x += side) {
+                for (double y = box.ymin(); y < box.ymax(); y += side) queue.push(make_cell(x + side / 2, y + side / 2, side / 2));
+            }
+            Cell best = make_cell((box.xmin() + box.xmax()) / 2, (box.ymin() + box.ymax()) / 2, 0.0);
+            while (!queue.empty()) {
+                Cell cell = queue.top();
+                queue.pop();
+                if (cell.distance > best.distance) best = cell;
+                // Subdivide only while the cell could still beat the best clearance by more than the tolerance
+                if (cell.potential() - best.distance <= tolerance) continue;
+                double half = cell.half / 2;
+                for (double dx : {-half, half}) {
+                    for (double dy : {-half, half}) queue.push(make_cell(cell.x + dx, cell.y + dy, half));
+                }
+            }
+            return {Point2D{best.x, best.y}, std::max(best.distance, 0.0)};
+        }
+
+    public:
+        /**
+         * @brief Start tracking coverage of `configuration_space`, with nothing covered yet.
+         * @param configuration_space Configuration space to cover.
+         * @return Tracker, or `std::nullopt` if `configuration_space` is null.
+         */
+        static std::optional<AreaCoverage> create(std::shared_ptr<const ConfigurationSpace> configuration_space, const std::source_location location = std::source_location::current()) {
+            if (!configuration_space) {
+                burst_error("Cannot track coverage without a configuration space", location);
+                return std::nullopt;
+            }
+            return AreaCoverage{std::move(configuration_space)};
+        }
+
+        /**
+         * @brief Mark `covered` as covered, subtracting it from the uncovered set.
+         * @param covered Covered region; parts outside the configuration space are ignored.
+         */
+        void add(const CurvilinearPolygonSet2D& covered) {
+            this->uncovered.difference(covered);
+            this->ranked_regions.reset();
+        }
+
+        /** @brief Configuration space being covered. */
+        const ConfigurationSpace& configurationSpace() const noexcept {
+            return *this->configuration_space;
+        }
+
+        /** @brief Exact uncovered part of the configuration space. */
+        const CurvilinearPolygonSet2D& uncoveredShape() const noexcept {
+            return this->uncovered;
+        }
+
+        /** @brief Double-precision area not yet covered. */
+        double uncoveredArea() const {
+            return area<double>(this->uncovered);
+        }
+
+        /** @brief Fraction of the configuration-space area covered so far, in [0, 1]. */
+        double coveredFraction() const {
+            if (!(this->total_area > 0.0)) return 0.0;
+            return std::clamp(1.0 - this->uncoveredArea() / this->total_area, 0.0, 1.0);
+        }
+
+        /**
+         * @brief Uncovered components, largest first, each with its point of maximum clearance.
+         *
+         * The result is cached until the next @ref add or a call with a different precision.
+         *
+         * @param precision Clearance tolerance relative to the larger side of each component's bounding box;
+         *                  a value that is not positive is reported and replaced by @ref DEFAULT_PRECISION.
+         * @return Components ranked by decreasing area; empty once everything is covered.
+         */
+        const std::vector<UncoveredRegion>& regions(double precision = DEFAULT_PRECISION, const std::source_location location = std::source_location::current()) const {
+            if (!(precision > 0.0)) {
+                burst_warning("Coverage precision must be positive, using the default precision", location);
+                precision = DEFAULT_PRECISION;
+            }
+            if (this->ranked_regions && this->ranked_precision == precision) return *this->ranked_regions;
+
+            boost::container::small_vector<HoledCurvilinearPolygon2D, 4> polygons;
+            this->uncovered.polygons_with_holes(std::back_inserter(polygons));
+            std::vector<UncoveredRegion> regions;
+            regions.reserve(polygons.size());
+            for (HoledCurvilinearPolygon2D& polygon : polygons) {
+                if (polygon.is_unbounded()) continue;
+                double region_area = area<double>(CurvilinearPolygonSet2D{polygon});
+                auto [deepest, clearance] = deepestPoint(polygon, precision);
+                regions.push_back(UncoveredRegion{std::move(polygon), region_area, deepest, clearance});
+            }
+            std::sort(regions.begin(), regions.end(), [](const UncoveredRegion& a, const UncoveredRegion& b) { return a.area > b.area; });
+
+            this->ranked_regions = std::move(regions);
+            this->ranked_precision = precision;
+            return *this->ranked_regions;
+        }
+
+        /**
+         * @brief Largest uncovered component.
+         * @param precision Clearance tolerance, as for @ref regions.
+         * @return Component with the largest area, or `std::nullopt` once everything is covered.
+         */
+        std::optional<UncoveredRegion> largest(double precision = DEFAULT_PRECISION, const std::source_location location = std::source_location::current()) const {
+            const std::vector<UncoveredRegion>& ranked = this->regions(precision, location);
+            if (ranked.empty()) return std::nullopt;
+            return ranked.front();
+        }
+
+        /**
+         * @brief Estimated footprint of the uncovered set and the cached ranked components.
+         *
+         * The configuration space is shared and not included; curves of the uncovered set that
+         * came from it still share its exact numbers, so their estimate is an upper bound.
+         */
+        memory::MemoryUsage memoryUsage() const {
+            memory::MemoryUsage usage = memory::arrangement_usage(this->uncovered.arrangement());
+            usage.structure += sizeof(*this);
+            if (!this->ranked_regions) return usage;
+            usage.structure += memory::container_bytes(*this->ranked_regions);
+            for (const UncoveredRegion& region : *this->ranked_regions) {
+                std::size_t curves = region.polygon.outer_boundary().size();
+                for (auto hole = region.polygon.holes_begin(); hole != region.polygon.holes_end(); ++hole) curves += hole->size();
+                usage.structure += curves * sizeof(CurvilinearPolygon2D::X_monotone_curve_2);
+                usage.exact += curves * (memory::EXACT_CURVE_BYTES + memory::EXACT_POINT_BYTES);
+            }
+            return usage;
+        }
+    };
+
+
+    /**
+     * @brief Touched portions of the configuration-space boundary, tracked as arc-length intervals.
+     *
+     * Every move of a @ref Robot ends on the boundary, so wall contact is a one-dimensional
+     * quantity: each contact marks an interval of width `contact_width` centred on the contact
+     * point, measured along its loop (outer wall or hole) and wrapping around the loop's start.
+     * Intervals are kept merged per loop, so an update is a boundary lookup plus a logarithmic
+     * insertion, and no polygon-set operation is ever needed.
+     */
+    class BoundaryCoverage {
+    private:
+        std::shared_ptr<const ConfigurationSpace> configuration_space;
+        double contact_width;
+        // Arc length from the start of its loop to the source of each curve, walking the loop's curves in order
+        std::vector<double> curve_offsets;
+        std::vector<double> loop_lengths;
+        // Disjoint touched intervals of each loop, keyed by start, and their total length
+        std::vector<std::map<double, double>> touched_intervals;
+        std::vector<double> touched_lengths;
+
+        BoundaryCoverage(std::shared_ptr<const ConfigurationSpace> configuration_space, double contact_width) : configuration_space{std::move(configuration_space)}, contact_width{contact_width} {
+            const CompactBoundary& boundary = this->configuration_space->boundary();
+            this->curve_offsets.assign(boundary.size(), 0.0);
+            this->loop_lengths.assign(boundary.loops(), 0.0);
+            this->touched_intervals.resize(boundary.loops());
+            this->touched_lengths.assign(boundary.loops(), 0.0);
+
+            // Walk each loop once from the first of its curves in storage order
+            std::vector<bool> visited(boundary.size(), false);
+            for (std::size_t first = 0; first < boundary.size(); ++first) {
+                if (visited[first]) continue;
+                double offset = 0.0;
+                std::size_t curve = first;
+                do {
+                    visited[curve] = true;
+                    this->curve_offsets[curve] = offset;
+                    offset += boundary.length(curve);
+                    curve = boundary.next(curve);
+                } while (curve != first && !visited[curve]);
+                this->loop_lengths[boundary.loop(first)] = offset;
+            }
+        }
+
+        // Merge [start, end) into the touched intervals of `loop`
+        void insert(std::size_t loop, double start, double end) {
+            std::map<double, double>& intervals = this->touched_intervals[loop];
+            auto it = intervals.upper_bound(start);
+            if (it != intervals.begin() && std::prev(it)->second >= start) --it;
+            if (it != intervals.end() && it->first < start) start = it->first;
+            while (it != intervals.end() && it->first <= end) {
+                end = std::max(end, it->second);
+                this->touched_lengths[loop] -= it->second - it->first;
+                it = intervals.erase(it);
+            }
+            intervals.emplace(start, end);
+            this->touched_lengths[loop] += end - start;
+        }
+
+    public:
+        /**
+         * @brief Start tracking boundary contact on `configuration_space`, with nothing touched yet.
+         * @param configuration_space Configuration space whose boundary is tracked.
+         * @param contact_width Arc length marked as touched around each contact point (e.g. the robot's diameter).
+         * @return Tracker, or `std::nullopt` if `configuration_space` is null or `contact_width` is not positive.
+         */
+        static std::optional<BoundaryCoverage> create(std::shared_ptr<const ConfigurationSpace> configuration_space, double contact_width, const std::source_location location = std::source_location::current()) {
+            if (!configuration_space) {
+                burst_error("Cannot track boundary coverage without a configuration space", location);
+                return std::nullopt;
+            }
+            if (!(contact_width > 0.0)) {
+                burst_error("Cannot track boundary coverage with a non-positive contact width", location);
+                return std::nullopt;
+            }
+            return BoundaryCoverage{std::move(configuration_space), contact_width};
+        }
+
+        /**
+         * @brief Record a contact at `point`, typically a robot's position after a move.
+         * @param point Point on the configuration-space boundary.
+         * @return `false` (and nothing recorded) if `point` is not on the boundary.
+         */
+        bool touch(const Point2D& point, const std::source_location location = std::source_location::current()) {
+            const CompactBoundary& boundary = this->configuration_space->boundary();
+            std::optional<std::size_t> curve = boundary.locate(point);
+            if (!curve) {
+                burst_error("Cannot record boundary contact at a point not on the configuration space boundary", location);
+                return false;
+            }
+            std::size_t loop = boundary.loop(*curve);
+            double length = this->loop_lengths[loop];
+            if (this->contact_width >= length) {
+                this->insert(loop, 0.0, length);
+                return true;
+            }
+
+            double center = this->curve_offsets[*curve] + boundary.offsetOnCurve(*curve, point);
+            double start = center - this->contact_width / 2, end = center + this->contact_width / 2;
+            // Intervals crossing the start of the loop are split at it
+            if (start < 0.0) {
+                this->insert(loop, start + length, length);
+                this->insert(loop, 0.0, end);
+            } else if (end > length) {
+                this->insert(loop, start, length);
+                this->insert(loop, 0.0, end - length);
+            } else {
+                this->insert(loop, start, end);
+            }
+            return true;
+        }
+
+        /** @brief Configuration space whose boundary is tracked. */
+        const ConfigurationSpace& configurationSpace() const noexcept {
+            return *this->configuration_space;
+        }
+
+        /** @brief Arc length marked around each contact. */
+        double contactWidth() const noexcept {
+            return this->contact_width;
+        }
+
+        /** @brief Number of boundary loops (outer walls and holes). */
+        std::size_t loops() const noexcept {
+            return this->loop_lengths.size();
+        }
+
+        /** @brief Whether `loop` is the boundary of a hole. */
+        bool isHole(std::size_t loop) const {
+            return this->configuration_space->boundary().isHole(loop);
+        }
+
+        /** @brief Approximate length of `loop`. */
+        double loopLength(std::size_t loop) const {
+            return this->loop_lengths[loop];
+        }
+
+        /** @brief Touched arc length of `loop`. */
+        double touchedLength(std::size_t loop) const {
+            return this->touched_lengths[loop];
+        }
+
+        /** @brief Disjoint touched intervals of `loop` as (start, end) arc lengths from the start of the loop, in order. */
+        const std::map<double, double>& touchedIntervals(std::size_t loop) const {
+            return this->touched_intervals[loop];
+        }
+
+        /** @brief Fraction of `loop` touched so far, in [0, 1]. */
+        double touchedFraction(std::size_t loop) const {
+            if (!(this->loop_lengths[loop] > 0.0)) return 0.0;
+            return std::min(this->touched_lengths[loop] / this->loop_lengths[loop], 1.0);
+        }
+
+        /** @brief Fraction of the whole boundary touched so far, in [0, 1]. */
+        double touchedFraction() const {
+            double touched = 0.0, total = 0.0;
+            for (std::size_t loop = 0; loop < this->loops(); ++loop) {
+                touched += this->touched_lengths[loop];
+                total += this->loop_lengths[loop];
+            }
+            return total > 0.0 ? std::min(touched / total, 1.0) : 0.0;
+        }
+
+        /** @brief Touched fraction of every loop, indexed by loop. */
+        std::vector<double> touchedFractions() const {
+            std::vector<double> fractions(this->loops());
+            for (std::size_t loop = 0; loop < this->loops(); ++loop) fractions[loop] = this->touchedFraction(loop);
+            return fractions;
+        }
+
+        /** @brief Footprint of the loop offsets and touched intervals; the shared configuration space is not included. */
+        memory::MemoryUsage memoryUsage() const {
+            std::size_t bytes = sizeof(*this) + memory::container_bytes(this->curve_offsets) + memory::container_bytes(this->loop_lengths)
+                              + memory::container_bytes(this->touched_intervals) + memory::container_bytes(this->touched_lengths);
+            for (const std::map<double, double>& intervals : this->touched_intervals) bytes += memory::container_bytes(intervals);
+            return memory::MemoryUsage{bytes, 0, 0};
+        }
+    };
+
+}
+
+#endif
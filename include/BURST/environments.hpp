@@ -0,0 +1,427 @@
+#ifndef BURST_ENVIRONMENTS_HPP
+#define BURST_ENVIRONMENTS_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include <source_location>
+
+#include "geometry.hpp"
+#include "wall_space.hpp"
+#include "logging.hpp"
+
+/**
+ * @file environments.hpp
+ * @brief Seeded procedural generators for large @ref geometry::WallSpace fixtures.
+ *
+ * Each generator first produces a @ref environments::Layout (outer ring plus hole polygons) and can
+ * then build the validated @ref geometry::WallSpace from it. Generators are deterministic for a
+ * given seed and parameter set with the same toolchain and math library: they draw from
+ * `std::mt19937_64` directly instead of the implementation-defined standard distributions, and
+ * every coordinate is snapped to a dyadic grid so the exact kernel works with short rationals.
+ * Angles and log-uniform sizes still go through `std::cos`, `std::sin`, `std::exp` and `std::log`,
+ * which are not required to be correctly rounded. Another libm can therefore move a value across
+ * a snapping boundary and change a coordinate, so store layouts (see experiment.hpp) rather than
+ * regenerating them when runs must match across machines.
+ */
+
+namespace BURST::environments {
+
+    /** @brief Shape of the distribution hole sizes are drawn from. */
+    enum class SizeDistribution {
+        Uniform,    /**< Sizes uniform in `[min_size, max_size]`. */
+        LogUniform  /**< Sizes log-uniform in `[min_size, max_size]`, favouring small obstacles. */
+    };
+
+    /** @brief Distribution of hole (obstacle) diameters. */
+    struct HoleSizes {
+        double min_size = 1.0;
+        double max_size = 3.0;
+        SizeDistribution distribution = SizeDistribution::Uniform;
+    };
+
+    /**
+     * @brief Parameters for a random star-shaped room with polygonal obstacles.
+     *
+     * The outer ring has `vertex_count` vertices at jittered angles around the origin with radii in
+     * `[(1 - non_convexity) * radius, radius]`, so `non_convexity = 0` yields a convex polygon.
+     * `hole_count` regular-polygon obstacles are scattered inside, keeping at least `corridor_width`
+     * of clearance to the walls and to each other.
+     */
+    struct StarParameters {
+        size_t vertex_count = 32;
+        double radius = 50.0;
+        double non_convexity = 0.3;
+        size_t hole_count = 0;
+        HoleSizes hole_sizes{};
+        double corridor_width = 2.0;
+    };
+
+    /**
+     * @brief Parameters for a grid of square rooms separated by interior walls with doors.
+     *
+     * Interior walls are `wall_thickness` thick and stop `corridor_width / 2` short of every wall
+     * junction; each wall additionally gets a door of width `corridor_width` with probability
+     * `door_probability`, placed at a random offset along it.
+     */
+    struct FloorPlanParameters {
+        size_t rows = 3;
+        size_t columns = 3;
+        double room_size = 20.0;
+        double wall_thickness = 1.0;
+        double corridor_width = 4.0;
+        double door_probability = 1.0;
+    };
+
+    /**
+     * @brief Parameters for a warehouse: shelf rows, scattered clutter, and loading bays.
+     *
+     * `shelf_rows` rows of `shelves_per_row` shelves fill a `width` x `height` hall with aisles of at
+     * least `corridor_width`. `clutter_count` extra obstacles drawn from `clutter_sizes` are scattered
+     * through the aisles with `corridor_width` clearance, and `bay_count` rectangular loading bays of
+     * depth `non_convexity * height / 4` are cut into the bottom wall.
+     */
+    struct WarehouseParameters {
+        double width = 100.0;
+        double height = 60.0;
+        size_t shelf_rows = 4;
+        size_t shelves_per_row = 5;
+        double shelf_depth = 2.0;
+        double corridor_width = 4.0;
+        size_t clutter_count = 0;
+        HoleSizes clutter_sizes{0.5, 1.5, SizeDistribution::Uniform};
+        size_t bay_count = 0;
+        double non_convexity = 0.2;
+    };
+
+    /** @brief Raw generated geometry: the counterclockwise outer ring and the hole polygons. */
+    struct Layout {
+        std::vector<geometry::Point2D> outer;
+        std::vector<geometry::Polygon2D> holes;
+    };
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        constexpr double PI = 3.14159265358979323846;
+        // Coordinates are snapped to multiples of 2^-SNAP_BITS so they stay short dyadic rationals
+        constexpr int SNAP_BITS = 10;
+        // Rejection sampling budget per requested obstacle before giving up on placing it
+        constexpr size_t PLACEMENT_ATTEMPTS = 200;
+
+        inline double snap(double value) {
+            return std::ldexp(std::round(std::ldexp(value, SNAP_BITS)), -SNAP_BITS);
+        }
+
+        // Portable uniform sampling on top of the standardized mt19937_64 output sequence
+        class Random {
+        private:
+            std::mt19937_64 engine;
+
+        public:
+            explicit Random(std::uint64_t seed) : engine{seed} {}
+
+            // Uniform in [0, 1) with 53 random bits
+            double unit() {
+                return static_cast<double>(this->engine() >> 11) * 0x1.0p-53;
+            }
+            double uniform(double lo, double hi) {
+                return lo + (hi - lo) * this->unit();
+            }
+            size_t index(size_t count) {
+                return static_cast<size_t>(this->unit() * static_cast<double>(count));
+            }
+            double size(const HoleSizes& sizes) {
+                double lo = std::min(sizes.min_size, sizes.max_size);
+                double hi = std::max(sizes.min_size, sizes.max_size);
+                if (sizes.distribution == SizeDistribution::LogUniform && lo > 0) return std::exp(this->uniform(std::log(lo), std::log(hi)));
+                return this->uniform(lo, hi);
+            }
+        };
+
+        inline geometry::Point2D snapped_point(double x, double y) {
+            return geometry::Point2D{snap(x), snap(y)};
+        }
+
+        // Counterclockwise axis-aligned rectangle
+        inline geometry::Polygon2D rectangle(double x0, double y0, double x1, double y1) {
+            geometry::Polygon2D polygon;
+            polygon.push_back(snapped_point(x0, y0));
+            polygon.push_back(snapped_point(x1, y0));
+            polygon.push_back(snapped_point(x1, y1));
+            polygon.push_back(snapped_point(x0, y1));
+            return polygon;
+        }
+
+        // Regular `sides`-gon centred at (cx, cy) with the given circumradius and rotation
+        inline geometry::Polygon2D regular_polygon(double cx, double cy, double circumradius, size_t sides, double rotation) {
+            geometry::Polygon2D polygon;
+            for (size_t i = 0; i < sides; ++i) {
+                double angle = rotation + 2 * PI * static_cast<double>(i) / static_cast<double>(sides);
+                polygon.push_back(snapped_point(cx + circumradius * std::cos(angle), cy + circumradius * std::sin(angle)));
+            }
+            return polygon;
+        }
+
+        // Distance from the origin to the segment ab
+        inline double origin_segment_distance(double ax, double ay, double bx, double by) {
+            double dx = bx - ax;
+            double dy = by - ay;
+            double length_squared = dx * dx + dy * dy;
+            double t = length_squared > 0 ? std::clamp(-(ax * dx + ay * dy) / length_squared, 0.0, 1.0) : 0.0;
+            return std::hypot(ax + t * dx, ay + t * dy);
+        }
+
+        // Axis-aligned box used for clearance checks while scattering obstacles
+        struct Box {
+            double xmin, ymin, xmax, ymax;
+
+            double gap(const Box& other) const {
+                double dx = std::max({0.0, other.xmin - this->xmax, this->xmin - other.xmax});
+                double dy = std::max({0.0, other.ymin - this->ymax, this->ymin - other.ymax});
+                return std::hypot(dx, dy);
+            }
+        };
+    }
+
+    /**
+     * @brief Generate a star-shaped room with scattered regular-polygon obstacles.
+     *
+     * Holes that cannot be placed within the rejection-sampling budget are dropped with a warning,
+     * so the returned layout may contain fewer than `hole_count` holes for crowded parameters.
+     *
+     * @param parameters Shape parameters; `vertex_count` must be at least 3.
+     * @param seed Seed making the layout reproducible.
+     * @return Generated layout (empty outer ring if the parameters are invalid).
+     */
+    inline Layout star_layout(const StarParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        Layout layout;
+        if (parameters.vertex_count < 3 || parameters.radius <= 0) {
+            burst_error("Star layout needs at least 3 vertices and a positive radius", location);
+            return layout;
+        }
+        detail::Random random{seed};
+        double non_convexity = std::clamp(parameters.non_convexity, 0.0, 0.95);
+
+        // Jitter each vertex angle by a fifth of its sector, so angles stay strictly increasing and every gap stays below pi
+        // The ring is then star-shaped about the origin and therefore simple
+        std::vector<double> xs, ys;
+        double sector = 2 * detail::PI / static_cast<double>(parameters.vertex_count);
+        for (size_t i = 0; i < parameters.vertex_count; ++i) {
+            double angle = sector * (static_cast<double>(i) + 0.2 * random.uniform(-1.0, 1.0));
+            double radius = parameters.radius * (1.0 - non_convexity * random.unit());
+            xs.push_back(detail::snap(radius * std::cos(angle)));
+            ys.push_back(detail::snap(radius * std::sin(angle)));
+            layout.outer.emplace_back(xs.back(), ys.back());
+        }
+
+        // The disc about the origin up to the nearest edge is free for obstacles
+        double free_radius = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < xs.size(); ++i) {
+            size_t next = (i + 1) % xs.size();
+            free_radius = std::min(free_radius, detail::origin_segment_distance(xs[i], ys[i], xs[next], ys[next]));
+        }
+
+        // Scatter obstacles with rejection sampling against the free disc and the already placed obstacles
+        std::vector<std::pair<std::array<double, 2>, double>> placed;
+        for (size_t hole = 0; hole < parameters.hole_count; ++hole) {
+            bool placed_hole = false;
+            for (size_t attempt = 0; attempt < detail::PLACEMENT_ATTEMPTS && !placed_hole; ++attempt) {
+                double circumradius = random.size(parameters.hole_sizes) / 2;
+                double max_offset = free_radius - parameters.corridor_width - circumradius;
+                if (max_offset <= 0) continue;
+                double angle = random.uniform(0, 2 * detail::PI);
+                double offset = max_offset * std::sqrt(random.unit());
+                double cx = offset * std::cos(angle);
+                double cy = offset * std::sin(angle);
+
+                bool clear = std::all_of(placed.begin(), placed.end(), [&](const auto& other) {
+                    return std::hypot(cx - other.first[0], cy - other.first[1]) >= circumradius + other.second + parameters.corridor_width;
+                });
+                if (!clear) continue;
+
+                size_t sides = 3 + random.index(6);
+                layout.holes.push_back(detail::regular_polygon(cx, cy, circumradius, sides, random.uniform(0, 2 * detail::PI)));
+                placed.push_back({{cx, cy}, circumradius});
+                placed_hole = true;
+            }
+            if (!placed_hole) {
+                burst_warning("Could not place every requested hole in the star layout, generating fewer holes", location);
+                break;
+            }
+        }
+        return layout;
+    }
+
+    /**
+     * @brief Generate a grid of rooms whose interior walls are holes with doors and junction gaps.
+     * @return Generated layout (empty outer ring if the parameters are invalid).
+     */
+    inline Layout floor_plan_layout(const FloorPlanParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        Layout layout;
+        double half_thickness = parameters.wall_thickness / 2;
+        // Each wall piece must survive the junction gaps and the door
+        // Junction gaps only stay open when the corridor is wider than the walls
+        if (parameters.rows == 0 || parameters.columns == 0 || parameters.wall_thickness <= 0 || parameters.corridor_width <= parameters.wall_thickness ||
+            parameters.room_size <= 2 * parameters.corridor_width + parameters.wall_thickness) {
+            burst_error("Floor plan corridors must be wider than the walls, and rooms larger than two corridor widths plus the wall thickness", location);
+            return layout;
+        }
+        detail::Random random{seed};
+        double width = parameters.room_size * static_cast<double>(parameters.columns);
+        double height = parameters.room_size * static_cast<double>(parameters.rows);
+        layout.outer = {detail::snapped_point(0, 0), detail::snapped_point(width, 0), detail::snapped_point(width, height), detail::snapped_point(0, height)};
+
+        // Usable wall length between the two junction gaps
+        double gap = parameters.corridor_width / 2;
+        double span = parameters.room_size - 2 * gap;
+        auto add_wall = [&](bool vertical, double fixed, double start) {
+            auto piece = [&](double from, double to) {
+                // Skip pieces that a door pushed against a junction gap, since they would snap to nothing
+                if (detail::snap(to) - detail::snap(from) <= 0) return;
+                if (vertical) layout.holes.push_back(detail::rectangle(fixed - half_thickness, from, fixed + half_thickness, to));
+                else layout.holes.push_back(detail::rectangle(from, fixed - half_thickness, to, fixed + half_thickness));
+            };
+            double from = start + gap;
+            double to = start + gap + span;
+            if (random.unit() < parameters.door_probability) {
+                double door_start = from + random.uniform(0, span - parameters.corridor_width);
+                piece(from, door_start);
+                piece(door_start + parameters.corridor_width, to);
+            } else {
+                piece(from, to);
+            }
+        };
+
+        // Vertical walls between horizontally adjacent rooms, then horizontal walls between vertically adjacent rooms
+        for (size_t column = 1; column < parameters.columns; ++column) {
+            for (size_t row = 0; row < parameters.rows; ++row) add_wall(true, parameters.room_size * static_cast<double>(column), parameters.room_size * static_cast<double>(row));
+        }
+        for (size_t row = 1; row < parameters.rows; ++row) {
+            for (size_t column = 0; column < parameters.columns; ++column) add_wall(false, parameters.room_size * static_cast<double>(row), parameters.room_size * static_cast<double>(column));
+        }
+        return layout;
+    }
+
+    /**
+     * @brief Generate a warehouse hall with shelf rows, clutter in the aisles, and loading bays.
+     *
+     * Clutter that cannot be placed within the rejection-sampling budget is dropped with a warning.
+     *
+     * @return Generated layout (empty outer ring if the shelves do not fit with the requested aisles).
+     */
+    inline Layout warehouse_layout(const WarehouseParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        Layout layout;
+        double corridor = parameters.corridor_width;
+        double shelf_length = parameters.shelves_per_row == 0 ? 0 : (parameters.width - static_cast<double>(parameters.shelves_per_row + 1) * corridor) / static_cast<double>(parameters.shelves_per_row);
+        double aisle = (parameters.height - static_cast<double>(parameters.shelf_rows) * parameters.shelf_depth) / static_cast<double>(parameters.shelf_rows + 1);
+        if (parameters.width <= 0 || parameters.height <= 0 || corridor <= 0 || (parameters.shelves_per_row > 0 && parameters.shelf_rows > 0 && (shelf_length <= 0 || aisle < corridor))) {
+            burst_error("Warehouse shelves do not fit in the hall with the requested corridor width", location);
+            return layout;
+        }
+        detail::Random random{seed};
+
+        // Outer hall, counterclockwise, with loading bays cut outwards from the bottom wall
+        double bay_depth = detail::snap(std::clamp(parameters.non_convexity, 0.0, 1.0) * parameters.height / 4);
+        double bay_pitch = parameters.width / static_cast<double>(parameters.bay_count + 1);
+        double bay_width = std::min(bay_pitch / 2, 2 * corridor);
+        layout.outer.push_back(detail::snapped_point(0, 0));
+        if (bay_depth > 0) {
+            for (size_t bay = 1; bay <= parameters.bay_count; ++bay) {
+                double centre = bay_pitch * static_cast<double>(bay);
+                layout.outer.push_back(detail::snapped_point(centre - bay_width / 2, 0));
+                layout.outer.push_back(detail::snapped_point(centre - bay_width / 2, -bay_depth));
+                layout.outer.push_back(detail::snapped_point(centre + bay_width / 2, -bay_depth));
+                layout.outer.push_back(detail::snapped_point(centre + bay_width / 2, 0));
+            }
+        }
+        layout.outer.push_back(detail::snapped_point(parameters.width, 0));
+        layout.outer.push_back(detail::snapped_point(parameters.width, parameters.height));
+        layout.outer.push_back(detail::snapped_point(0, parameters.height));
+
+        // Shelves are evenly spaced; their boxes seed the clearance checks for clutter
+        std::vector<detail::Box> obstacles;
+        if (parameters.shelves_per_row > 0) {
+            for (size_t row = 0; row < parameters.shelf_rows; ++row) {
+                double y0 = aisle * static_cast<double>(row + 1) + parameters.shelf_depth * static_cast<double>(row);
+                for (size_t shelf = 0; shelf < parameters.shelves_per_row; ++shelf) {
+                    double x0 = corridor * static_cast<double>(shelf + 1) + shelf_length * static_cast<double>(shelf);
+                    layout.holes.push_back(detail::rectangle(x0, y0, x0 + shelf_length, y0 + parameters.shelf_depth));
+                    obstacles.push_back({x0, y0, x0 + shelf_length, y0 + parameters.shelf_depth});
+                }
+            }
+        }
+
+        // Scatter square clutter (pallets, boxes) keeping a corridor of clearance to walls, shelves, and each other
+        for (size_t item = 0; item < parameters.clutter_count; ++item) {
+            bool placed = false;
+            for (size_t attempt = 0; attempt < detail::PLACEMENT_ATTEMPTS && !placed; ++attempt) {
+                double half = random.size(parameters.clutter_sizes) / 2;
+                double margin = corridor + half;
+                if (parameters.width <= 2 * margin || parameters.height <= 2 * margin) break;
+                double cx = random.uniform(margin, parameters.width - margin);
+                double cy = random.uniform(margin, parameters.height - margin);
+                detail::Box box{cx - half, cy - half, cx + half, cy + half};
+                bool clear = std::all_of(obstacles.begin(), obstacles.end(), [&](const detail::Box& other) {
+                    return box.gap(other) >= corridor;
+                });
+                if (!clear) continue;
+
+                layout.holes.push_back(detail::rectangle(box.xmin, box.ymin, box.xmax, box.ymax));
+                obstacles.push_back(box);
+                placed = true;
+            }
+            if (!placed) {
+                burst_warning("Could not place every requested clutter obstacle in the warehouse layout, generating fewer obstacles", location);
+                break;
+            }
+        }
+        return layout;
+    }
+
+    /**
+     * @brief Validate `layout` and build its @ref geometry::WallSpace.
+     * @return Wall space if the layout is valid, `std::nullopt` otherwise.
+     */
+    inline std::optional<geometry::WallSpace> build(const Layout& layout, const std::source_location location = std::source_location::current()) {
+        if (layout.outer.size() < 3) {
+            burst_error("Generated layout has no outer boundary, can't create a wall geometry", location);
+            return std::nullopt;
+        }
+        if (layout.holes.empty()) return geometry::WallSpace::create(layout.outer, location);
+        return geometry::WallSpace::create(layout.outer, layout.holes, location);
+    }
+
+    /**
+     * @brief Generate and build a star-shaped room (see @ref star_layout).
+     * @return Wall space if generation succeeds, `std::nullopt` otherwise.
+     */
+    inline std::optional<geometry::WallSpace> star_room(const StarParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        return build(star_layout(parameters, seed, location), location);
+    }
+
+    /**
+     * @brief Generate and build a grid floor plan (see @ref floor_plan_layout).
+     * @return Wall space if generation succeeds, `std::nullopt` otherwise.
+     */
+    inline std::optional<geometry::WallSpace> floor_plan(const FloorPlanParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        return build(floor_plan_layout(parameters, seed, location), location);
+    }
+
+    /**
+     * @brief Generate and build a cluttered warehouse (see @ref warehouse_layout).
+     * @return Wall space if generation succeeds, `std::nullopt` otherwise.
+     */
+    inline std::optional<geometry::WallSpace> warehouse(const WarehouseParameters& parameters, std::uint64_t seed, const std::source_location location = std::source_location::current()) {
+        return build(warehouse_layout(parameters, seed, location), location);
+    }
+
+}
+
+#endif
@@ -0,0 +1,579 @@
+#ifndef BURST_EXPERIMENT_HPP
+#define BURST_EXPERIMENT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <source_location>
+
+#include "geometry.hpp"
+#include "numeric.hpp"
+#include "wall_space.hpp"
+#include "environments.hpp"
+#include "configuration_space.hpp"
+#include "logging.hpp"
+#include "tracing.hpp"
+
+/**
+ * @file experiment.hpp
+ * @brief Sharded experiment runs across processes: environment files, per-shard binary results, and merging.
+ *
+ * An experiment is a fixed number of runs, identified by index, over one environment. Independent
+ * processes (on one host or on several sharing a filesystem) each load the same environment file,
+ * execute the runs of their @ref experiments::Shard, and write a result file. @ref experiments::merge_results
+ * combines the shard files into one dataset ordered by run index, so the merged bytes do not depend
+ * on how many shards there were or in which order they finished. Runs that draw random numbers
+ * should seed from @ref experiments::run_seed so their results do not depend on the shard either.
+ *
+ * Both file formats are little-endian on every platform.
+ */
+
+namespace BURST::experiments {
+
+    /** @brief Version written to, and required of, environment and result files. */
+    constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        constexpr std::array<char, 8> ENVIRONMENT_MAGIC{'B', 'U', 'R', 'S', 'T', 'E', 'N', 'V'};
+        constexpr std::array<char, 8> RESULTS_MAGIC{'B', 'U', 'R', 'S', 'T', 'R', 'E', 'S'};
+        // Refuse counts beyond this when reading, so a corrupt header cannot request huge allocations
+        constexpr std::uint64_t MAX_COUNT = std::uint64_t{1} << 40;
+        constexpr std::uint32_t MAX_VALUES = std::uint32_t{1} << 16;
+
+        inline void write_u64(std::ostream& stream, std::uint64_t value) {
+            std::array<char, 8> bytes;
+            for (std::size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+            stream.write(bytes.data(), bytes.size());
+        }
+        inline void write_u32(std::ostream& stream, std::uint32_t value) {
+            std::array<char, 4> bytes;
+            for (std::size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+            stream.write(bytes.data(), bytes.size());
+        }
+        inline void write_double(std::ostream& stream, double value) {
+            write_u64(stream, std::bit_cast<std::uint64_t>(value));
+        }
+
+        inline std::optional<std::uint64_t> read_u64(std::istream& stream) {
+            std::array<char, 8> bytes;
+            if (!stream.read(bytes.data(), bytes.size())) return std::nullopt;
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < bytes.size(); ++i) value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+            return value;
+        }
+        inline std::optional<std::uint32_t> read_u32(std::istream& stream) {
+            std::array<char, 4> bytes;
+            if (!stream.read(bytes.data(), bytes.size())) return std::nullopt;
+            std::uint32_t value = 0;
+            for (std::size_t i = 0; i < bytes.size(); ++i) value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+            return value;
+        }
+        inline std::optional<double> read_double(std::istream& stream) {
+            std::optional<std::uint64_t> bits = read_u64(stream);
+            if (!bits) return std::nullopt;
+            return std::bit_cast<double>(*bits);
+        }
+
+        // Bytes left in a seekable stream, or std::nullopt when the stream cannot tell
+        inline std::optional<std::uint64_t> remaining_bytes(std::istream& stream) {
+            std::istream::pos_type here = stream.tellg();
+            if (here == std::istream::pos_type(-1)) return std::nullopt;
+            stream.seekg(0, std::ios::end);
+            std::istream::pos_type end = stream.tellg();
+            stream.seekg(here);
+            if (end == std::istream::pos_type(-1) || !stream || end < here) {
+                stream.clear();
+                stream.seekg(here);
+                return std::nullopt;
+            }
+            return static_cast<std::uint64_t>(end - here);
+        }
+
+        // Read and check the magic and version of a file
+        inline bool read_preamble(std::istream& stream, const std::array<char, 8>& magic) {
+            std::array<char, 8> found;
+            if (!stream.read(found.data(), found.size()) || found != magic) return false;
+            std::optional<std::uint32_t> version = read_u32(stream);
+            return version && *version == FORMAT_VERSION;
+        }
+
+        // The one caller outside the cache allowed to construct configuration spaces from walls directly
+        struct EnvironmentAccess {
+            static std::shared_ptr<geometry::ConfigurationSpace> configurationSpace(const geometry::WallSpace& walls, const numeric::fscalar& radius, const std::source_location& location) {
+                return walls.constructConfigurationSpace(radius, location);
+            }
+        };
+
+        // Exact double value of `value`, if it has one
+        inline std::optional<double> exact_double(const numeric::fscalar& value) {
+            double approximation = CGAL::to_double(value);
+            if (numeric::fscalar{approximation} != value) return std::nullopt;
+            return approximation;
+        }
+
+        // Write through a temporary sibling file that is renamed into place, so readers on a shared filesystem never see partial files
+        template <typename Writer>
+        bool write_atomically(const std::filesystem::path& path, Writer&& writer) {
+            std::filesystem::path temporary = path;
+            temporary += ".partial";
+            {
+                std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+                if (file && writer(file)) file.flush();
+                else file.setstate(std::ios::failbit);
+                if (!file) {
+                    file.close();
+                    std::error_code ignored;
+                    std::filesystem::remove(temporary, ignored);
+                    return false;
+                }
+            }
+            std::error_code error;
+            std::filesystem::rename(temporary, path, error);
+            if (error) std::filesystem::remove(temporary, error);
+            return !error;
+        }
+    }
+
+    /**
+     * @brief One of `count` disjoint slices of an experiment's runs.
+     *
+     * Run `r` belongs to shard `r % count`. Striding rather than cutting contiguous blocks keeps
+     * shards balanced when run cost drifts with the index, as in parameter sweeps.
+     */
+    struct Shard {
+        std::size_t index = 0;  ///< Shard number, below `count`
+        std::size_t count = 1;  ///< Number of shards
+
+        /**
+         * @brief Shard `index` of `count`.
+         * @return Shard, or `std::nullopt` if `count` is zero or `index` is not below it.
+         */
+        static std::optional<Shard> create(std::size_t index, std::size_t count, const std::source_location location = std::source_location::current()) {
+            if (count == 0 || index >= count) {
+                burst_error("Shard index must be below a nonzero shard count", location);
+                return std::nullopt;
+            }
+            return Shard{index, count};
+        }
+        /**
+         * @brief Parse a shard given as `"index/count"`, e.g. from a command line.
+         * @return Shard, or `std::nullopt` if `text` is malformed or out of range.
+         */
+        static std::optional<Shard> parse(std::string_view text, const std::source_location location = std::source_location::current()) {
+            std::size_t slash = text.find('/');
+            std::size_t index = 0;
+            std::size_t count = 0;
+            if (slash == std::string_view::npos) {
+                burst_error("Shard must be given as index/count", location);
+                return std::nullopt;
+            }
+            auto [index_end, index_error] = std::from_chars(text.data(), text.data() + slash, index);
+            auto [count_end, count_error] = std::from_chars(text.data() + slash + 1, text.data() + text.size(), count);
+            if (index_error != std::errc{} || count_error != std::errc{} || index_end != text.data() + slash || count_end != text.data() + text.size()) {
+                burst_error("Shard must be given as index/count", location);
+                return std::nullopt;
+            }
+            return create(index, count, location);
+        }
+
+        /** @brief Whether run `run` belongs to this shard. */
+        bool owns(std::size_t run) const noexcept {
+            return run % this->count == this->index;
+        }
+        /** @brief Number of runs of an experiment with `runs` runs that belong to this shard. */
+        std::size_t size(std::size_t runs) const noexcept {
+            return runs / this->count + (this->index < runs % this->count ? 1 : 0);
+        }
+    };
+
+    /**
+     * @brief Seed for run `run` of an experiment seeded with `seed`, the same in every shard.
+     * @return Well-mixed 64-bit seed.
+     */
+    constexpr std::uint64_t run_seed(std::uint64_t seed, std::uint64_t run) noexcept {
+        return numeric::splitmix64(seed + 0x9E3779B97F4A7C15ULL * (run + 1));
+    }
+
+    /** @brief Environment shared by all runs: the layout, the robot radius, and its configuration space. */
+    struct Environment {
+        environments::Layout layout;                                        ///< Wall layout
+        numeric::fscalar radius;                                            ///< Robot radius
+        std::shared_ptr<geometry::ConfigurationSpace> configuration_space;  ///< Configuration space of `layout` for `radius`
+    };
+
+    /**
+     * @brief Write `layout` and `radius` in the environment file format.
+     *
+     * Coordinates are stored as doubles, so they must be exactly representable; layouts built from
+     * doubles, such as the @ref environments generators, always are. Every process that reads the
+     * file therefore rebuilds exactly the same configuration space.
+     *
+     * @return True if written, false if a value is not exactly representable or the stream fails.
+     */
+    inline bool write_environment(std::ostream& stream, const environments::Layout& layout, const numeric::fscalar& radius, const std::source_location location = std::source_location::current()) {
+        std::vector<double> values;
+        auto append = [&values](const geometry::Point2D& point) {
+            std::optional<double> x = detail::exact_double(point.x());
+            std::optional<double> y = detail::exact_double(point.y());
+            if (!x || !y) return false;
+            values.push_back(*x);
+            values.push_back(*y);
+            return true;
+        };
+        std::optional<double> exact_radius = detail::exact_double(radius);
+        bool exact = exact_radius.has_value();
+        for (const geometry::Point2D& point : layout.outer) exact = exact && append(point);
+        for (const geometry::Polygon2D& hole : layout.holes) {
+            for (auto vertex_it = hole.vertices_begin(); vertex_it != hole.vertices_end(); ++vertex_it) exact = exact && append(*vertex_it);
+        }
+        if (!exact) {
+            burst_error("Environment coordinates and radius must be exactly representable as doubles", location);
+            return false;
+        }
+
+        stream.write(detail::ENVIRONMENT_MAGIC.data(), detail::ENVIRONMENT_MAGIC.size());
+        detail::write_u32(stream, FORMAT_VERSION);
+        detail::write_double(stream, *exact_radius);
+        auto value_it = values.begin();
+        auto write_ring = [&stream, &value_it](std::size_t size) {
+            detail::write_u64(stream, size);
+            for (std::size_t i = 0; i < 2 * size; ++i) detail::write_double(stream, *value_it++);
+        };
+        write_ring(layout.outer.size());
+        detail::write_u64(stream, layout.holes.size());
+        for (const geometry::Polygon2D& hole : layout.holes) write_ring(hole.size());
+        return static_cast<bool>(stream);
+    }
+    /**
+     * @brief Write an environment file at `path`; the file appears only once complete.
+     * @return True if written.
+     */
+    inline bool write_environment(const std::filesystem::path& path, const environments::Layout& layout, const numeric::fscalar& radius, const std::source_location location = std::source_location::current()) {
+        bool written = detail::write_atomically(path, [&](std::ostream& stream) {
+            return write_environment(stream, layout, radius, location);
+        });
+        if (!written) burst_error("Failed to write environment file " + path.string(), location);
+        return written;
+    }
+
+    /**
+     * @brief Read an environment and build its configuration space.
+     * @return Environment, or `std::nullopt` if the data is malformed or the configuration space cannot be built.
+     */
+    inline std::optional<Environment> read_environment(std::istream& stream, const std::source_location location = std::source_location::current()) {
+        tracing::Span span{"experiments::read_environment"};
+        auto malformed = [&location]() -> std::optional<Environment> {
+            burst_error("Malformed or unsupported environment data", location);
+            return std::nullopt;
+        };
+        if (!detail::read_preamble(stream, detail::ENVIRONMENT_MAGIC)) return malformed();
+        std::optional<double> radius = detail::read_double(stream);
+        if (!radius) return malformed();
+
+        auto read_ring = [&stream]() -> std::optional<std::vector<geometry::Point2D>> {
+            std::optional<std::uint64_t> size = detail::read_u64(stream);
+            if (!size || *size > detail::MAX_COUNT) return std::nullopt;
+            std::vector<geometry::Point2D> ring;
+            for (std::uint64_t i = 0; i < *size; ++i) {
+                std::optional<double> x = detail::read_double(stream);
+                std::optional<double> y = detail::read_double(stream);
+                if (!x || !y) return std::nullopt;
+                ring.emplace_back(*x, *y);
+            }
+            return ring;
+        };
+        Environment environment{{}, *radius, nullptr};
+        std::optional<std::vector<geometry::Point2D>> outer = read_ring();
+        std::optional<std::uint64_t> hole_count = detail::read_u64(stream);
+        if (!outer || !hole_count || *hole_count > detail::MAX_COUNT) return malformed();
+        environment.layout.outer = std::move(*outer);
+        for (std::uint64_t i = 0; i < *hole_count; ++i) {
+            std::optional<std::vector<geometry::Point2D>> hole = read_ring();
+            if (!hole) return malformed();
+            environment.layout.holes.emplace_back(hole->begin(), hole->end());
+        }
+
+        std::optional<geometry::WallSpace> walls = environments::build(environment.layout, location);
+        if (!walls) return std::nullopt;
+        environment.configuration_space = detail::EnvironmentAccess::configurationSpace(*walls, environment.radius, location);
+        if (!environment.configuration_space) return std::nullopt;
+        return environment;
+    }
+    /**
+     * @brief Read the environment file at `path` and build its configuration space.
+     * @return Environment, or `std::nullopt` if the file cannot be read or is malformed.
+     */
+    inline std::optional<Environment> read_environment(const std::filesystem::path& path, const std::source_location location = std::source_location::current()) {
+        std::ifstream file{path, std::ios::binary};
+        if (!file) {
+            burst_error("Failed to open environment file " + path.string(), location);
+            return std::nullopt;
+        }
+        return read_environment(file, location);
+    }
+
+    /** @brief Values recorded by one run. */
+    struct RunResult {
+        std::uint64_t run;              ///< Run index
+        std::vector<double> values;     ///< One value per column of the result set
+
+        bool operator==(const RunResult&) const = default;
+    };
+
+    /** @brief Results of one shard, or of a whole experiment after merging, ordered by run index. */
+    struct ResultSet {
+        std::uint64_t runs = 0;             ///< Number of runs in the whole experiment
+        std::uint64_t shard = 0;            ///< Shard these results belong to
+        std::uint64_t shard_count = 1;      ///< Number of shards (1 once merged)
+        std::uint32_t value_count = 0;      ///< Values per run
+        std::vector<RunResult> results;     ///< Results in increasing run order
+
+        /** @brief Whether every run of the experiment is present. */
+        bool complete() const noexcept {
+            return this->results.size() == this->runs;
+        }
+        bool operator==(const ResultSet&) const = default;
+    };
+
+    /**
+     * @brief Write `results` in the result file format.
+     * @return True if written.
+     */
+    inline bool write_results(std::ostream& stream, const ResultSet& results) {
+        stream.write(detail::RESULTS_MAGIC.data(), detail::RESULTS_MAGIC.size());
+        detail::write_u32(stream, FORMAT_VERSION);
+        detail::write_u32(stream, results.value_count);
+        detail::write_u64(stream, results.runs);
+        detail::write_u64(stream, results.shard);
+        detail::write_u64(stream, results.shard_count);
+        detail::write_u64(stream, results.results.size());
+        for (const RunResult& result : results.results) {
+            detail::write_u64(stream, result.run);
+            for (double value : result.values) detail::write_double(stream, value);
+        }
+        return static_cast<bool>(stream);
+    }
+    /**
+     * @brief Write a result file at `path`; the file appears only once complete.
+     * @return True if written.
+     */
+    inline bool write_results(const std::filesystem::path& path, const ResultSet& results, const std::source_location location = std::source_location::current()) {
+        bool written = detail::write_atomically(path, [&results](std::ostream& stream) {
+            return write_results(stream, results);
+        });
+        if (!written) burst_error("Failed to write result file " + path.string(), location);
+        return written;
+    }
+
+    /**
+     * @brief Read results in the result file format.
+     * @return Result set, or `std::nullopt` if the data is malformed.
+     */
+    inline std::optional<ResultSet> read_results(std::istream& stream, const std::source_location location = std::source_location::current()) {
+        auto malformed = [&location]() -> std::optional<ResultSet> {
+            burst_error("Malformed or unsupported result data", location);
+            return std::nullopt;
+        };
+        if (!detail::read_preamble(stream, detail::RESULTS_MAGIC)) return malformed();
+        std::optional<std::uint32_t> value_count = detail::read_u32(stream);
+        std::optional<std::uint64_t> runs = detail::read_u64(stream);
+        std::optional<std::uint64_t> shard = detail::read_u64(stream);
+        std::optional<std::uint64_t> shard_count = detail::read_u64(stream);
+        std::optional<std::uint64_t> record_count = detail::read_u64(stream);
+        if (!record_count || *value_count > detail::MAX_VALUES || *record_count > *runs || *shard_count == 0 || *shard >= *shard_count) return malformed();
+
+        // Reserve only as many records as the rest of the stream can hold, so a corrupt count cannot allocate
+        std::uint64_t record_bytes = sizeof(std::uint64_t) + std::uint64_t{*value_count} * sizeof(double);
+        std::optional<std::uint64_t> remaining = detail::remaining_bytes(stream);
+        if (remaining && *record_count > *remaining / record_bytes) return malformed();
+
+        ResultSet results{*runs, *shard, *shard_count, *value_count, {}};
+        if (remaining) results.results.reserve(static_cast<std::size_t>(*record_count));
+        for (std::uint64_t i = 0; i < *record_count; ++i) {
+            std::optional<std::uint64_t> run = detail::read_u64(stream);
+            if (!run || *run >= *runs || *run % *shard_count != *shard) return malformed();
+            RunResult result{*run, std::vector<double>(*value_count)};
+            for (double& value : result.values) {
+                std::optional<double> read = detail::read_double(stream);
+                if (!read) return malformed();
+                value = *read;
+            }
+            results.results.push_back(std::move(result));
+        }
+        return results;
+    }
+    /**
+     * @brief Read the result file at `path`.
+     * @return Result set, or `std::nullopt` if the file cannot be read or is malformed.
+     */
+    inline std::optional<ResultSet> read_results(const std::filesystem::path& path, const std::source_location location = std::source_location::current()) {
+        std::ifstream file{path, std::ios::binary};
+        if (!file) {
+            burst_error("Failed to open result file " + path.string(), location);
+            return std::nullopt;
+        }
+        return read_results(file, location);
+    }
+
+    /**
+     * @brief Limits on how many runs of a shard execute at once.
+     *
+     * The number of concurrent runs is `threads`, lowered so that the environment plus
+     * `run_memory` per concurrent run fits in `memory_budget`. A budget or per-run estimate of 0
+     * disables the memory limit.
+     *
+     * The limit is applied once, when the shard starts. `run_memory` is the caller's fixed estimate
+     * and is not compared with what the runs actually use, so an estimate that is too low can still
+     * exceed the budget. Measure a representative run (e.g. the @ref memory::MemoryUsage of its
+     * robots and coverage at the end) to choose it.
+     */
+    struct RunLimits {
+        /** @brief Upper bound on concurrent runs (0 is treated as 1). */
+        std::size_t threads = 1;
+        /** @brief Bytes available to the environment and the concurrent runs together. */
+        std::size_t memory_budget = 0;
+        /** @brief Caller's estimate of the peak bytes of one run beyond the shared environment; fixed for the whole shard. */
+        std::size_t run_memory = 0;
+    };
+
+    /**
+     * @brief Number of runs to execute at once under `limits`.
+     * @return At least 1; a warning is reported when even one run does not fit the budget.
+     */
+    inline std::size_t concurrent_runs(const Environment& environment, const RunLimits& limits, const std::source_location location = std::source_location::current()) {
+        std::size_t count = std::max<std::size_t>(limits.threads, 1);
+        if (limits.memory_budget == 0 || limits.run_memory == 0) return count;
+        std::size_t shared = environment.configuration_space ? environment.configuration_space->memoryUsage().total() : 0;
+        std::size_t available = limits.memory_budget > shared ? limits.memory_budget - shared : 0;
+        if (available < limits.run_memory) {
+            burst_warning("Memory budget does not fit one experiment run; running them one at a time", location);
+            return 1;
+        }
+        return std::min(count, available / limits.run_memory);
+    }
+
+    /**
+     * @brief Execute the runs of `shard`, several at once within `limits`.
+     *
+     * Runs are handed out in increasing index order and the results are kept in that order, so the
+     * result set does not depend on the number of threads. With more than one concurrent run,
+     * `run` is called from several threads at once and must be safe to call that way.
+     *
+     * @param environment Environment shared by all runs.
+     * @param runs Number of runs in the whole experiment.
+     * @param value_count Number of values every run must return.
+     * @param shard Slice of the runs to execute.
+     * @param limits Thread and memory limits, see @ref concurrent_runs.
+     * @param run Called as `run(index, environment)`, returning the run's values.
+     * @return Shard results, or `std::nullopt` if a run returns the wrong number of values.
+     */
+    template <typename Run> requires std::invocable<Run&, std::size_t, const Environment&> && std::convertible_to<std::invoke_result_t<Run&, std::size_t, const Environment&>, std::vector<double>>
+    std::optional<ResultSet> run_shard(const Environment& environment, std::size_t runs, std::uint32_t value_count, const Shard& shard, const RunLimits& limits, Run run, const std::source_location location = std::source_location::current()) {
+        tracing::Span span{"experiments::run_shard"};
+        std::size_t owned = shard.size(runs);
+        std::vector<std::vector<double>> values(owned);
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        auto worker = [&] {
+            for (std::size_t slot = next.fetch_add(1); slot < owned && !failed.load(std::memory_order_relaxed); slot = next.fetch_add(1)) {
+                values[slot] = std::invoke(run, shard.index + slot * shard.count, environment);
+                if (values[slot].size() != value_count) failed.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        std::size_t thread_count = std::min(concurrent_runs(environment, limits, location), std::max<std::size_t>(owned, 1));
+        if (thread_count <= 1) {
+            worker();
+        } else {
+            std::vector<std::jthread> threads;
+            threads.reserve(thread_count - 1);
+            for (std::size_t i = 1; i < thread_count; ++i) threads.emplace_back(worker);
+            worker();
+        }
+        if (failed.load()) {
+            burst_error("Experiment run returned the wrong number of values", location);
+            return std::nullopt;
+        }
+
+        ResultSet results{runs, shard.index, shard.count, value_count, {}};
+        results.results.reserve(owned);
+        for (std::size_t slot = 0; slot < owned; ++slot) results.results.push_back(RunResult{shard.index + slot * shard.count, std::move(values[slot])});
+        return results;
+    }
+
+    /**
+     * @brief Execute the runs of `shard` one at a time in increasing index order.
+     * @return Shard results, or `std::nullopt` if a run returns the wrong number of values.
+     */
+    template <typename Run> requires std::invocable<Run&, std::size_t, const Environment&> && std::convertible_to<std::invoke_result_t<Run&, std::size_t, const Environment&>, std::vector<double>>
+    std::optional<ResultSet> run_shard(const Environment& environment, std::size_t runs, std::uint32_t value_count, const Shard& shard, Run run, const std::source_location location = std::source_location::current()) {
+        return run_shard(environment, runs, value_count, shard, RunLimits{}, std::move(run), location);
+    }
+
+    /**
+     * @brief Merge shard results into one result set ordered by run index.
+     *
+     * All inputs must describe the same experiment (run count, value count, shard count), and no
+     * run may appear twice. Missing shards are allowed; check @ref ResultSet::complete.
+     *
+     * @return Merged results as a single shard, or `std::nullopt` if the inputs disagree.
+     */
+    inline std::optional<ResultSet> merge_results(std::span<const ResultSet> shards, const std::source_location location = std::source_location::current()) {
+        if (shards.empty()) {
+            burst_error("Cannot merge an empty list of result sets", location);
+            return std::nullopt;
+        }
+        ResultSet merged{shards.front().runs, 0, 1, shards.front().value_count, {}};
+        for (const ResultSet& shard : shards) {
+            if (shard.runs != merged.runs || shard.value_count != merged.value_count || shard.shard_count != shards.front().shard_count) {
+                burst_error("Cannot merge results of different experiments", location);
+                return std::nullopt;
+            }
+            merged.results.insert(merged.results.end(), shard.results.begin(), shard.results.end());
+        }
+        std::ranges::sort(merged.results, {}, &RunResult::run);
+        auto duplicate = std::ranges::adjacent_find(merged.results, {}, &RunResult::run);
+        if (duplicate != merged.results.end()) {
+            burst_error("Run " + std::to_string(duplicate->run) + " appears in more than one result set", location);
+            return std::nullopt;
+        }
+        return merged;
+    }
+    /**
+     * @brief Merge the result files at `inputs` and write the merged file at `output`.
+     * @return Merged results, or `std::nullopt` if an input cannot be read, the inputs disagree, or writing fails.
+     */
+    inline std::optional<ResultSet> merge_result_files(std::span<const std::filesystem::path> inputs, const std::filesystem::path& output, const std::source_location location = std::source_location::current()) {
+        std::vector<ResultSet> shards;
+        for (const std::filesystem::path& input : inputs) {
+            std::optional<ResultSet> shard = read_results(input, location);
+            if (!shard) return std::nullopt;
+            shards.push_back(std::move(*shard));
+        }
+        std::optional<ResultSet> merged = merge_results(shards, location);
+        if (!merged || !write_results(output, *merged, location)) return std::nullopt;
+        return merged;
+    }
+
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef BURST_EXTERN_TEMPLATES_HPP
+#define BURST_EXTERN_TEMPLATES_HPP
+
+/**
+ * @file extern_templates.hpp
+ * @brief Compile-time check that a target using the compiled default instantiations matches their configuration.
+ *
+ * `BURST_compiled` records the configuration macros it was built with as `BURST_COMPILED_*`
+ * definitions (0 or 1) that propagate to every target linking it, together with
+ * `BURST_EXTERN_TEMPLATES`. A target that links the library but changes one of the macros, for
+ * example by defining `BURST_ENABLE_TRACING`, would mix two layouts of the same classes. It fails
+ * to compile here instead. Such targets must link the header-only `BURST` target.
+ */
+
+#ifdef BURST_EXTERN_TEMPLATES
+
+#if !defined(BURST_COMPILED_TRACING) || !defined(BURST_COMPILED_ARENA) || !defined(BURST_COMPILED_DISABLE_WARNINGS) || !defined(BURST_COMPILED_DISABLE_ERRORS)
+#error "BURST_EXTERN_TEMPLATES is defined without the configuration of BURST_compiled; link the BURST_compiled target instead of defining it by hand"
+#endif
+
+#if defined(BURST_ENABLE_TRACING) != BURST_COMPILED_TRACING
+#error "BURST_ENABLE_TRACING differs from the BURST_compiled configuration; link the header-only BURST target instead"
+#endif
+#if defined(BURST_ENABLE_ARENA) != BURST_COMPILED_ARENA
+#error "BURST_ENABLE_ARENA differs from the BURST_compiled configuration; link the header-only BURST target instead"
+#endif
+#if defined(BURST_DISABLE_WARNINGS) != BURST_COMPILED_DISABLE_WARNINGS
+#error "BURST_DISABLE_WARNINGS differs from the BURST_compiled configuration; link the header-only BURST target instead"
+#endif
+#if defined(BURST_DISABLE_ERRORS) != BURST_COMPILED_DISABLE_ERRORS
+#error "BURST_DISABLE_ERRORS differs from the BURST_compiled configuration; link the header-only BURST target instead"
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef BURST_GENERATOR_HPP
+#define BURST_GENERATOR_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file generator.hpp
+ * @brief Minimal lazy C++20 coroutine generator usable as an input range.
+ */
+
+namespace BURST {
+
+    /**
+     * @brief Lazily produced sequence of `T` values from a coroutine that `co_yield`s them.
+     *
+     * Nothing runs until the first value is requested; each increment resumes the coroutine up to
+     * its next `co_yield`. The generator is a move-only view, so it composes with standard range
+     * adaptors (`std::views::take`, `std::views::filter`, ...). Destroying it, for example by
+     * leaving a loop early, destroys the suspended coroutine without computing further values.
+     * Exceptions escaping the coroutine are rethrown from the call that resumed it.
+     *
+     * A generator can only be iterated once. Each value is valid until the next increment.
+     *
+     * @tparam T Yielded value type.
+     */
+    template <typename T>
+    class Generator : public std::ranges::view_interface<Generator<T>> {
+    public:
+        /** @brief Coroutine promise holding the most recently yielded value. */
+        struct promise_type {
+            std::optional<T> value;
+            std::exception_ptr exception;
+
+            Generator get_return_object() noexcept {
+                return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            std::suspend_always final_suspend() const noexcept { return {}; }
+            std::suspend_always yield_value(T yielded) noexcept(std::is_nothrow_move_constructible_v<T>) {
+                this->value.emplace(std::move(yielded));
+                return {};
+            }
+            void return_void() const noexcept {}
+            void unhandled_exception() noexcept {
+                this->exception = std::current_exception();
+            }
+            // Disallow co_await inside generators
+            template <typename U> std::suspend_never await_transform(U&&) = delete;
+        };
+
+        /** @brief Single-pass iterator over the yielded values. */
+        class iterator {
+        private:
+            std::coroutine_handle<promise_type> handle;
+
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() noexcept = default;
+            explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : handle{handle} {}
+
+            const T& operator*() const {
+                return *this->handle.promise().value;
+            }
+            const T* operator->() const {
+                return &*this->handle.promise().value;
+            }
+            iterator& operator++() {
+                Generator::resume(this->handle);
+                return *this;
+            }
+            void operator++(int) {
+                ++*this;
+            }
+            friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+                return !it.handle || it.handle.done();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+        explicit Generator(std::coroutine_handle<promise_type> handle) noexcept : handle{handle} {}
+
+        // Run the coroutine to its next yield, rethrowing anything it threw
+        static void resume(std::coroutine_handle<promise_type> handle) {
+            handle.promise().value.reset();
+            handle.resume();
+            if (handle.promise().exception) std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+        }
+
+    public:
+        Generator() noexcept = default;
+        Generator(const Generator&) = delete;
+        Generator& operator=(const Generator&) = delete;
+        Generator(Generator&& other) noexcept : handle{std::exchange(other.handle, nullptr)} {}
+        Generator& operator=(Generator&& other) noexcept {
+            if (this != &other) {
+                if (this->handle) this->handle.destroy();
+                this->handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+        ~Generator() {
+            if (this->handle) this->handle.destroy();
+        }
+
+        /**
+         * @brief Start the coroutine and return an iterator to its first value.
+         * @return Iterator equal to `end()` if the coroutine yields nothing.
+         */
+        iterator begin() {
+            if (this->handle && !this->handle.done() && !this->handle.promise().value) resume(this->handle);
+            return iterator{this->handle};
+        }
+        /**
+         * @brief Sentinel reached once the coroutine finishes.
+         * @return `std::default_sentinel`.
+         */
+        std::default_sentinel_t end() const noexcept {
+            return std::default_sentinel;
+        }
+    };
+
+}
+
+#endif
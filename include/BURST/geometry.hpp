@@ -1,8 +1,10 @@
 #ifndef BURST_GEOMETRIC_TYPES_HPP
 #define BURST_GEOMETRIC_TYPES_HPP
 
+#include <cmath>
 #include <concepts>
 #include <initializer_list>
+#include <iterator>
 #include <numeric>
 #include <optional>
 #include <ranges>
@@ -259,10 +261,223 @@ namespace BURST::geometry {
         return CurvilinearPolygon2D{semicircles.begin(), semicircles.end()};
     }
 
+    /** @brief Largest deviation of cos² + sin² from 1 accepted by @ref is_rigid_motion. */
+    inline constexpr double RIGID_MOTION_TOLERANCE = 1e-9;
+
+    /**
+     * @brief Whether `transformation` is a proper rigid motion: a rotation followed by a translation.
+     *
+     * Reflections are excluded because they reverse the orientation of boundary loops. The linear
+     * part must have the exact form [c -s; s c], but c² + s² only has to be within
+     * @ref RIGID_MOTION_TOLERANCE of 1, so rotations built from `std::cos` and `std::sin` are
+     * accepted. Pass such rotations through @ref normalize_rigid_motion before applying them.
+     */
+    inline bool is_rigid_motion(const Transformation& transformation) {
+        if (transformation.m(0, 0) != transformation.m(1, 1) || transformation.m(0, 1) != -transformation.m(1, 0)) return false;
+        double squared_scale = CGAL::to_double(transformation.m(0, 0) * transformation.m(0, 0) + transformation.m(1, 0) * transformation.m(1, 0));
+        return std::abs(squared_scale - 1) <= RIGID_MOTION_TOLERANCE;
+    }
+
+    /**
+     * @brief Exact rigid motion closest to the near-rigid `transformation`.
+     *
+     * The linear part is divided by the exact square root of c² + s², so the result is an exact
+     * rotation with the same angle and the same translation. Rotations whose c² + s² is already
+     * exactly 1 (quarter turns, or rational ones from Pythagorean triples) are returned unchanged
+     * and keep their square-root-free coordinates.
+     *
+     * @param transformation Transformation accepted by @ref is_rigid_motion; not checked.
+     * @return Exact rigid motion.
+     */
+    inline Transformation normalize_rigid_motion(const Transformation& transformation) {
+        numeric::fscalar squared_scale = transformation.m(0, 0) * transformation.m(0, 0) + transformation.m(1, 0) * transformation.m(1, 0);
+        if (squared_scale == 1) return transformation;
+        numeric::fscalar scale = CGAL::sqrt(squared_scale);
+        numeric::fscalar cosine = transformation.m(0, 0) / scale, sine = transformation.m(1, 0) / scale;
+        return Transformation{cosine, -sine, transformation.m(0, 2), sine, cosine, transformation.m(1, 2)};
+    }
+
+    /**
+     * @brief Append the image of `curve` under the rigid motion `transformation` as X-monotone curves.
+     *
+     * Segments map to one segment. A rotated arc is split at the leftmost or rightmost point of its
+     * circle when that point falls strictly inside it, so an arc maps to at most two curves.
+     *
+     * @param curve Curve to transform.
+     * @param transformation Rigid motion (see @ref is_rigid_motion); not checked.
+     * @param out Output iterator receiving @ref MonotoneCurve2D values.
+     */
+    template <typename OutputIterator>
+    void transform_curve(const MonotoneCurve2D& curve, const Transformation& transformation, OutputIterator out) {
+        using traits_point_t = CurvedTraits::Point_2;
+        using converted_ft = decltype(std::declval<traits_point_t>().x());
+        Point2D source = transformation(convert_point<Point2D, traits_point_t>(curve.source(), numeric::sqrt_to_fscalar<converted_ft>));
+        Point2D target = transformation(convert_point<Point2D, traits_point_t>(curve.target(), numeric::sqrt_to_fscalar<converted_ft>));
+        if (!curve.is_circular()) {
+            *out++ = MonotoneCurve2D{source, target};
+            return;
+        }
+
+        Point2D center = transformation(curve.supporting_circle().center());
+        numeric::fscalar squared_radius = curve.supporting_circle().squared_radius();
+        numeric::fscalar radius = CGAL::sqrt(squared_radius);
+        WindingOrder sense = curve.orientation();
+        CGAL::Circle_2<Kernel> circle{center, squared_radius, sense};
+        // X-monotone arcs sweep at most half a turn, so at most one of the two extreme points can lie strictly inside
+        for (const Point2D& extreme : {Point2D{center.x() - radius, center.y()}, Point2D{center.x() + radius, center.y()}}) {
+            if (CGAL::orientation(center, source, extreme) == sense && CGAL::orientation(center, extreme, target) == sense) {
+                *out++ = MonotoneCurve2D{circle, traits_point_t{source.x(), source.y()}, traits_point_t{extreme.x(), extreme.y()}, sense};
+                *out++ = MonotoneCurve2D{circle, traits_point_t{extreme.x(), extreme.y()}, traits_point_t{target.x(), target.y()}, sense};
+                return;
+            }
+        }
+        *out++ = MonotoneCurve2D{circle, traits_point_t{source.x(), source.y()}, traits_point_t{target.x(), target.y()}, sense};
+    }
+
+    /**
+     * @brief Image of a curvilinear polygon set under the rigid motion `transformation`.
+     *
+     * Every loop is mapped curve by curve with @ref transform_curve and the faces are inserted
+     * again, so no boolean operation or offset is recomputed.
+     *
+     * @param shape Polygon set to transform.
+     * @param transformation Rigid motion (see @ref is_rigid_motion); not checked.
+     * @return Transformed polygon set.
+     */
+    inline CurvilinearPolygonSet2D transform_shape(const CurvilinearPolygonSet2D& shape, const Transformation& transformation) {
+        auto transform_loop = [&transformation](const CurvilinearPolygon2D& loop) {
+            boost::container::small_vector<MonotoneCurve2D, 16> curves;
+            for (auto curve_it = loop.curves_begin(); curve_it != loop.curves_end(); ++curve_it) transform_curve(*curve_it, transformation, std::back_inserter(curves));
+            return CurvilinearPolygon2D{curves.begin(), curves.end()};
+        };
+
+        boost::container::small_vector<HoledCurvilinearPolygon2D, 1> polygons;
+        shape.polygons_with_holes(std::back_inserter(polygons));
+        boost::container::small_vector<HoledCurvilinearPolygon2D, 1> transformed;
+        for (const HoledCurvilinearPolygon2D& polygon : polygons) {
+            boost::container::small_vector<CurvilinearPolygon2D, 4> holes;
+            for (auto hole_it = polygon.holes_begin(); hole_it != polygon.holes_end(); ++hole_it) holes.push_back(transform_loop(*hole_it));
+            transformed.emplace_back(transform_loop(polygon.outer_boundary()), holes.begin(), holes.end());
+        }
+        CurvilinearPolygonSet2D result;
+        result.insert(transformed.begin(), transformed.end());
+        return result;
+    }
+
+    /**
+     * @brief Linear polygon set as a curvilinear one whose curves are all segments.
+     *
+     * Lets regions computed with linear boolean operations be used wherever a
+     * @ref CurvilinearPolygonSet2D is expected (e.g. @ref ConfigurationSpace).
+     *
+     * @return Curvilinear polygon set covering the same region as `shape`.
+     */
+    inline CurvilinearPolygonSet2D to_curvilinear(const LinearPolygonSet2D& shape) {
+        auto convert_loop = [](const Polygon2D& loop) {
+            boost::container::small_vector<MonotoneCurve2D, 16> curves;
+            for (auto edge_it = loop.edges_begin(); edge_it != loop.edges_end(); ++edge_it) curves.push_back(construct_curve(*edge_it));
+            return CurvilinearPolygon2D{curves.begin(), curves.end()};
+        };
+
+        boost::container::small_vector<HoledPolygon2D, 1> polygons;
+        shape.polygons_with_holes(std::back_inserter(polygons));
+        boost::container::small_vector<HoledCurvilinearPolygon2D, 1> converted;
+        for (const HoledPolygon2D& polygon : polygons) {
+            boost::container::small_vector<CurvilinearPolygon2D, 4> holes;
+            for (auto hole_it = polygon.holes_begin(); hole_it != polygon.holes_end(); ++hole_it) holes.push_back(convert_loop(*hole_it));
+            converted.emplace_back(convert_loop(polygon.outer_boundary()), holes.begin(), holes.end());
+        }
+        CurvilinearPolygonSet2D result;
+        result.insert(converted.begin(), converted.end());
+        return result;
+    }
+
     /** @brief Euclidean midpoint of two points. */
     inline Point2D midpoint(const Point2D& a, const Point2D& b) {
         return Point2D{(a.x() + b.x())/2, (a.y() + b.y())/2};
     }
+
+    /**
+     * @brief Constant-curvature trajectory: motion from an origin along a circle tangent to a direction.
+     *
+     * Positive curvature turns counterclockwise (left), negative curvature clockwise (right), and
+     * zero curvature is a straight ray. Constructible from an origin and direction alone, so it
+     * satisfies @ref valid_trajectory_type and reduces to a ray unless a curvature is given.
+     * The supporting circle passes exactly through the origin.
+     */
+    class ArcTrajectory {
+    private:
+        Point2D origin;
+        Vector2D direction;
+        numeric::fscalar kappa;
+        Point2D circle_center;
+        numeric::fscalar circle_squared_radius;
+
+    public:
+        /**
+         * @param origin Start of the motion.
+         * @param direction Initial tangent direction; need not be normalized.
+         * @param curvature Signed curvature (inverse turning radius).
+         */
+        ArcTrajectory(const Point2D& origin, const Vector2D& direction, const numeric::fscalar& curvature = 0) : origin{origin}, direction{direction}, kappa{curvature}, circle_center{origin}, circle_squared_radius{0} {
+            if (this->kappa == 0 || direction == CGAL::NULL_VECTOR) return;
+            // The centre lies along the left normal for counterclockwise turns and the right normal for clockwise ones
+            Vector2D normal{-direction.y(), direction.x()};
+            this->circle_center = origin + normal / (this->kappa * CGAL::sqrt(direction.squared_length()));
+            this->circle_squared_radius = 1 / (this->kappa * this->kappa);
+        }
+
+        /** @brief Start of the motion. */
+        const Point2D& source() const noexcept { return this->origin; }
+        /** @brief Initial tangent direction. */
+        Vector2D to_vector() const { return this->direction; }
+        /** @brief Signed curvature; zero for a straight ray. */
+        const numeric::fscalar& curvature() const noexcept { return this->kappa; }
+        /** @brief Whether the trajectory is a straight ray. */
+        bool isStraight() const { return this->circle_squared_radius == 0; }
+        /** @brief Centre of the supporting circle (the origin for straight rays). */
+        const Point2D& center() const noexcept { return this->circle_center; }
+        /** @brief Squared radius of the supporting circle (zero for straight rays). */
+        const numeric::fscalar& squaredRadius() const noexcept { return this->circle_squared_radius; }
+        /** @brief Direction of travel around the supporting circle (`CGAL::COLLINEAR` for straight rays). */
+        CGAL::Orientation orientation() const { return this->isStraight() ? CGAL::COLLINEAR : (this->kappa > 0 ? CGAL::COUNTERCLOCKWISE : CGAL::CLOCKWISE); }
+        /** @brief Straight ray with the same origin and direction. */
+        Ray2D ray() const { return Ray2D{this->origin, this->direction}; }
+
+        /**
+         * @brief Approximate angle travelled around the circle from the origin to the direction of (x, y), in [0, 2 pi).
+         * @return Zero for straight rays.
+         */
+        double sweep(double x, double y) const {
+            if (this->isStraight()) return 0.0;
+            double cx = CGAL::to_double(this->circle_center.x()), cy = CGAL::to_double(this->circle_center.y());
+            double ux = CGAL::to_double(this->origin.x()) - cx, uy = CGAL::to_double(this->origin.y()) - cy;
+            double vx = x - cx, vy = y - cy;
+            double angle = std::atan2(ux * vy - uy * vx, ux * vx + uy * vy);
+            if (this->kappa < 0) angle = -angle;
+            return angle < 0.0 ? angle + 2.0 * CGAL_PI : angle;
+        }
+
+        /**
+         * @brief Exact test for whether `a` is reached strictly before `b` when travelling from the origin.
+         *
+         * Both points are measured by the direction from the circle centre, so they need not lie on the circle.
+         * Only meaningful for curved trajectories.
+         */
+        bool before(const Point2D& a, const Point2D& b) const {
+            Vector2D u = this->origin - this->circle_center;
+            int sense = this->kappa > 0 ? 1 : -1;
+            // Split the turn into the half before the antipode of the origin and the half from it onwards
+            auto half = [&u, sense](const Vector2D& v) {
+                int side = sense * CGAL::sign(u.x() * v.y() - u.y() * v.x());
+                return side > 0 || (side == 0 && u * v > 0) ? 0 : 1;
+            };
+            Vector2D va = a - this->circle_center, vb = b - this->circle_center;
+            int half_a = half(va), half_b = half(vb);
+            if (half_a != half_b) return half_a < half_b;
+            return sense * CGAL::sign(va.x() * vb.y() - va.y() * vb.x()) > 0;
+        }
+    };
     
     /**
      * @brief Wrap a polygon or polygon set as a @ref renderable::Renderable filled with `color`.
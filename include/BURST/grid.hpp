@@ -0,0 +1,282 @@
+#ifndef BURST_GRID_HPP
+#define BURST_GRID_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <span>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+
+#include "geometry.hpp"
+#include "boundary.hpp"
+
+/**
+ * @file grid.hpp
+ * @brief Uniform grid index over the curves of a @ref BURST::geometry::CompactBoundary.
+ */
+
+namespace BURST::geometry {
+
+    /**
+     * @brief Uniform grid over the bounding box of a @ref CompactBoundary with curves bucketed by cell.
+     *
+     * Every curve is listed in each cell its (slightly padded) bounding box overlaps, in one
+     * contiguous array with per-cell offsets. Segment queries walk the cells the segment crosses
+     * in order with a 2D DDA, so first-hit queries can stop at the first hit certified to lie
+     * before the exit of the current cell. For dense, roughly uniform layouts this touches fewer
+     * curves than descending the hierarchy of the boundary.
+     *
+     * The grid stores curve indices only; every query takes the boundary it was built from.
+     */
+    class BoundaryGrid {
+    public:
+        /** @brief Default number of cells per boundary curve. */
+        static constexpr double DEFAULT_CELLS_PER_CURVE = 1.0;
+        /** @brief Upper limit on the number of cells along either axis. */
+        static constexpr std::size_t MAX_CELLS_PER_AXIS = 1024;
+
+    private:
+        double grid_xmin, grid_ymin, grid_xmax, grid_ymax;
+        double cell_width, cell_height;
+        std::size_t column_count, row_count, curve_count;
+        // Curves of cell `c` are cell_curves[cell_offsets[c], cell_offsets[c + 1])
+        std::vector<std::uint32_t> cell_offsets;
+        std::vector<std::uint32_t> cell_curves;
+
+        // Relative slack added to curve boxes so rounding in the DDA never skips a cell holding a hit
+        static constexpr double GRID_EPSILON = 1e-9;
+
+        std::size_t columnOf(double x) const {
+            double column = std::floor((x - this->grid_xmin) / this->cell_width);
+            return static_cast<std::size_t>(std::clamp(column, 0.0, static_cast<double>(this->column_count - 1)));
+        }
+
+        std::size_t rowOf(double y) const {
+            double row = std::floor((y - this->grid_ymin) / this->cell_height);
+            return static_cast<std::size_t>(std::clamp(row, 0.0, static_cast<double>(this->row_count - 1)));
+        }
+
+        // Curves already visited by a query: those whose stamp equals the query's generation
+        struct VisitedCurves {
+            std::vector<std::uint32_t> stamps;
+            std::uint32_t generation = 0;
+
+            // Start a query over `count` curves; the stamps are only cleared when the generation wraps around
+            std::uint32_t begin(std::size_t count) {
+                if (this->stamps.size() < count) this->stamps.resize(count, 0);
+                if (++this->generation == 0) {
+                    std::ranges::fill(this->stamps, 0);
+                    this->generation = 1;
+                }
+                return this->generation;
+            }
+            // Mark `curve` as visited by query `query`; false if it already was
+            bool insert(std::uint32_t curve, std::uint32_t query) {
+                if (this->stamps[curve] == query) return false;
+                this->stamps[curve] = query;
+                return true;
+            }
+        };
+
+        // Stamps of the calling thread, so concurrent queries on a shared grid never touch the same array
+        static VisitedCurves& visitedCurves() {
+            thread_local VisitedCurves visited;
+            return visited;
+        }
+
+    public:
+        BoundaryGrid() : grid_xmin{0}, grid_ymin{0}, grid_xmax{0}, grid_ymax{0}, cell_width{1}, cell_height{1}, column_count{0}, row_count{0}, curve_count{0} {}
+
+        /**
+         * @brief Bucket the curves of `boundary` into a grid of about `cells_per_curve` cells per curve.
+         * @param boundary Boundary to index; later queries must pass the same boundary.
+         * @param cells_per_curve Target cell count relative to the number of curves (square cells where possible).
+         */
+        explicit BoundaryGrid(const CompactBoundary& boundary, double cells_per_curve = DEFAULT_CELLS_PER_CURVE) : BoundaryGrid{} {
+            if (boundary.empty()) return;
+            this->curve_count = boundary.size();
+            BoundingBox2D box = boundary.bbox();
+            double scale = std::max({std::abs(box.xmin()), std::abs(box.ymin()), std::abs(box.xmax()), std::abs(box.ymax()), 1.0});
+            double pad = GRID_EPSILON * scale;
+            this->grid_xmin = box.xmin() - pad;
+            this->grid_ymin = box.ymin() - pad;
+            this->grid_xmax = box.xmax() + pad;
+            this->grid_ymax = box.ymax() + pad;
+
+            // Choose square cells so the total is close to the requested density
+            double width = this->grid_xmax - this->grid_xmin, height = this->grid_ymax - this->grid_ymin;
+            double target = std::max(cells_per_curve * static_cast<double>(boundary.size()), 1.0);
+            double side = std::sqrt(width * height / target);
+            if (!(side > 0.0)) side = std::max({width, height, 1.0});
+            this->column_count = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(width / side)), 1, MAX_CELLS_PER_AXIS);
+            this->row_count = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(height / side)), 1, MAX_CELLS_PER_AXIS);
+            this->cell_width = width / static_cast<double>(this->column_count);
+            this->cell_height = height / static_cast<double>(this->row_count);
+
+            // Count, then fill, the curves overlapping each cell
+            auto cell_range = [this, &boundary, pad](std::size_t curve) {
+                BoundingBox2D curve_box = boundary.box(curve);
+                return std::array<std::size_t, 4>{
+                    this->columnOf(curve_box.xmin() - pad), this->rowOf(curve_box.ymin() - pad),
+                    this->columnOf(curve_box.xmax() + pad), this->rowOf(curve_box.ymax() + pad)
+                };
+            };
+            this->cell_offsets.assign(this->column_count * this->row_count + 1, 0);
+            for (std::size_t curve = 0; curve < boundary.size(); ++curve) {
+                auto [column_min, row_min, column_max, row_max] = cell_range(curve);
+                for (std::size_t row = row_min; row <= row_max; ++row) {
+                    for (std::size_t column = column_min; column <= column_max; ++column) this->cell_offsets[row * this->column_count + column + 1]++;
+                }
+            }
+            for (std::size_t cell = 1; cell < this->cell_offsets.size(); ++cell) this->cell_offsets[cell] += this->cell_offsets[cell - 1];
+            this->cell_curves.resize(this->cell_offsets.back());
+            std::vector<std::uint32_t> cursor(this->cell_offsets.begin(), this->cell_offsets.end() - 1);
+            for (std::size_t curve = 0; curve < boundary.size(); ++curve) {
+                auto [column_min, row_min, column_max, row_max] = cell_range(curve);
+                for (std::size_t row = row_min; row <= row_max; ++row) {
+                    for (std::size_t column = column_min; column <= column_max; ++column) this->cell_curves[cursor[row * this->column_count + column]++] = static_cast<std::uint32_t>(curve);
+                }
+            }
+        }
+
+        /** @brief Number of cell columns. */
+        std::size_t columns() const noexcept { return this->column_count; }
+        /** @brief Number of cell rows. */
+        std::size_t rows() const noexcept { return this->row_count; }
+        /** @brief Total number of curve entries across all cells. */
+        std::size_t entries() const noexcept { return this->cell_curves.size(); }
+        /** @brief Footprint of the cell offsets and curve lists. */
+        memory::MemoryUsage memoryUsage() const noexcept {
+            return memory::MemoryUsage{memory::container_bytes(this->cell_offsets) + memory::container_bytes(this->cell_curves), 0, 0};
+        }
+
+        /** @brief Indices of the curves bucketed into the cell at (`column`, `row`). */
+        std::span<const std::uint32_t> cell(std::size_t column, std::size_t row) const {
+            std::size_t index = row * this->column_count + column;
+            return std::span<const std::uint32_t>{this->cell_curves.data() + this->cell_offsets[index], this->cell_curves.data() + this->cell_offsets[index + 1]};
+        }
+
+        /**
+         * @brief Walk the cells crossed by the segment from `a` to `b` in order along it.
+         *
+         * The segment is clipped to the grid first. Each cell is reported with the parameter range
+         * `[t_enter, t_exit]` (in `[0, 1]` along the segment) it covers.
+         *
+         * @param visit Callable taking column, row, `t_enter`, and `t_exit`; returning `false` stops the walk.
+         */
+        template <typename Visit>
+        void traverse(const Point2D& a, const Point2D& b, const Visit& visit) const {
+            if (this->column_count == 0) return;
+            double ax = CGAL::to_double(a.x()), ay = CGAL::to_double(a.y());
+            double dx = CGAL::to_double(b.x()) - ax, dy = CGAL::to_double(b.y()) - ay;
+
+            // Clip the segment to the grid with the slab method
+            double t_enter = 0.0, t_end = 1.0;
+            auto clip = [&t_enter, &t_end](double origin, double delta, double low, double high) {
+                if (delta == 0.0) return low <= origin && origin <= high;
+                double t_low = (low - origin) / delta, t_high = (high - origin) / delta;
+                if (t_low > t_high) std::swap(t_low, t_high);
+                t_enter = std::max(t_enter, t_low);
+                t_end = std::min(t_end, t_high);
+                return t_enter <= t_end;
+            };
+            if (!clip(ax, dx, this->grid_xmin, this->grid_xmax) || !clip(ay, dy, this->grid_ymin, this->grid_ymax)) return;
+
+            std::size_t column = this->columnOf(ax + t_enter * dx);
+            std::size_t row = this->rowOf(ay + t_enter * dy);
+            const double infinity = std::numeric_limits<double>::infinity();
+            // Parameter at which the segment next crosses a column or row boundary, and the parameter spacing between boundaries
+            double t_next_x = infinity, t_delta_x = infinity;
+            double t_next_y = infinity, t_delta_y = infinity;
+            if (dx != 0.0) {
+                double boundary_x = this->grid_xmin + static_cast<double>(column + (dx > 0 ? 1 : 0)) * this->cell_width;
+                t_next_x = (boundary_x - ax) / dx;
+                t_delta_x = this->cell_width / std::abs(dx);
+            }
+            if (dy != 0.0) {
+                double boundary_y = this->grid_ymin + static_cast<double>(row + (dy > 0 ? 1 : 0)) * this->cell_height;
+                t_next_y = (boundary_y - ay) / dy;
+                t_delta_y = this->cell_height / std::abs(dy);
+            }
+
+            while (true) {
+                double t_exit = std::min({t_next_x, t_next_y, t_end});
+                if (!visit(column, row, t_enter, t_exit)) return;
+                if (t_exit >= t_end) return;
+                if (t_next_x < t_next_y) {
+                    if (dx > 0 ? column + 1 >= this->column_count : column == 0) return;
+                    column = dx > 0 ? column + 1 : column - 1;
+                    t_enter = t_next_x;
+                    t_next_x += t_delta_x;
+                } else {
+                    if (dy > 0 ? row + 1 >= this->row_count : row == 0) return;
+                    row = dy > 0 ? row + 1 : row - 1;
+                    t_enter = t_next_y;
+                    t_next_y += t_delta_y;
+                }
+            }
+        }
+
+        /**
+         * @brief Visit, once each, every curve bucketed into a cell crossed by the segment from `a` to `b`.
+         * @param visit Callable taking a `std::size_t` curve index.
+         */
+        template <typename Visit>
+        void segmentCandidates(const Point2D& a, const Point2D& b, const Visit& visit) const {
+            VisitedCurves& visited = visitedCurves();
+            std::uint32_t query = visited.begin(this->curve_count);
+            this->traverse(a, b, [this, &visited, query, &visit](std::size_t column, std::size_t row, double, double) {
+                for (std::uint32_t curve : this->cell(column, row)) {
+                    if (!visited.insert(curve, query)) continue;
+                    visit(static_cast<std::size_t>(curve));
+                }
+                return true;
+            });
+        }
+
+        /**
+         * @brief Append the distinct points where `path` meets `boundary`, excluding `excluded`.
+         *
+         * Same result as @ref CompactBoundary::segmentIntersections, with candidates drawn from the grid.
+         *
+         * @return Number of points appended.
+         */
+        template <typename OutputIteratorCollection>
+        std::size_t segmentIntersections(const CompactBoundary& boundary, const Segment2D& path, const Point2D& excluded, std::back_insert_iterator<OutputIteratorCollection>& output) const {
+            return boundary.segmentIntersections(path, excluded, output, [this](const Point2D& a, const Point2D& b, const auto& visit) {
+                this->segmentCandidates(a, b, visit);
+            });
+        }
+
+        /**
+         * @brief Point where `path` first meets `boundary` after leaving `path.source()`, excluding `excluded`.
+         *
+         * Cells are refined in the order the segment crosses them, and the walk stops once the
+         * closest exact hit so far lies before the exit of the current cell, since every hit not yet
+         * examined lies in a later cell.
+         *
+         * @return Same point as @ref CompactBoundary::firstSegmentIntersection, or `std::nullopt` if there is none.
+         */
+        std::optional<Point2D> firstSegmentIntersection(const CompactBoundary& boundary, const Segment2D& path, const Point2D& excluded) const {
+            CompactBoundary::SegmentFirstHit first_hit{path, excluded};
+            MonotoneCurve2D query_curve = construct_curve(path);
+            VisitedCurves& visited = visitedCurves();
+            std::uint32_t query = visited.begin(this->curve_count);
+            this->traverse(path.source(), path.target(), [this, &boundary, &first_hit, &query_curve, &visited, query](std::size_t column, std::size_t row, double, double t_exit) {
+                for (std::uint32_t curve : this->cell(column, row)) {
+                    if (!visited.insert(curve, query)) continue;
+                    boundary.refine(curve, query_curve, [&first_hit](const CurvedTraits::Point_2& point) { first_hit.offer(point); });
+                }
+                return !first_hit.certifiedBefore(t_exit);
+            });
+            return first_hit.best;
+        }
+    };
+
+}
+
+#endif
@@ -11,11 +11,12 @@
  * geometry validation.
  */
 
-#ifndef BURST_DISABLE_WARNINGS
 #include <string_view>
 #include <source_location>
 #include <iostream>
 
+#ifndef BURST_DISABLE_WARNINGS
+
 /** @brief Emit a warning to an arbitrary `std::ostream`. */
 inline void burst_warning_to(const std::string_view& msg, std::ostream& stream, const std::source_location& location = std::source_location::current()) {
     stream << "[BURST] Warning:\t" << msg << '\n'
@@ -38,9 +39,6 @@ inline void burst_warning(const std::string_view& msg, const std::source_locatio
 #endif
 
 #ifndef BURST_DISABLE_ERRORS
-#include <string_view>
-#include <source_location>
-#include <iostream>
 
 /** @brief Emit an error to an arbitrary `std::ostream`. */
 inline void burst_error_to(const std::string_view& msg, std::ostream& stream, const std::source_location& location = std::source_location::current()) {
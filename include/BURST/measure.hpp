@@ -0,0 +1,145 @@
+#ifndef BURST_MEASURE_HPP
+#define BURST_MEASURE_HPP
+
+#include <cmath>
+#include <concepts>
+#include <iterator>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/multiprecision/mpfr.hpp>
+
+#include "numeric.hpp"
+#include "geometry.hpp"
+
+/**
+ * @file measure.hpp
+ * @brief Area and perimeter of bounded curvilinear polygon sets.
+ */
+
+namespace BURST::geometry {
+
+    /** @brief Area and perimeter of a polygon set in the scalar type `Real`. */
+    template <typename Real>
+    struct ShapeMeasure {
+        Real area;
+        Real perimeter;
+    };
+
+    /** @brief Scalar types a polygon set can be measured in: high precision or fast double. */
+    template <typename Real>
+    concept valid_measure_type = std::same_as<Real, numeric::hpscalar> || std::same_as<Real, double>;
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        // Visit every curve of every loop (outer boundaries and holes) of the bounded faces of `shape`
+        template <typename Visit>
+        void for_each_loop_curve(const CurvilinearPolygonSet2D& shape, const Visit& visit) {
+            boost::container::small_vector<HoledCurvilinearPolygon2D, 1> polygons;
+            shape.polygons_with_holes(std::back_inserter(polygons));
+            for (const HoledCurvilinearPolygon2D& polygon : polygons) {
+                for (auto curve_it = polygon.outer_boundary().curves_begin(); curve_it != polygon.outer_boundary().curves_end(); ++curve_it) visit(*curve_it);
+                for (auto hole_it = polygon.holes_begin(); hole_it != polygon.holes_end(); ++hole_it) {
+                    for (auto curve_it = hole_it->curves_begin(); curve_it != hole_it->curves_end(); ++curve_it) visit(*curve_it);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Area and perimeter of the bounded faces of `shape`.
+     *
+     * Every loop contributes the signed shoelace term of its curve chords, and every arc adds the
+     * signed circular segment between its chord and itself, `r^2 (theta - sin theta) / 2`. Holes
+     * are oriented clockwise, so their contributions subtract. In @ref numeric::hpscalar mode the
+     * chord sum is exact in @ref numeric::fscalar and only the arc angles and square roots are
+     * evaluated with MPFR; in `double` mode everything is evaluated in doubles.
+     *
+     * Unbounded faces have no outer boundary and are not measured.
+     *
+     * @tparam Real @ref numeric::hpscalar (default) or `double`.
+     * @return Area and perimeter of `shape`.
+     */
+    template <valid_measure_type Real = numeric::hpscalar>
+    ShapeMeasure<Real> measure(const CurvilinearPolygonSet2D& shape) {
+        using traits_point_t = CurvedTraits::Point_2;
+        using converted_ft = decltype(std::declval<traits_point_t>().x());
+        using std::abs;
+        using std::atan2;
+        using std::sqrt;
+        using boost::multiprecision::abs;
+        using boost::multiprecision::atan2;
+        using boost::multiprecision::sqrt;
+        constexpr bool exact = std::same_as<Real, numeric::hpscalar>;
+
+        numeric::fscalar exact_twice_chords = 0;
+        Real twice_chords = 0;
+        Real arc_segments = 0;
+        Real perimeter = 0;
+        detail::for_each_loop_curve(shape, [&](const MonotoneCurve2D& curve) {
+            Real sx, sy, tx, ty;
+            if constexpr (exact) {
+                Point2D source = convert_point<Point2D, traits_point_t>(curve.source(), numeric::sqrt_to_fscalar<converted_ft>);
+                Point2D target = convert_point<Point2D, traits_point_t>(curve.target(), numeric::sqrt_to_fscalar<converted_ft>);
+                exact_twice_chords += source.x() * target.y() - target.x() * source.y();
+                sx = numeric::to_high_precision(source.x());
+                sy = numeric::to_high_precision(source.y());
+                tx = numeric::to_high_precision(target.x());
+                ty = numeric::to_high_precision(target.y());
+            } else {
+                sx = CGAL::to_double(curve.source().x());
+                sy = CGAL::to_double(curve.source().y());
+                tx = CGAL::to_double(curve.target().x());
+                ty = CGAL::to_double(curve.target().y());
+                twice_chords += sx * ty - tx * sy;
+            }
+
+            if (!curve.is_circular()) {
+                perimeter += sqrt((tx - sx) * (tx - sx) + (ty - sy) * (ty - sy));
+                return;
+            }
+            // Angle swept from source to target in the arc's direction; x-monotone arcs sweep (0, pi]
+            Real cx, cy, squared_radius;
+            if constexpr (exact) {
+                cx = numeric::to_high_precision(curve.supporting_circle().center().x());
+                cy = numeric::to_high_precision(curve.supporting_circle().center().y());
+                squared_radius = numeric::to_high_precision(curve.supporting_circle().squared_radius());
+            } else {
+                cx = CGAL::to_double(curve.supporting_circle().center().x());
+                cy = CGAL::to_double(curve.supporting_circle().center().y());
+                squared_radius = CGAL::to_double(curve.supporting_circle().squared_radius());
+            }
+            int sense = curve.orientation() == CGAL::COUNTERCLOCKWISE ? 1 : -1;
+            // The sign of the cross product carries no information within (0, pi], and is -0 for a semicircle
+            Real cross = abs((sx - cx) * (ty - cy) - (sy - cy) * (tx - cx));
+            Real dot = (sx - cx) * (tx - cx) + (sy - cy) * (ty - cy);
+            Real sweep = atan2(cross, dot);
+            // sin(sweep) is cross / r^2, so the segment area needs no further trigonometry
+            arc_segments += sense * (squared_radius * sweep - cross) / 2;
+            perimeter += sqrt(squared_radius) * sweep;
+        });
+
+        if constexpr (exact) twice_chords = numeric::to_high_precision(exact_twice_chords);
+        return ShapeMeasure<Real>{twice_chords / 2 + arc_segments, perimeter};
+    }
+
+    /**
+     * @brief Area of the bounded faces of `shape`; see @ref measure.
+     * @tparam Real @ref numeric::hpscalar (default) or `double`.
+     */
+    template <valid_measure_type Real = numeric::hpscalar>
+    Real area(const CurvilinearPolygonSet2D& shape) {
+        return measure<Real>(shape).area;
+    }
+
+    /**
+     * @brief Total boundary length of the bounded faces of `shape`, holes included; see @ref measure.
+     * @tparam Real @ref numeric::hpscalar (default) or `double`.
+     */
+    template <valid_measure_type Real = numeric::hpscalar>
+    Real perimeter(const CurvilinearPolygonSet2D& shape) {
+        return measure<Real>(shape).perimeter;
+    }
+
+}
+
+#endif
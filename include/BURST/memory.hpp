@@ -0,0 +1,346 @@
+#ifndef BURST_MEMORY_HPP
+#define BURST_MEMORY_HPP
+
+/**
+ * @file memory.hpp
+ * @brief Per-thread monotonic arena for short-lived query structures.
+ *
+ * Ray casts along curved paths build a whole CGAL arrangement only to discard it at the end of
+ * the call. @ref BURST::memory::ArenaAllocator serves such temporaries from a thread-local
+ * @ref BURST::memory::Arena while an @ref BURST::memory::ArenaScope is open, and the arena is
+ * rewound in one step when the outermost scope closes instead of freeing every node individually.
+ * Outside of a scope the allocator falls back to the global heap, so arena-backed containers stay
+ * usable anywhere.
+ *
+ * Library queries only route their temporaries through the arena when `BURST_ENABLE_ARENA` is
+ * defined (see @ref BURST::geometry::ConfigurationSpace::intersection); the arena types themselves
+ * are always available.
+ * Arrangements backed by the arena are declared in arena_arrangement.hpp.
+ *
+ * Long-lived structures report their footprint as a @ref BURST::memory::MemoryUsage through
+ * their `memoryUsage()` members.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <map>
+#include <vector>
+#include <algorithm>
+
+namespace BURST::memory {
+
+    /** @brief Size of the first block an arena reserves; later blocks double in size. */
+    constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    /** @brief Allocation counters for one thread's arena, accumulated since the last @ref reset_stats. */
+    struct ArenaStats {
+        std::size_t allocations = 0;        /**< Requests served from the arena. */
+        std::size_t heap_allocations = 0;   /**< Requests served by the heap fallback (no open scope). */
+        std::size_t bytes_allocated = 0;    /**< Bytes handed out by the arena, including alignment padding. */
+        std::size_t peak_bytes = 0;         /**< Largest number of bytes in use between two resets. */
+        std::size_t bytes_reserved = 0;     /**< Bytes currently held in arena blocks. */
+        std::size_t resets = 0;             /**< Number of times the arena was rewound. */
+    };
+
+    /**
+     * @brief Monotonic bump allocator over a list of geometrically growing blocks.
+     *
+     * Deallocation is a no-op; memory is reclaimed all at once by @ref reset, which keeps the
+     * largest block so a steady stream of similar queries stops touching the heap entirely.
+     * An arena is not thread-safe and is intended to be used through @ref thread_arena.
+     */
+    class Arena {
+    private:
+        struct Block {
+            std::unique_ptr<std::byte[]> data;
+            std::size_t size;
+        };
+
+        std::vector<Block> blocks;
+        std::size_t current;
+        std::size_t offset;
+        std::size_t in_use;
+        std::size_t block_size;
+        ArenaStats statistics;
+
+        // Append a block large enough for `bytes` with worst-case alignment padding
+        void grow(std::size_t bytes, std::size_t alignment) {
+            std::size_t size = std::max(this->block_size, bytes + alignment);
+            this->blocks.push_back(Block{std::make_unique<std::byte[]>(size), size});
+            this->statistics.bytes_reserved += size;
+            this->block_size = size * 2;
+            this->current = this->blocks.size() - 1;
+            this->offset = 0;
+        }
+
+    public:
+        explicit Arena(std::size_t initial_block_size = DEFAULT_BLOCK_SIZE) : blocks{}, current{0}, offset{0}, in_use{0}, block_size{std::max<std::size_t>(initial_block_size, 64)}, statistics{} {}
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * @brief Reserve `bytes` aligned to `alignment` (a power of two).
+         * @return Pointer into an arena block, valid until the next @ref reset.
+         */
+        void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+            bytes = std::max<std::size_t>(bytes, 1);
+            while (true) {
+                if (this->current < this->blocks.size()) {
+                    Block& block = this->blocks[this->current];
+                    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+                    std::uintptr_t aligned = (base + this->offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+                    std::size_t end = static_cast<std::size_t>(aligned - base) + bytes;
+                    if (end <= block.size) {
+                        std::size_t used = end - this->offset;
+                        this->offset = end;
+                        this->in_use += used;
+                        this->statistics.allocations++;
+                        this->statistics.bytes_allocated += used;
+                        this->statistics.peak_bytes = std::max(this->statistics.peak_bytes, this->in_use);
+                        return reinterpret_cast<void*>(aligned);
+                    }
+                    // Move on to the next retained block before growing
+                    if (this->current + 1 < this->blocks.size()) {
+                        this->current++;
+                        this->offset = 0;
+                        continue;
+                    }
+                }
+                this->grow(bytes, alignment);
+            }
+        }
+
+        /** @brief Whether `pointer` lies inside one of this arena's blocks. */
+        bool owns(const void* pointer) const noexcept {
+            const std::byte* address = static_cast<const std::byte*>(pointer);
+            for (const Block& block : this->blocks) {
+                if (address >= block.data.get() && address < block.data.get() + block.size) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Invalidate every allocation and rewind to the start of the largest block.
+         *
+         * Smaller blocks are released so that the arena converges on one block sized for the
+         * typical query.
+         */
+        void reset() {
+            if (this->blocks.size() > 1) {
+                auto largest = std::max_element(this->blocks.begin(), this->blocks.end(), [](const Block& a, const Block& b) { return a.size < b.size; });
+                Block kept = std::move(*largest);
+                this->blocks.clear();
+                this->blocks.push_back(std::move(kept));
+                this->statistics.bytes_reserved = this->blocks.front().size;
+            }
+            this->current = 0;
+            this->offset = 0;
+            this->in_use = 0;
+            this->statistics.resets++;
+        }
+
+        /** @brief Release every block back to the heap. */
+        void release() {
+            this->blocks.clear();
+            this->current = 0;
+            this->offset = 0;
+            this->in_use = 0;
+            this->statistics.bytes_reserved = 0;
+        }
+
+        /** @brief Bytes handed out since the last reset. */
+        std::size_t used() const noexcept {
+            return this->in_use;
+        }
+
+        /** @brief Counters accumulated since construction or the last @ref resetStats. */
+        const ArenaStats& stats() const noexcept {
+            return this->statistics;
+        }
+
+        /** @brief Zero every counter except the bytes currently reserved. */
+        void resetStats() noexcept {
+            std::size_t reserved = this->statistics.bytes_reserved;
+            this->statistics = ArenaStats{};
+            this->statistics.bytes_reserved = reserved;
+            this->statistics.peak_bytes = this->in_use;
+        }
+
+        // Heap fallback requests are counted here so a single report covers both paths
+        void countHeapAllocation() noexcept {
+            this->statistics.heap_allocations++;
+        }
+    };
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        struct ThreadArena {
+            Arena arena;
+            std::size_t depth = 0;
+        };
+
+        inline ThreadArena& thread_state() {
+            thread_local ThreadArena state;
+            return state;
+        }
+    }
+
+    /** @brief The calling thread's arena. */
+    inline Arena& thread_arena() {
+        return detail::thread_state().arena;
+    }
+
+    /** @brief Whether an @ref ArenaScope is open on the calling thread. */
+    inline bool scope_active() {
+        return detail::thread_state().depth > 0;
+    }
+
+    /**
+     * @brief Counters of the calling thread's arena.
+     * @return Snapshot of the counters.
+     */
+    inline ArenaStats stats() {
+        return thread_arena().stats();
+    }
+
+    /** @brief Zero the calling thread's arena counters. */
+    inline void reset_stats() {
+        thread_arena().resetStats();
+    }
+
+    /**
+     * @brief RAII region during which @ref ArenaAllocator serves requests from the thread arena.
+     *
+     * Scopes nest; the arena is rewound when the outermost scope on the thread closes. Every
+     * arena-backed object created inside a scope must be destroyed before that scope closes and
+     * must not be handed to another thread.
+     */
+    class ArenaScope {
+    public:
+        ArenaScope() noexcept {
+            detail::thread_state().depth++;
+        }
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+        ~ArenaScope() {
+            detail::ThreadArena& state = detail::thread_state();
+            if (--state.depth == 0) state.arena.reset();
+        }
+    };
+
+    /**
+     * @brief Stateless allocator backed by the calling thread's arena while a scope is open.
+     *
+     * Without an open @ref ArenaScope requests go to the global heap. Deallocation checks which
+     * of the two the pointer came from, so mixing both within one container is safe.
+     *
+     * @tparam T Value type.
+     */
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        ArenaAllocator() noexcept = default;
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t count) {
+            detail::ThreadArena& state = detail::thread_state();
+            if (state.depth > 0) return static_cast<T*>(state.arena.allocate(count * sizeof(T), alignof(T)));
+            state.arena.countHeapAllocation();
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept {
+            // Arena memory is reclaimed when the scope closes
+            if (thread_arena().owns(pointer)) return;
+            ::operator delete(pointer, count * sizeof(T), std::align_val_t{alignof(T)});
+        }
+
+        template <typename U>
+        bool operator==(const ArenaAllocator<U>&) const noexcept { return true; }
+        template <typename U>
+        bool operator!=(const ArenaAllocator<U>&) const noexcept { return false; }
+    };
+
+    /**
+     * @brief Estimated bytes held by a data structure, split by kind of storage.
+     *
+     * Container and record sizes are exact up to allocator overhead. Exact numbers live in
+     * reference-counted nodes whose size depends on how much of their construction history has been
+     * evaluated, so that part is estimated with @ref EXACT_POINT_BYTES and @ref EXACT_CURVE_BYTES.
+     * Copies of a structure share those nodes, so adding up the usage of structures built from one
+     * another (a coverage accumulator and its configuration space, say) overestimates the total.
+     * Shared members held through `std::shared_ptr`, such as a robot's configuration space, are not
+     * included.
+     */
+    struct MemoryUsage {
+        std::size_t structure = 0;      ///< Object bodies, containers, and double-precision indices
+        std::size_t arrangement = 0;    ///< Arrangement records with the points and curves they store
+        std::size_t exact = 0;          ///< Exact-number storage behind points and curves (estimated)
+
+        /** @brief Total estimated bytes. */
+        std::size_t total() const noexcept {
+            return this->structure + this->arrangement + this->exact;
+        }
+        MemoryUsage& operator+=(const MemoryUsage& other) noexcept {
+            this->structure += other.structure;
+            this->arrangement += other.arrangement;
+            this->exact += other.exact;
+            return *this;
+        }
+        friend MemoryUsage operator+(MemoryUsage a, const MemoryUsage& b) noexcept {
+            return a += b;
+        }
+        bool operator==(const MemoryUsage&) const = default;
+    };
+
+    /** @brief Estimated exact-number bytes behind one point: its lazy node with interval approximations, and exact coordinates once evaluated. */
+    constexpr std::size_t EXACT_POINT_BYTES = 160;
+    /** @brief Estimated exact-number bytes behind one scalar, such as a radius: its lazy node and interval approximation. */
+    constexpr std::size_t EXACT_SCALAR_BYTES = EXACT_POINT_BYTES / 2;
+    /** @brief Estimated exact-number bytes behind one curve beyond its endpoints: its supporting line or circle. */
+    constexpr std::size_t EXACT_CURVE_BYTES = 192;
+    /** @brief Estimated per-node bookkeeping of a node-based standard container (links and colour). */
+    constexpr std::size_t NODE_OVERHEAD_BYTES = 4 * sizeof(void*);
+
+    /** @brief Bytes reserved by the elements of `vector`. */
+    template <typename T, typename A>
+    std::size_t container_bytes(const std::vector<T, A>& vector) noexcept {
+        return vector.capacity() * sizeof(T);
+    }
+    /** @brief Bytes reserved by the bits of `vector`. */
+    template <typename A>
+    std::size_t container_bytes(const std::vector<bool, A>& vector) noexcept {
+        return (vector.capacity() + 7) / 8;
+    }
+    /** @brief Bytes of the nodes of `map`, excluding anything its elements own. */
+    template <typename K, typename V, typename C, typename A>
+    std::size_t container_bytes(const std::map<K, V, C, A>& map) noexcept {
+        return map.size() * (sizeof(typename std::map<K, V, C, A>::value_type) + NODE_OVERHEAD_BYTES);
+    }
+
+    /**
+     * @brief Estimated footprint of `arrangement`: its DCEL records, stored points and curves, and their exact numbers.
+     * @tparam Arrangement A `CGAL::Arrangement_2`, e.g. the arrangement of a polygon set.
+     */
+    template <typename Arrangement>
+    MemoryUsage arrangement_usage(const Arrangement& arrangement) {
+        using Dcel = typename Arrangement::Dcel;
+        std::size_t vertices = arrangement.number_of_vertices();
+        std::size_t edges = arrangement.number_of_edges();
+        MemoryUsage usage;
+        usage.arrangement = vertices * (sizeof(typename Dcel::Vertex) + sizeof(typename Arrangement::Point_2))
+                          + 2 * edges * sizeof(typename Dcel::Halfedge)
+                          + edges * sizeof(typename Arrangement::X_monotone_curve_2)
+                          + arrangement.number_of_faces() * sizeof(typename Dcel::Face);
+        usage.exact = vertices * EXACT_POINT_BYTES + edges * EXACT_CURVE_BYTES;
+        return usage;
+    }
+
+}
+
+#endif
@@ -133,20 +133,28 @@ namespace BURST::models {
             // Create a trajectory from the origin and direction vector
             Trajectory trajectory{origin, direction_vector};
 
-            // Create a vector to store the intersection points since there can be multiple with a curvilinear polygon
-            std::vector<geometry::Point2D> intersection_points;
-            // Get the intersection of the trajectory with the configuration space boundary
-            size_t intersection_count = configuration_space.intersection<Trajectory, Path>(trajectory, std::back_inserter(intersection_points));
+            // The closest intersection to the point of origin is the endpoint
+            std::optional<geometry::Point2D> closest;
+            if constexpr (std::same_as<Path, geometry::Segment2D>) {
+                // Straight paths let the boundary index stop at the first certified hit
+                closest = configuration_space.firstIntersection<Trajectory>(trajectory);
+            } else {
+                // Create a vector to store the intersection points since there can be multiple with a curvilinear polygon
+                std::vector<geometry::Point2D> intersection_points;
+                // Get the intersection of the trajectory with the configuration space boundary
+                configuration_space.intersection<Trajectory, Path>(trajectory, std::back_inserter(intersection_points));
+                if (!intersection_points.empty()) {
+                    closest = *std::min_element(intersection_points.begin(), intersection_points.end(), [&origin](const geometry::Point2D& a, const geometry::Point2D& b) {
+                        return CGAL::squared_distance(a, origin) < CGAL::squared_distance(b, origin);
+                    });
+                }
+            }
             // If there are no intersections, then the path is invalid, so return nullopt
-            if (intersection_count == 0) {
+            if (!closest) {
                 burst_error("Trajectory does not intersect with the configuration space boundary, path is invalid", location);
                 return std::nullopt;
             }
-            // The closest intersection to the point of origin is the endpoint
-            // This should never throw since there's already a check for no intersections
-            geometry::Point2D endpoint = *std::min_element(intersection_points.begin(), intersection_points.end(), [&origin](const geometry::Point2D& a, const geometry::Point2D& b) {
-                return CGAL::squared_distance(a, origin) < CGAL::squared_distance(b, origin);
-            });
+            geometry::Point2D endpoint = *closest;
 
             // Check if the trajectory points inward or outward from the configuration space
             // This can be done by computing the midpoint of the trajectory from the origin to the endpoint and checking if it lies inside the configuration space
@@ -184,6 +192,95 @@ namespace BURST::models {
 
     /** @brief Standard motion model: infinite ray trajectory clipped to a straight segment path. */
     using LinearMovementModel = MovementModel<geometry::Ray2D, geometry::Segment2D>;
+
+    /**
+     * @brief Movement along constant-curvature arcs tangent to the commanded heading.
+     *
+     * The robot leaves `origin` along the heading and turns with the model's signed curvature
+     * (positive turns counterclockwise) until it first meets the boundary, as resolved natively by
+     * @ref geometry::ConfigurationSpace::firstIntersection for an @ref geometry::ArcTrajectory.
+     * A motion is inward when the midpoint of the travelled arc lies inside the configuration space.
+     * Zero curvature behaves exactly like @ref LinearMovementModel.
+     *
+     * @tparam Path Path type for the chord joining start and end boundary points returned by @ref path.
+     */
+    template <geometry::valid_path_type Path>
+    class MovementModel<geometry::ArcTrajectory, Path> {
+    private:
+        numeric::fscalar curvature;
+
+    public:
+        /** @param curvature Signed curvature (inverse turning radius) of every motion. */
+        MovementModel(numeric::fscalar curvature = 0) : curvature{curvature} {}
+
+        /** @brief Signed curvature of every motion. */
+        const numeric::fscalar& getCurvature() const noexcept {
+            return this->curvature;
+        }
+
+        /**
+         * @brief Resolve the endpoint of a valid inward arc motion, if one exists.
+         * @param origin Point on the configuration-space boundary (see @ref geometry::ConfigurationSpace::onEdge).
+         * @param angle Initial heading in radians.
+         * @param configuration_space Configuration space for the robot.
+         * @return Endpoint on the boundary if the motion is valid, `std::nullopt` otherwise.
+         */
+        std::optional<geometry::Point2D> operator()(const geometry::Point2D& origin, numeric::fscalar angle, const BURST::geometry::ConfigurationSpace& configuration_space, const std::source_location location = std::source_location::current()) const noexcept {
+            // Straight motion is resolved exactly as the linear model resolves it
+            if (this->curvature == 0) return MovementModel<geometry::Ray2D, Path>{}(origin, angle, configuration_space, location);
+
+            // If the origin doesn't lie on the configuration space boundary, then the path is invalid, so return nullopt
+            if (!configuration_space.onEdge(origin)) {
+                burst_error("Origin point does not lie on the configuration space boundary, path is invalid", location);
+                return std::nullopt;
+            }
+
+            // Create the arc trajectory tangent to the heading
+            numeric::hpscalar hp_angle = numeric::to_high_precision(angle);
+            geometry::Vector2D direction_vector{boost::multiprecision::cos(hp_angle), boost::multiprecision::sin(hp_angle)};
+            geometry::ArcTrajectory trajectory{origin, direction_vector, this->curvature};
+
+            // The first hit along the arc is the endpoint
+            std::optional<geometry::Point2D> closest = configuration_space.firstIntersection(trajectory);
+            if (!closest) {
+                burst_error("Trajectory does not intersect with the configuration space boundary, path is invalid", location);
+                return std::nullopt;
+            }
+            geometry::Point2D endpoint = *closest;
+
+            // The travelled arc points inward if its midpoint lies inside the configuration space
+            // The midpoint is along the bisector of the two radii, flipped when the arc turns through more than half the circle
+            const geometry::Point2D& center = trajectory.center();
+            geometry::Vector2D start = origin - center, end = endpoint - center;
+            int sense = trajectory.orientation() == CGAL::COUNTERCLOCKWISE ? 1 : -1;
+            int turn = sense * CGAL::sign(start.x() * end.y() - start.y() * end.x());
+            geometry::Vector2D bisector = turn > 0 ? start + end : (turn < 0 ? -(start + end) : geometry::Vector2D{-start.y(), start.x()} * sense);
+            geometry::Point2D midpoint = center + bisector * (CGAL::sqrt(trajectory.squaredRadius()) / CGAL::sqrt(bisector.squared_length()));
+            if (configuration_space.contains(midpoint)) {
+                return endpoint;
+            } else {
+                burst_error("Trajectory points outward from the configuration space, path is invalid", location);
+                return std::nullopt;
+            }
+        }
+
+        /**
+         * @brief Same as @ref operator() but returns the `Path` chord from `origin` to the endpoint.
+         * @return Chord from `origin` to endpoint if valid and non-degenerate, `std::nullopt` otherwise.
+         */
+        std::optional<Path> path(const geometry::Point2D& origin, numeric::fscalar angle, const BURST::geometry::ConfigurationSpace& configuration_space, const std::source_location location = std::source_location::current()) const noexcept {
+            std::optional<geometry::Point2D> maybe_endpoint = (*this)(origin, angle, configuration_space, location);
+            if (!maybe_endpoint.has_value()) return std::nullopt;
+            if (*maybe_endpoint == origin) {
+                burst_error("Origin and endpoint of the path are the same, path is invalid", location);
+                return std::nullopt;
+            }
+            return Path{origin, *maybe_endpoint};
+        }
+    };
+
+    /** @brief Constant-curvature motion model; construct it with the turning curvature. */
+    using ArcMovementModel = MovementModel<geometry::ArcTrajectory, geometry::Segment2D>;
     
     namespace detail {
         template <typename T>
@@ -195,6 +292,13 @@ namespace BURST::models {
     /** @brief True if `M` is some `MovementModel<Trajectory, Path>` specialization. */
     template <typename M>
     concept valid_movement_model = detail::is_valid_movement_model<M>::value;
+
+#ifdef BURST_EXTERN_TEMPLATES
+    // Default models are instantiated once in the compiled BURST library (src/instantiations.cpp)
+    extern template class RotationModel<std::mt19937, std::uniform_real_distribution<double>>;
+    extern template class RotationModel<std::mt19937, numeric::flat_distribution>;
+    extern template class MovementModel<geometry::Ray2D, geometry::Segment2D>;
+#endif
     
 }
 #endif
@@ -0,0 +1,193 @@
+#ifndef BURST_NUMA_HPP
+#define BURST_NUMA_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @file numa.hpp
+ * @brief NUMA node discovery and thread pinning without external dependencies.
+ *
+ * On Linux the nodes are read from sysfs and threads are pinned with `pthread_setaffinity_np`.
+ * Memory placement relies on the kernel's default first-touch policy: pages a pinned thread
+ * allocates and writes first are placed on its node. Elsewhere, or when sysfs is unavailable, the
+ * machine is reported as one node holding every CPU and pinning does nothing.
+ */
+
+namespace BURST::numa {
+
+    /**
+     * @brief Parse a Linux CPU list such as `"0-3,8,10-11"`.
+     * @return CPU numbers in increasing order, or `std::nullopt` if `text` is malformed.
+     */
+    inline std::optional<std::vector<unsigned>> parse_cpu_list(std::string_view text) {
+        std::vector<unsigned> cpus;
+        while (!text.empty() && (text.back() == '\n' || text.back() == ' ')) text.remove_suffix(1);
+        if (text.empty()) return cpus;
+        while (true) {
+            std::size_t comma = text.find(',');
+            std::string_view range = text.substr(0, comma);
+            std::size_t dash = range.find('-');
+            unsigned first = 0;
+            unsigned last = 0;
+            auto [first_end, first_error] = std::from_chars(range.data(), range.data() + std::min(dash, range.size()), first);
+            if (first_error != std::errc{} || first_end != range.data() + std::min(dash, range.size())) return std::nullopt;
+            last = first;
+            if (dash != std::string_view::npos) {
+                auto [last_end, last_error] = std::from_chars(range.data() + dash + 1, range.data() + range.size(), last);
+                if (last_error != std::errc{} || last_end != range.data() + range.size() || last < first) return std::nullopt;
+            }
+            for (unsigned cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+            if (comma == std::string_view::npos) break;
+            text.remove_prefix(comma + 1);
+        }
+        std::ranges::sort(cpus);
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    /**
+     * @brief CPUs usable by this process, grouped by NUMA node.
+     *
+     * Only nodes with at least one CPU in the process's affinity mask are listed, so container and
+     * `taskset` restrictions are respected.
+     */
+    class Topology {
+    private:
+        std::vector<std::vector<unsigned>> node_cpus;
+
+        explicit Topology(std::vector<std::vector<unsigned>> node_cpus) noexcept : node_cpus{std::move(node_cpus)} {}
+
+        // CPUs this process may run on, or every CPU when the mask is unknown
+        static std::vector<unsigned> allowed_cpus() {
+            std::vector<unsigned> cpus;
+#if defined(__linux__)
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+                for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &mask)) cpus.push_back(cpu);
+                }
+                if (!cpus.empty()) return cpus;
+            }
+#endif
+            unsigned count = std::max(std::thread::hardware_concurrency(), 1u);
+            for (unsigned cpu = 0; cpu < count; ++cpu) cpus.push_back(cpu);
+            return cpus;
+        }
+
+        // IDs of the online nodes under `node_root` in increasing order, or `std::nullopt` if the online list is malformed
+        static std::optional<std::vector<unsigned>> online_nodes(const std::filesystem::path& node_root) {
+            std::ifstream online{node_root / "online"};
+            if (online) {
+                std::string text;
+                std::getline(online, text);
+                return parse_cpu_list(text);
+            }
+            // Without the online list, every node<N> directory is a node
+            std::vector<unsigned> ids;
+            std::error_code error;
+            for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator{node_root, error}) {
+                std::string name = entry.path().filename().string();
+                if (!name.starts_with("node") || name.size() == 4) continue;
+                unsigned id = 0;
+                auto [end, parse_error] = std::from_chars(name.data() + 4, name.data() + name.size(), id);
+                if (parse_error == std::errc{} && end == name.data() + name.size()) ids.push_back(id);
+            }
+            std::ranges::sort(ids);
+            return ids;
+        }
+
+    public:
+        /**
+         * @brief Topology from explicit per-node CPU lists, e.g. to emulate several nodes in tests.
+         * @return Topology with the non-empty lists as nodes, or a single node of all allowed CPUs if none are given.
+         */
+        static Topology fromNodes(std::vector<std::vector<unsigned>> nodes) {
+            std::erase_if(nodes, [](const std::vector<unsigned>& cpus) { return cpus.empty(); });
+            if (nodes.empty()) nodes.push_back(allowed_cpus());
+            return Topology{std::move(nodes)};
+        }
+
+        /**
+         * @brief Discover the nodes of this machine.
+         *
+         * Node IDs are taken from the `online` list, or from the `node<N>` entries when it is missing,
+         * so sparse IDs (offlined nodes, some multi-socket layouts) are all found.
+         *
+         * @param node_root sysfs directory describing the nodes (overridable for tests).
+         * @return Detected topology; a single node with every allowed CPU if detection is unsupported or fails.
+         */
+        static Topology detect(const std::filesystem::path& node_root = "/sys/devices/system/node") {
+            std::vector<unsigned> allowed = allowed_cpus();
+            std::vector<std::vector<unsigned>> nodes;
+#if defined(__linux__)
+            std::optional<std::vector<unsigned>> ids = online_nodes(node_root);
+            if (!ids) return fromNodes({});
+            for (unsigned node : *ids) {
+                std::ifstream file{node_root / ("node" + std::to_string(node)) / "cpulist"};
+                if (!file) continue;
+                std::string text;
+                std::getline(file, text);
+                std::optional<std::vector<unsigned>> cpus = parse_cpu_list(text);
+                if (!cpus) return fromNodes({});
+                std::erase_if(*cpus, [&allowed](unsigned cpu) { return !std::ranges::binary_search(allowed, cpu); });
+                nodes.push_back(std::move(*cpus));
+            }
+#else
+            (void)node_root;
+#endif
+            return fromNodes(std::move(nodes));
+        }
+
+        /** @brief Number of nodes with usable CPUs (at least 1). */
+        std::size_t nodes() const noexcept {
+            return this->node_cpus.size();
+        }
+        /** @brief Usable CPUs of node `node` (unchecked). */
+        std::span<const unsigned> cpus(std::size_t node) const noexcept {
+            return this->node_cpus[node];
+        }
+        /** @brief Whether there is more than one node, so placement can matter. */
+        bool multiNode() const noexcept {
+            return this->node_cpus.size() > 1;
+        }
+    };
+
+    /**
+     * @brief Restrict the calling thread to `cpus`.
+     * @return True if the thread was pinned, false if pinning is unsupported or failed.
+     */
+    inline bool pin_current_thread(std::span<const unsigned> cpus) {
+#if defined(__linux__)
+        if (cpus.empty()) return false;
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (unsigned cpu : cpus) {
+            if (cpu < CPU_SETSIZE) CPU_SET(cpu, &mask);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+        (void)cpus;
+        return false;
+#endif
+    }
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include <boost/multiprecision/mpfr.hpp>
 
 #include <concepts>
+#include <cstdint>
+#include <limits>
 #include <sstream>
 #include <iomanip>
 
@@ -182,6 +184,59 @@ namespace BURST::numeric {
         double max() const { return 1.0; }
     };
 
+    /**
+     * @brief SplitMix64 finaliser: a bijective mix of the bits of `value`.
+     *
+     * Nearby inputs give unrelated outputs, which makes it suitable for deriving seeds and streams.
+     */
+    constexpr std::uint64_t splitmix64(std::uint64_t value) noexcept {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Counter-based random engine: the `n`-th draw of a stream is a fixed hash of `(stream, n)`.
+     *
+     * The whole state is two integers, so per-agent streams fit in compact state arrays, can be
+     * copied freely, and can jump to any position without generating the draws before it. Draws
+     * from different streams are independent of the order in which the streams are advanced, which
+     * keeps multi-threaded runs reproducible. Satisfies @ref valid_rng and the standard
+     * UniformRandomBitGenerator requirements.
+     */
+    class CounterEngine {
+    private:
+        std::uint64_t stream_id;
+        std::uint64_t position;
+
+    public:
+        using result_type = std::uint64_t;
+
+        /**
+         * @param stream Stream identifier; distinct streams give unrelated sequences.
+         * @param counter Index of the next draw within the stream.
+         */
+        constexpr explicit CounterEngine(std::uint64_t stream = 0, std::uint64_t counter = 0) noexcept : stream_id{stream}, position{counter} {}
+
+        /** @brief Draw `counter` of `stream`, without any engine state. */
+        static constexpr result_type at(std::uint64_t stream, std::uint64_t counter) noexcept {
+            return splitmix64(splitmix64(counter * 0x9E3779B97F4A7C15ULL + splitmix64(stream)) ^ stream);
+        }
+
+        /** @brief Next draw of the stream. */
+        constexpr result_type operator()() noexcept {
+            return at(this->stream_id, this->position++);
+        }
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        /** @brief Stream identifier. */
+        constexpr std::uint64_t stream() const noexcept { return this->stream_id; }
+        /** @brief Index of the next draw. */
+        constexpr std::uint64_t counter() const noexcept { return this->position; }
+    };
+
 }
 
 #endif
@@ -0,0 +1,342 @@
+#ifndef BURST_PIPELINE_HPP
+#define BURST_PIPELINE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <source_location>
+
+#include "geometry.hpp"
+#include "numeric.hpp"
+#include "robot.hpp"
+#include "coverage.hpp"
+#include "logging.hpp"
+#include "tracing.hpp"
+
+/**
+ * @file pipeline.hpp
+ * @brief Pipelined runs: motion threads feed coverage, recording, and statistics stages through bounded lock-free queues.
+ */
+
+namespace BURST {
+
+    /**
+     * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+     *
+     * A ring buffer with one slot left empty to tell full from empty. The producer owns the tail
+     * index and the consumer the head index; each keeps a cached copy of the other's index, so the
+     * shared indices are only re-read when the queue looks full or empty. The indices live on
+     * separate cache lines so the two threads do not invalidate each other's writes.
+     *
+     * @tparam T Element type; must be movable.
+     */
+    template <typename T>
+    class SpscQueue {
+    private:
+        static constexpr std::size_t CACHE_LINE = 64;
+
+        std::vector<std::optional<T>> slots;
+        alignas(CACHE_LINE) std::atomic<std::size_t> head{0};
+        std::size_t cached_tail = 0;    // Consumer's view of tail
+        alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};
+        std::size_t cached_head = 0;    // Producer's view of head
+        alignas(CACHE_LINE) std::atomic<bool> closed_flag{false};
+
+        std::size_t next(std::size_t index) const noexcept {
+            return index + 1 == this->slots.size() ? 0 : index + 1;
+        }
+
+    public:
+        /** @param capacity Largest number of queued elements (at least 1). */
+        explicit SpscQueue(std::size_t capacity) : slots(std::max<std::size_t>(capacity, 1) + 1) {}
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /**
+         * @brief Producer: enqueue `value` if there is room, moving from it only on success.
+         * @return True if `value` was enqueued.
+         */
+        bool tryPush(T& value) {
+            std::size_t current = this->tail.load(std::memory_order_relaxed);
+            std::size_t following = this->next(current);
+            if (following == this->cached_head) {
+                this->cached_head = this->head.load(std::memory_order_acquire);
+                if (following == this->cached_head) return false;
+            }
+            this->slots[current].emplace(std::move(value));
+            this->tail.store(following, std::memory_order_release);
+            return true;
+        }
+        /** @brief Producer: enqueue `value`, yielding the thread while the queue is full. */
+        void push(T value) {
+            while (!this->tryPush(value)) std::this_thread::yield();
+        }
+        /** @brief Producer: mark the end of the stream; no element may be pushed afterwards. */
+        void close() noexcept {
+            this->closed_flag.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Consumer: dequeue the oldest element, if any.
+         * @return Oldest element, or `std::nullopt` if the queue is empty.
+         */
+        std::optional<T> tryPop() {
+            std::size_t current = this->head.load(std::memory_order_relaxed);
+            if (current == this->cached_tail) {
+                this->cached_tail = this->tail.load(std::memory_order_acquire);
+                if (current == this->cached_tail) return std::nullopt;
+            }
+            std::optional<T> value = std::move(this->slots[current]);
+            this->slots[current].reset();
+            this->head.store(this->next(current), std::memory_order_release);
+            return value;
+        }
+        /**
+         * @brief Consumer: dequeue the oldest element, waiting for one until the stream ends.
+         * @return Oldest element, or `std::nullopt` once the queue is closed and drained.
+         */
+        std::optional<T> pop() {
+            while (true) {
+                if (std::optional<T> value = this->tryPop()) return value;
+                // Elements pushed before close() are visible once the flag is, so look once more
+                if (this->closed_flag.load(std::memory_order_acquire)) return this->tryPop();
+                std::this_thread::yield();
+            }
+        }
+
+        /** @brief Whether the producer has closed the stream (elements may remain). */
+        bool closed() const noexcept {
+            return this->closed_flag.load(std::memory_order_acquire);
+        }
+        /** @brief Largest number of queued elements. */
+        std::size_t capacity() const noexcept {
+            return this->slots.size() - 1;
+        }
+    };
+
+    /** @brief One move passed from a motion thread to the consumer stages of a @ref Pipeline. */
+    struct MoveRecord {
+        std::size_t robot;          ///< Index of the robot in the run
+        std::size_t step;           ///< Step number of this robot, from 0
+        geometry::Point2D start;    ///< Position before the step
+        numeric::fscalar radius;    ///< Radius of the robot
+        StepResult result;          ///< Outcome of the step
+    };
+
+    /** @brief Running totals kept by @ref Pipeline::statistics. */
+    struct MoveStatistics {
+        std::size_t moves = 0;          ///< Steps that moved a robot
+        std::size_t failures = 0;       ///< Steps that did not move a robot
+        double path_length = 0;         ///< Total distance travelled
+        double absolute_error = 0;      ///< Sum of absolute sampled heading errors over moves
+        double max_absolute_error = 0;  ///< Largest absolute sampled heading error
+
+        /** @brief Mean absolute sampled heading error per move. */
+        double meanAbsoluteError() const noexcept {
+            return this->moves == 0 ? 0.0 : this->absolute_error / static_cast<double>(this->moves);
+        }
+    };
+
+    /**
+     * @brief Multi-threaded run that overlaps robot motion with the stages consuming its moves.
+     *
+     * Motion threads step the robots and publish a @ref MoveRecord per step. Every stage runs on
+     * its own thread and reads from one @ref SpscQueue per motion thread, so no queue has more than
+     * one writer or reader. Bounded queues apply back-pressure: motion waits when a stage falls
+     * `capacity` moves behind. In a single long run the motion thread and, for example, coverage
+     * accounting and trajectory recording then keep separate cores busy instead of alternating.
+     *
+     * With several motion threads, robots are dealt round-robin and each thread steps its robots in
+     * turn. Every stage sees the moves of each robot in order, but the interleaving of different
+     * robots depends on scheduling; the built-in stages are insensitive to it. Each motion thread
+     * uses its own copy of the heading policy.
+     *
+     * Stages run concurrently with motion and must not throw. Like @ref World, records share exact
+     * numbers with the robots across threads, which relies on CGAL's thread-safe reference counting.
+     *
+     * @tparam RobotType Robot type being run (default @ref Robot).
+     */
+    template <typename RobotType = Robot<>>
+    class Pipeline {
+    public:
+        /** @brief Consumer of move records, run on its own thread. */
+        using Stage = std::function<void(const MoveRecord&)>;
+
+        /** @brief Default number of records each queue can hold. */
+        static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    private:
+        std::vector<Stage> stages;
+        std::size_t capacity;
+
+    public:
+        /** @param capacity Records each stage may lag behind each motion thread. */
+        explicit Pipeline(std::size_t capacity = DEFAULT_CAPACITY) : capacity{std::max<std::size_t>(capacity, 1)} {}
+
+        /**
+         * @brief Append a stage that receives every move of every subsequent run.
+         * @return This pipeline, for chaining.
+         */
+        Pipeline& addStage(Stage stage) {
+            this->stages.push_back(std::move(stage));
+            return *this;
+        }
+        /** @brief Number of stages. */
+        std::size_t stageCount() const noexcept {
+            return this->stages.size();
+        }
+
+        /**
+         * @brief Step every robot up to `steps` times, feeding the moves to all stages.
+         *
+         * `policy` chooses each commanded heading from the robot's current state. A robot stops
+         * early after a step that does not move it. Returns once every stage has consumed every move.
+         *
+         * @param robots Robots to run; each must have a configuration space.
+         * @param policy Heading policy called as `policy(robot)`.
+         * @param steps Largest number of steps per robot.
+         * @param producers Motion threads (0 uses the hardware concurrency left after the stages), at most one per robot.
+         * @param perturbed Whether headings pass through each robot's rotation model.
+         * @return Number of moves published, or `std::nullopt` if `robots` is empty.
+         */
+        template <typename Policy> requires std::invocable<Policy&, const RobotType&> && std::convertible_to<std::invoke_result_t<Policy&, const RobotType&>, numeric::fscalar>
+        std::optional<std::size_t> run(std::span<RobotType> robots, Policy policy, std::size_t steps, std::size_t producers = 1, bool perturbed = false, const std::source_location location = std::source_location::current()) const {
+            tracing::Span span{"Pipeline::run"};
+            if (robots.empty()) {
+                burst_error("Cannot run a pipeline without robots", location);
+                return std::nullopt;
+            }
+            if (producers == 0) {
+                std::size_t hardware = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+                producers = hardware > this->stages.size() ? hardware - this->stages.size() : 1;
+            }
+            producers = std::clamp<std::size_t>(producers, 1, robots.size());
+
+            // queues[p][s] carries records from motion thread p to stage s
+            std::vector<std::vector<std::unique_ptr<SpscQueue<MoveRecord>>>> queues(producers);
+            for (auto& row : queues) {
+                for (std::size_t s = 0; s < this->stages.size(); ++s) row.push_back(std::make_unique<SpscQueue<MoveRecord>>(this->capacity));
+            }
+            std::atomic<std::size_t> published{0};
+
+            {
+                std::vector<std::jthread> threads;
+                threads.reserve(producers + this->stages.size());
+                for (std::size_t s = 0; s < this->stages.size(); ++s) {
+                    threads.emplace_back([this, &queues, s, producers] {
+                        std::vector<bool> drained(producers, false);
+                        std::size_t open = producers;
+                        while (open > 0) {
+                            bool progressed = false;
+                            for (std::size_t p = 0; p < producers; ++p) {
+                                if (drained[p]) continue;
+                                SpscQueue<MoveRecord>& queue = *queues[p][s];
+                                bool closed = queue.closed();
+                                if (std::optional<MoveRecord> record = queue.tryPop()) {
+                                    this->stages[s](*record);
+                                    progressed = true;
+                                } else if (closed) {
+                                    drained[p] = true;
+                                    --open;
+                                }
+                            }
+                            if (!progressed) std::this_thread::yield();
+                        }
+                    });
+                }
+                for (std::size_t p = 0; p < producers; ++p) {
+                    threads.emplace_back([&robots, &queues, &published, policy, p, producers, steps, perturbed]() mutable {
+                        std::vector<std::size_t> active;
+                        for (std::size_t i = p; i < robots.size(); i += producers) active.push_back(i);
+                        std::vector<SpscQueue<MoveRecord>*> outputs;
+                        for (auto& queue : queues[p]) outputs.push_back(queue.get());
+
+                        std::size_t count = 0;
+                        for (std::size_t step = 0; step < steps && !active.empty(); ++step) {
+                            std::erase_if(active, [&](std::size_t index) {
+                                RobotType& robot = robots[index];
+                                MoveRecord record{index, step, robot.getPosition(), robot.getRadius(), {}};
+                                record.result = robot.step(std::invoke(policy, std::as_const(robot)), perturbed);
+                                bool stopped = record.result.status != StepStatus::Moved;
+                                count += !stopped;
+                                // Copy to every stage but the last, which takes the record itself
+                                for (std::size_t s = 0; s + 1 < outputs.size(); ++s) outputs[s]->push(record);
+                                if (!outputs.empty()) outputs.back()->push(std::move(record));
+                                return stopped;
+                            });
+                        }
+                        for (SpscQueue<MoveRecord>* queue : outputs) queue->close();
+                        published.fetch_add(count, std::memory_order_relaxed);
+                    });
+                }
+            } // Threads join here
+            return published.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Stage subtracting the area swept by every move from `coverage`.
+         *
+         * `coverage` must track the robots' configuration space and must not be used elsewhere until
+         * the run returns. Only available for straight (ray) trajectories; see @ref Robot::sweptArea.
+         *
+         * @return Stage for @ref addStage.
+         */
+        static Stage coverage(geometry::AreaCoverage& coverage) requires std::same_as<typename RobotType::Trajectory, geometry::Ray2D> {
+            return [&coverage](const MoveRecord& record) {
+                if (record.result.status != StepStatus::Moved || record.start == record.result.position) return;
+                coverage.add(RobotType::sweptArea(record.radius, record.start, record.result.position));
+            };
+        }
+        /**
+         * @brief Stage recording every boundary contact in `coverage`.
+         * @return Stage for @ref addStage.
+         */
+        static Stage contacts(geometry::BoundaryCoverage& coverage) {
+            return [&coverage](const MoveRecord& record) {
+                if (record.result.status == StepStatus::Moved) coverage.touch(record.result.position);
+            };
+        }
+        /**
+         * @brief Stage appending each robot's positions to `trajectories[robot]`, starting with its first start.
+         * @return Stage for @ref addStage.
+         */
+        static Stage recorder(std::vector<std::vector<geometry::Point2D>>& trajectories) {
+            return [&trajectories](const MoveRecord& record) {
+                if (trajectories.size() <= record.robot) trajectories.resize(record.robot + 1);
+                std::vector<geometry::Point2D>& trajectory = trajectories[record.robot];
+                if (trajectory.empty()) trajectory.push_back(record.start);
+                if (record.result.status == StepStatus::Moved) trajectory.push_back(record.result.position);
+            };
+        }
+        /**
+         * @brief Stage accumulating move counts, path length, and heading errors into `statistics`.
+         * @return Stage for @ref addStage.
+         */
+        static Stage statistics(MoveStatistics& statistics) {
+            return [&statistics](const MoveRecord& record) {
+                if (record.result.status != StepStatus::Moved) {
+                    statistics.failures++;
+                    return;
+                }
+                statistics.moves++;
+                statistics.path_length += std::sqrt(CGAL::to_double(CGAL::squared_distance(record.start, record.result.position)));
+                double error = std::fabs(CGAL::to_double(record.result.error));
+                statistics.absolute_error += error;
+                statistics.max_absolute_error = std::max(statistics.max_absolute_error, error);
+            };
+        }
+    };
+
+}
+
+#endif
@@ -1,8 +1,13 @@
 #ifndef BURST_ROBOT_HPP
 #define BURST_ROBOT_HPP
 
+#include <cstdint>
 #include <memory>
 #include <random>
+#include <ranges>
+#include <concepts>
+#include <functional>
+#include <utility>
 #include <array>
 #include <unordered_map>
 #include <algorithm>
@@ -18,6 +23,9 @@
 #include "configuration_space.hpp"
 #include "models.hpp"
 #include "logging.hpp"
+#include "tracing.hpp"
+#include "memory.hpp"
+#include "generator.hpp"
 
 /**
  * @file robot.hpp
@@ -26,6 +34,28 @@
 
 namespace BURST {
 
+    /** @brief How a robot treats a start point that is not on the boundary of its configuration space. */
+    enum class StartPlacement {
+        AsGiven,        ///< Keep the start point and warn when the configuration space is attached (default)
+        SnapToBoundary  ///< Move the start point to the nearest boundary point when the configuration space is attached
+    };
+
+    /** @brief Outcome of a single @ref Robot::step. */
+    enum class StepStatus : std::uint8_t {
+        Moved,      ///< The robot moved to a new boundary point
+        Invalid,    ///< The motion was infeasible and the robot stayed in place
+        Unattached  ///< The robot has no configuration space
+    };
+
+    /** @brief Result of one commanded motion, as yielded by @ref Robot::steps. */
+    struct StepResult {
+        geometry::Point2D position;         ///< Position after the step (unchanged unless `status` is `Moved`)
+        std::optional<std::size_t> curve;   ///< Index of the boundary curve the robot stopped on, in @ref geometry::ConfigurationSpace::boundary order (`std::nullopt` if the endpoint is off the boundary)
+        numeric::fscalar angle;             ///< Commanded heading
+        numeric::fscalar error;             ///< Sampled heading error (effective minus commanded heading; zero when unperturbed)
+        StepStatus status;
+    };
+
     /**
      * @brief Kinematic agent modeled as a disk with stochastic heading error and boundary-constrained motion.
      *
@@ -49,6 +79,7 @@ namespace BURST {
         numeric::fscalar radius;
         geometry::Point2D position;
         std::shared_ptr<BURST::geometry::ConfigurationSpace> configuration_environment;
+        StartPlacement start_placement;
 
         models::RotationModel<R, D> rotation_model;
         models::MovementModel<T, P> movement_model;
@@ -64,12 +95,24 @@ namespace BURST {
             }
         };
 
+        // Coroutine body of the range overload of steps, holding the headings as a view
+        template <std::ranges::view V>
+        Generator<StepResult> stepsOver(V angles, bool perturbed) {
+            for (auto&& angle : angles) {
+                StepResult result = this->step(static_cast<numeric::fscalar>(angle), perturbed);
+                StepStatus status = result.status;
+                co_yield std::move(result);
+                if (status != StepStatus::Moved) co_return;
+            }
+        }
+
     protected:
         // Protected constructor since preconditions are validated by public static create functions
-        Robot(numeric::fscalar robot_radius, geometry::Point2D starting_point, models::RotationModel<R, D> rotation_model, models::MovementModel<T, P> movement_model) : 
+        Robot(numeric::fscalar robot_radius, geometry::Point2D starting_point, models::RotationModel<R, D> rotation_model, models::MovementModel<T, P> movement_model, StartPlacement placement = StartPlacement::AsGiven) : 
             Renderable{},
             radius{robot_radius}, 
             position{starting_point}, 
+            start_placement{placement},
             rotation_model{rotation_model}, 
             movement_model{movement_model} {}
 
@@ -89,36 +132,58 @@ namespace BURST {
          * @return `std::nullopt` if `robot_radius <= 0`.
          */
         static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, numeric::fscalar max_rotation_error, const std::source_location location = std::source_location::current()) {
+            return create(robot_radius, starting_point, max_rotation_error, StartPlacement::AsGiven, location);
+        }
+        /**
+         * @brief Same as @ref create with an explicit start placement.
+         * @param placement Whether `starting_point` is snapped to the boundary once a configuration space is attached.
+         * @return `std::nullopt` if `robot_radius <= 0`.
+         */
+        static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, numeric::fscalar max_rotation_error, StartPlacement placement, const std::source_location location = std::source_location::current()) {
             // Cannot construct a robot with a non-positive radius
             if (robot_radius <= 0) {
                 burst_error("Cannot construct a robot with non-positive radius", location);
                 return std::nullopt;
             }
-            else return Robot{robot_radius, starting_point, models::RotationModel<R, D>{max_rotation_error}, models::MovementModel<T, P>{}};
+            else return Robot{robot_radius, starting_point, models::RotationModel<R, D>{max_rotation_error}, models::MovementModel<T, P>{}, placement};
         }
         /**
          * @brief Same as @ref create with explicit PRNG seed for reproducible rotation noise.
          * @return `std::nullopt` if `robot_radius <= 0`.
          */
         static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, numeric::fscalar max_rotation_error, unsigned int rotation_seed, const std::source_location location = std::source_location::current()) {
+            return create(robot_radius, starting_point, max_rotation_error, rotation_seed, StartPlacement::AsGiven, location);
+        }
+        /**
+         * @brief Same as @ref create with explicit PRNG seed and start placement.
+         * @return `std::nullopt` if `robot_radius <= 0`.
+         */
+        static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, numeric::fscalar max_rotation_error, unsigned int rotation_seed, StartPlacement placement, const std::source_location location = std::source_location::current()) {
             // Cannot construct a robot with a non-positive radius
             if (robot_radius <= 0) {
                 burst_error("Cannot construct a robot with non-positive radius", location);
                 return std::nullopt;
             }
-            else return Robot{robot_radius, starting_point, models::RotationModel<R, D>{max_rotation_error, rotation_seed}, models::MovementModel<T, P>{}};
+            else return Robot{robot_radius, starting_point, models::RotationModel<R, D>{max_rotation_error, rotation_seed}, models::MovementModel<T, P>{}, placement};
         }
         /**
          * @brief Construct a robot with fully custom rotation and movement models.
          * @return `std::nullopt` if `robot_radius <= 0`.
          */
         static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, models::RotationModel<R, D> rotation_model, models::MovementModel<T, P> movement_model, const std::source_location location = std::source_location::current()) {
+            return create(robot_radius, starting_point, std::move(rotation_model), std::move(movement_model), StartPlacement::AsGiven, location);
+        }
+        /**
+         * @brief Same as @ref create with custom models and an explicit start placement.
+         * @return `std::nullopt` if `robot_radius <= 0`.
+         */
+        static std::optional<Robot> create(numeric::fscalar robot_radius, geometry::Point2D starting_point, models::RotationModel<R, D> rotation_model, models::MovementModel<T, P> movement_model, StartPlacement placement, const std::source_location location = std::source_location::current()) {
             // Cannot construct a robot with a non-positive radius
             if (robot_radius <= 0) {
                 burst_error("Cannot construct a robot with non-positive radius", location);
                 return std::nullopt;
             }
-            else return Robot{robot_radius, starting_point, rotation_model, movement_model};
+            else return Robot{robot_radius, starting_point, rotation_model, movement_model, placement};
         }
         /** @brief Read-only view of the current configuration space (undefined if never set). */
         const BURST::geometry::ConfigurationSpace& getConfigurationEnvironment() const {
@@ -141,15 +206,24 @@ namespace BURST {
         /**
          * @brief Attach the configuration space used for motion and coverage queries.
          *
-         * If the robot's current position is not on the boundary of the new space, a warning may
-         * be logged because subsequent moves assume a boundary start configuration.
+         * If the robot's current position is not on the boundary of the new space, it is moved to the
+         * nearest boundary point when the robot was created with @ref StartPlacement::SnapToBoundary;
+         * otherwise a warning may be logged because subsequent moves assume a boundary start configuration.
          */
         void setConfigurationEnvironment(std::shared_ptr<BURST::geometry::ConfigurationSpace> config_environment, const std::source_location location = std::source_location::current()) {
             this->configuration_environment = std::move(config_environment);
-            if (!this->configuration_environment->onEdge(this->position)) {
-                std::string warning_string = "Robot's current position (" + BURST::numeric::to_string(this->position.x()) + ", " + BURST::numeric::to_string(this->position.y()) + ") is not on the border of the configuration space. This may lead to unexpected movement behavior.";
-                burst_warning(warning_string.c_str(), location);
+            // Nothing to do if the robot already starts on the boundary
+            if (this->configuration_environment->onEdge(this->position)) return;
+            // Move the start point onto the boundary if requested at creation
+            if (this->start_placement == StartPlacement::SnapToBoundary) {
+                std::optional<geometry::BoundaryPoint> nearest = this->configuration_environment->nearestBoundaryPoint(this->position);
+                if (nearest.has_value()) {
+                    this->position = nearest->point;
+                    return;
+                }
             }
+            std::string warning_string = "Robot's current position (" + BURST::numeric::to_string(this->position.x()) + ", " + BURST::numeric::to_string(this->position.y()) + ") is not on the border of the configuration space. This may lead to unexpected movement behavior.";
+            burst_warning(warning_string.c_str(), location);
         }
         /**
          * @brief Get the configuration space.
@@ -178,6 +252,15 @@ namespace BURST {
                 burst_warning(warning_string.c_str(), location);
             }
         }
+        /**
+         * @brief Move the robot's center to `new_position` without checking it against the boundary.
+         *
+         * Used where a motion legitimately stops inside the configuration space, such as a contact
+         * with another robot in a @ref World.
+         */
+        void placeAt(const geometry::Point2D& new_position) noexcept {
+            this->position = new_position;
+        }
 
         /**
          * @brief Apply the rotation model to a commanded heading (no translation).
@@ -202,15 +285,28 @@ namespace BURST {
             }
             return this->movement_model(this->position, perturbed ? this->rotation_model(angle) : angle, *this->configuration_environment, location);
         }
+        /**
+         * @brief Same as @ref shootRay, resolved against `space` instead of the attached configuration space.
+         *
+         * `space` should be a replica of the attached configuration space, for example one placed in
+         * the memory of the calling thread's NUMA node (see @ref World::distributeAcrossNodes).
+         *
+         * @return Endpoint if the trajectory hits the boundary, `std::nullopt` otherwise.
+         */
+        std::optional<geometry::Point2D> shootRay(const numeric::fscalar& angle, const geometry::ConfigurationSpace& space, bool perturbed = false, const std::source_location location = std::source_location::current()) const {
+            return this->movement_model(this->position, perturbed ? this->rotation_model(angle) : angle, space, location);
+        }
         /**
          * @brief Minkowski-style “stadium” swept by the disk along the feasible motion for `angle`.
          *
          * Unites start and end circular footprints with the connecting strip bounded by the
-         * movement path type. Empty if the trajectory cannot be resolved.
+         * movement path type. Empty if the trajectory cannot be resolved. Only straight (ray)
+         * trajectories sweep a stadium, so robots with other trajectory types do not offer it.
          *
          * @return Covered region if the motion is feasible, `std::nullopt` otherwise.
          */
-        std::optional<geometry::CurvilinearPolygonSet2D> coveredArea(const numeric::fscalar& angle, bool perturbed = false, const std::source_location location = std::source_location::current()) const {
+        std::optional<geometry::CurvilinearPolygonSet2D> coveredArea(const numeric::fscalar& angle, bool perturbed = false, const std::source_location location = std::source_location::current()) const requires std::same_as<T, geometry::Ray2D> {
+            tracing::Span span{"Robot::coveredArea"};
             // Cannot generate a stadium if configuration environment does not exist
             if (!this->configuration_environment) {
                 burst_error("Cannot compute covered area without a configuration environment set", location);
@@ -222,26 +318,41 @@ namespace BURST {
             std::optional<geometry::Point2D> endpoint = this->movement_model(this->position, effective_angle, *this->configuration_environment, location);
             // If the trajectory is nullopt, we can't generate a stadium, so return nullopt
             if (!endpoint.has_value()) return std::nullopt;
+            return sweptArea(this->radius, this->position, *endpoint);
+        }
 
+        /**
+         * @brief Stadium swept by a disk of `radius` moving in a straight line from `start` to `end`.
+         *
+         * Unites the start and end circular footprints with the connecting strip bounded by the
+         * movement path type, across the diameters perpendicular to the chord. Needs no robot state,
+         * so recorded moves can be swept on any thread. Only valid for straight (ray) trajectories.
+         *
+         * @return Covered region; the start disk alone if `start == end`.
+         */
+        static geometry::CurvilinearPolygonSet2D sweptArea(const numeric::fscalar& radius, const geometry::Point2D& start, const geometry::Point2D& end) requires std::same_as<T, geometry::Ray2D> {
             // Add the robot's start and end circles to the stadium polygon set
             geometry::CurvilinearPolygonSet2D stadium;
             // Add the circle for the robot's starting position
-            stadium.join(*geometry::construct_circle(this->radius, this->position));
+            stadium.join(*geometry::construct_circle(radius, start));
+            if (start == end) return stadium;
             // Add the circle for the robot's ending position
-            stadium.join(*geometry::construct_circle(this->radius, *endpoint));
+            stadium.join(*geometry::construct_circle(radius, end));
 
             // Create the somewhat-rectangular portion of the stadium, with the edges defined by the robot's path type
-            // The angle perpendicular to the movement direction is the angle between the movement vector of the robot and its diameter containing the rectangle vertices
-            numeric::hpscalar diameter_angle = numeric::to_high_precision(effective_angle + CGAL_PI / 2);
-            // Compute the difference between the center of the robot and the rectangle vertices in the x and y directions of the diameter perpendicular to the robot's movement direction
-            numeric::fscalar dx = this->radius * numeric::to_fscalar(boost::multiprecision::cos(diameter_angle));
-            numeric::fscalar dy = this->radius * numeric::to_fscalar(boost::multiprecision::sin(diameter_angle));
+            // Its short sides are the diameters perpendicular to the chord, whose unit normal is rounded in high precision
+            numeric::hpscalar chord_x = numeric::to_high_precision(end.x() - start.x());
+            numeric::hpscalar chord_y = numeric::to_high_precision(end.y() - start.y());
+            numeric::hpscalar chord_length = boost::multiprecision::sqrt(chord_x * chord_x + chord_y * chord_y);
+            // Compute the difference between the center of the robot and the rectangle vertices in the x and y directions of that diameter
+            numeric::fscalar dx = radius * numeric::to_fscalar(numeric::hpscalar{-chord_y / chord_length});
+            numeric::fscalar dy = radius * numeric::to_fscalar(numeric::hpscalar{chord_x / chord_length});
             // Compute the vertices of the rectangle by adding and subtracting dx and dy from the start and end points of the robot's trajectory
             std::array<geometry::Point2D, 4> rectangle_vertices{
-                geometry::Point2D{this->position.x() + dx, this->position.y() + dy},
-                geometry::Point2D{this->position.x() - dx, this->position.y() - dy},
-                geometry::Point2D{endpoint->x() - dx, endpoint->y() - dy},
-                geometry::Point2D{endpoint->x() + dx, endpoint->y() + dy}
+                geometry::Point2D{start.x() + dx, start.y() + dy},
+                geometry::Point2D{start.x() - dx, start.y() - dy},
+                geometry::Point2D{end.x() - dx, end.y() - dy},
+                geometry::Point2D{end.x() + dx, end.y() + dy}
             };
             
             // Sort the rectangle vertices in counterclockwise order to ensure the correct orientation for CGAL
@@ -266,7 +377,7 @@ namespace BURST {
                 // Check if both points are on a diameter (i.e., their midpoint is the start or end point of the robot's trajectory)
                 // If so, construct a diameter segment, otherwise construct a P
                 geometry::Point2D midpoint = geometry::midpoint(rectangle_vertices[i], rectangle_vertices[next]);
-                if (midpoint == this->position || midpoint == *endpoint) rectangle_edges.emplace_back(geometry::construct_curve(geometry::Segment2D{rectangle_vertices[i], rectangle_vertices[next]}));
+                if (midpoint == start || midpoint == end) rectangle_edges.emplace_back(geometry::construct_curve(geometry::Segment2D{rectangle_vertices[i], rectangle_vertices[next]}));
                 else rectangle_edges.emplace_back(geometry::construct_curve(P{rectangle_vertices[i], rectangle_vertices[next]}));
             }
             // Form a polygon from the rectangle edges and add it into the stadium
@@ -280,6 +391,7 @@ namespace BURST {
          * @return `false` when no configuration space is set or the move is invalid.
          */
         bool move(const numeric::fscalar& angle, bool perturbed = false, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"Robot::move"};
             // Cannot move if configuration environment does not exist
             if (!this->configuration_environment) {
                 burst_error("Cannot move without a configuration environment set", location);
@@ -296,6 +408,74 @@ namespace BURST {
             return true;
         }
 
+        /**
+         * @brief Execute a motion like @ref move and report it as a @ref StepResult.
+         *
+         * Also looks up the boundary curve the robot stopped on, which @ref move skips.
+         *
+         * @return Step result; the position is unchanged unless the status is @ref StepStatus::Moved.
+         */
+        StepResult step(const numeric::fscalar& angle, bool perturbed = false, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"Robot::step"};
+            if (!this->configuration_environment) {
+                burst_error("Cannot move without a configuration environment set", location);
+                return StepResult{this->position, std::nullopt, angle, 0, StepStatus::Unattached};
+            }
+
+            numeric::fscalar effective_angle = perturbed ? this->rotation_model(angle) : angle;
+            std::optional<geometry::Point2D> endpoint = this->movement_model(this->position, effective_angle, *this->configuration_environment, location);
+            if (!endpoint.has_value()) return StepResult{this->position, std::nullopt, angle, effective_angle - angle, StepStatus::Invalid};
+            this->position = *endpoint;
+
+            // The endpoint lies on the curve that stopped the robot, so an indexed containment lookup finds it without a distance search
+            std::optional<std::size_t> curve = this->configuration_environment->boundary().locate(this->position);
+            return StepResult{this->position, curve, angle, effective_angle - angle, StepStatus::Moved};
+        }
+
+        /**
+         * @brief Lazily run one @ref step per commanded heading in `angles`.
+         *
+         * Steps are computed only as results are pulled, so downstream stages can be chained with
+         * range adaptors and abandoned early. The sequence ends after the last heading or after the
+         * first step that does not move the robot, which is still yielded.
+         *
+         * The robot, and `angles` when it refers to a container, must outlive the generator.
+         *
+         * @return Generator of step results.
+         */
+        template <std::ranges::viewable_range Angles> requires std::convertible_to<std::ranges::range_reference_t<Angles>, numeric::fscalar>
+        Generator<StepResult> steps(Angles&& angles, bool perturbed = false) {
+            return this->stepsOver(std::views::all(std::forward<Angles>(angles)), perturbed);
+        }
+        /**
+         * @brief Lazily run steps whose headings are chosen by `policy` from the robot's current state.
+         *
+         * `policy` is called with the robot before every step. The sequence is unbounded and ends only
+         * after the first step that does not move the robot; bound it with `std::views::take` or by
+         * leaving the consuming loop.
+         *
+         * @return Generator of step results.
+         */
+        template <typename Policy> requires std::invocable<Policy&, const Robot&> && std::convertible_to<std::invoke_result_t<Policy&, const Robot&>, numeric::fscalar>
+        Generator<StepResult> steps(Policy policy, bool perturbed = false) {
+            while (true) {
+                numeric::fscalar angle = std::invoke(policy, std::as_const(*this));
+                StepResult result = this->step(angle, perturbed);
+                StepStatus status = result.status;
+                co_yield std::move(result);
+                if (status != StepStatus::Moved) co_return;
+            }
+        }
+
+        /**
+         * @brief Estimated footprint of the robot: its body and the exact numbers of its radius and position.
+         *
+         * The configuration space is shared between robots and not included; query it directly.
+         */
+        memory::MemoryUsage memoryUsage() const noexcept {
+            return memory::MemoryUsage{sizeof(*this), 0, memory::EXACT_SCALAR_BYTES + memory::EXACT_POINT_BYTES};
+        }
+
         /** 
          * @brief Default visualization color (red disk).
          * @return Default robot color.
@@ -337,6 +517,12 @@ namespace BURST {
         }
     };
 
+#ifdef BURST_EXTERN_TEMPLATES
+    // Default robots are instantiated once in the compiled BURST library (src/instantiations.cpp)
+    extern template class Robot<geometry::Ray2D, geometry::Segment2D, std::mt19937, std::uniform_real_distribution<double>>;
+    extern template class Robot<geometry::Ray2D, geometry::Segment2D, std::mt19937, numeric::flat_distribution>;
+#endif
+
 }
 
 #endif
@@ -0,0 +1,382 @@
+#ifndef BURST_SIMD_HPP
+#define BURST_SIMD_HPP
+
+/**
+ * @file simd.hpp
+ * @brief Vectorised double-precision filters testing one ray segment against a leaf of four boundary curves.
+ *
+ * Each kernel reports, per lane, whether the segment from `origin` to `origin + direction` may meet
+ * the lane's curve and a conservative interval of segment parameters `t` in `[0, 1]` containing
+ * every true meeting point. Segments are tested with orientation signs against error bounds; circular
+ * arcs are tested against their whole supporting circle thickened into an annulus, so arcs are
+ * over-reported but never missed. The filters feed exact CGAL refinement and are never a substitute
+ * for it.
+ *
+ * AVX2 and SSE2 implementations are compiled when the target enables them (`__AVX2__`, `__SSE2__`)
+ * and @ref BURST::simd::leaf_hits dispatches to the widest one available; the scalar kernel is always
+ * available as the reference.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace BURST::simd {
+
+    /** @brief Number of curves tested together. */
+    constexpr std::size_t LANES = 4;
+
+    /** @brief Default relative slack absorbing the rounding of exact coordinates to doubles. */
+    constexpr double DEFAULT_TOLERANCE = 1e-9;
+
+    /**
+     * @brief Four boundary curves packed lane by lane.
+     *
+     * A lane with `radius > 0` is a circular arc on the circle (`center_x`, `center_y`, `radius`);
+     * otherwise it is the segment from (`x0`, `y0`) to (`x1`, `y1`). Lanes at or beyond `count` are padding.
+     */
+    struct alignas(32) CurveLeaf {
+        double x0[LANES] = {};
+        double y0[LANES] = {};
+        double x1[LANES] = {};
+        double y1[LANES] = {};
+        double center_x[LANES] = {};
+        double center_y[LANES] = {};
+        double radius[LANES] = {};
+        std::uint32_t count = 0;
+    };
+
+    /** @brief Query segment `origin + t * direction` for `t` in `[0, 1]`, with the coordinate scale used for error bounds. */
+    struct RaySegment {
+        double origin_x, origin_y;
+        double direction_x, direction_y;
+        double scale;
+    };
+
+    /** @brief Per-lane results: `mask` bit `i` is set if lane `i` may be hit within `[t_min[i], t_max[i]]`. */
+    struct alignas(32) LeafHits {
+        double t_min[LANES];
+        double t_max[LANES];
+        unsigned mask;
+    };
+
+    /**
+     * @brief Describe the segment from (`ax`, `ay`) to (`bx`, `by`) for the kernels.
+     * @param scale Largest absolute coordinate among the query and the curves it will be tested against.
+     */
+    inline RaySegment make_ray_segment(double ax, double ay, double bx, double by, double scale) {
+        return RaySegment{ax, ay, bx - ax, by - ay, std::max({scale, std::abs(ax), std::abs(ay), std::abs(bx), std::abs(by), 1.0})};
+    }
+
+    /**
+     * @brief Reference scalar kernel.
+     * @return Bit mask of lanes that may be hit; intervals are written to `hits`.
+     */
+    inline unsigned leaf_hits_scalar(const CurveLeaf& leaf, const RaySegment& ray, LeafHits& hits, double tolerance = DEFAULT_TOLERANCE) {
+        const double scale = ray.scale;
+        const double slack = tolerance * scale;
+        const double ex = ray.direction_x, ey = ray.direction_y;
+        const double ray_length = std::abs(ex) + std::abs(ey);
+        hits.mask = 0;
+
+        for (std::uint32_t lane = 0; lane < LANES; ++lane) {
+            hits.t_min[lane] = 0.0;
+            hits.t_max[lane] = 1.0;
+            if (lane >= leaf.count) continue;
+
+            if (leaf.radius[lane] > 0.0) {
+                // Thicken the circle into an annulus and intersect the segment with its outer and inner circles
+                double fx = ray.origin_x - leaf.center_x[lane], fy = ray.origin_y - leaf.center_y[lane];
+                double a = ex * ex + ey * ey;
+                double b = 2.0 * (ex * fx + ey * fy);
+                double f2 = fx * fx + fy * fy;
+                double outer = leaf.radius[lane] + slack;
+                double inner = std::max(leaf.radius[lane] - slack, 0.0);
+                double disc_outer = b * b - 4.0 * a * (f2 - outer * outer);
+                if (disc_outer < 0.0 || a == 0.0) continue;
+                double root_outer = std::sqrt(disc_outer);
+                double t_low = (-b - root_outer) / (2.0 * a);
+                double t_high = (-b + root_outer) / (2.0 * a);
+                if (t_high < 0.0 || t_low > 1.0) continue;
+                // A segment strictly inside the inner circle never reaches the circle itself
+                double disc_inner = b * b - 4.0 * a * (f2 - inner * inner);
+                if (disc_inner > 0.0) {
+                    double root_inner = std::sqrt(disc_inner);
+                    if ((-b - root_inner) / (2.0 * a) < 0.0 && (-b + root_inner) / (2.0 * a) > 1.0) continue;
+                }
+                hits.t_min[lane] = std::max(t_low, 0.0);
+                hits.t_max[lane] = std::min(t_high, 1.0);
+                hits.mask |= 1u << lane;
+            } else {
+                // Orientation of each segment endpoint against the ray and of the ray endpoints against the segment
+                double sx = leaf.x1[lane] - leaf.x0[lane], sy = leaf.y1[lane] - leaf.y0[lane];
+                double ax = leaf.x0[lane] - ray.origin_x, ay = leaf.y0[lane] - ray.origin_y;
+                double bx = leaf.x1[lane] - ray.origin_x, by = leaf.y1[lane] - ray.origin_y;
+                double segment_length = std::abs(sx) + std::abs(sy);
+
+                double side_a = ex * ay - ey * ax;
+                double side_b = ex * by - ey * bx;
+                double ray_bound = tolerance * (ray_length + scale) * (std::abs(ax) + std::abs(ay) + std::abs(bx) + std::abs(by) + scale);
+                if ((side_a > ray_bound && side_b > ray_bound) || (side_a < -ray_bound && side_b < -ray_bound)) continue;
+
+                // Orientation of the ray origin and end against the segment, relative to its first endpoint
+                double side_origin = sx * ay - sy * ax;
+                double side_end = sx * (ay - ey) - sy * (ax - ex);
+                double segment_bound = tolerance * (segment_length + scale) * (std::abs(ax) + std::abs(ay) + ray_length + scale);
+                if ((side_origin > segment_bound && side_end > segment_bound) || (side_origin < -segment_bound && side_end < -segment_bound)) continue;
+
+                // The crossing parameter is where the segment side changes sign along the ray
+                double denominator = side_origin - side_end;
+                if (std::abs(denominator) > 2.0 * segment_bound) {
+                    double t = side_origin / denominator;
+                    double spread = 2.0 * segment_bound / std::abs(denominator);
+                    hits.t_min[lane] = std::max(t - spread, 0.0);
+                    hits.t_max[lane] = std::min(t + spread, 1.0);
+                }
+                hits.mask |= 1u << lane;
+            }
+        }
+        return hits.mask;
+    }
+
+#ifdef __AVX2__
+    /**
+     * @brief AVX2 kernel processing all four lanes at once; matches @ref leaf_hits_scalar.
+     * @return Bit mask of lanes that may be hit; intervals are written to `hits`.
+     */
+    inline unsigned leaf_hits_avx2(const CurveLeaf& leaf, const RaySegment& ray, LeafHits& hits, double tolerance = DEFAULT_TOLERANCE) {
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d two = _mm256_set1_pd(2.0);
+        const __m256d four = _mm256_set1_pd(4.0);
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        auto abs = [&sign](__m256d value) { return _mm256_andnot_pd(sign, value); };
+
+        const __m256d scale = _mm256_set1_pd(ray.scale);
+        const __m256d tol = _mm256_set1_pd(tolerance);
+        const __m256d slack = _mm256_set1_pd(tolerance * ray.scale);
+        const __m256d ex = _mm256_set1_pd(ray.direction_x), ey = _mm256_set1_pd(ray.direction_y);
+        const __m256d ox = _mm256_set1_pd(ray.origin_x), oy = _mm256_set1_pd(ray.origin_y);
+        const __m256d ray_length = _mm256_set1_pd(std::abs(ray.direction_x) + std::abs(ray.direction_y));
+
+        const __m256d lane_index = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+        const __m256d valid = _mm256_cmp_pd(lane_index, _mm256_set1_pd(static_cast<double>(leaf.count)), _CMP_LT_OQ);
+        const __m256d radius = _mm256_load_pd(leaf.radius);
+        const __m256d is_arc = _mm256_cmp_pd(radius, zero, _CMP_GT_OQ);
+
+        // Circular lanes
+        __m256d fx = _mm256_sub_pd(ox, _mm256_load_pd(leaf.center_x));
+        __m256d fy = _mm256_sub_pd(oy, _mm256_load_pd(leaf.center_y));
+        __m256d a = _mm256_add_pd(_mm256_mul_pd(ex, ex), _mm256_mul_pd(ey, ey));
+        __m256d b = _mm256_mul_pd(two, _mm256_add_pd(_mm256_mul_pd(ex, fx), _mm256_mul_pd(ey, fy)));
+        __m256d f2 = _mm256_add_pd(_mm256_mul_pd(fx, fx), _mm256_mul_pd(fy, fy));
+        __m256d outer = _mm256_add_pd(radius, slack);
+        __m256d inner = _mm256_max_pd(_mm256_sub_pd(radius, slack), zero);
+        __m256d b2 = _mm256_mul_pd(b, b);
+        __m256d four_a = _mm256_mul_pd(four, a);
+        __m256d two_a = _mm256_mul_pd(two, a);
+        __m256d disc_outer = _mm256_sub_pd(b2, _mm256_mul_pd(four_a, _mm256_sub_pd(f2, _mm256_mul_pd(outer, outer))));
+        __m256d root_outer = _mm256_sqrt_pd(_mm256_max_pd(disc_outer, zero));
+        __m256d neg_b = _mm256_sub_pd(zero, b);
+        __m256d t_low = _mm256_div_pd(_mm256_sub_pd(neg_b, root_outer), two_a);
+        __m256d t_high = _mm256_div_pd(_mm256_add_pd(neg_b, root_outer), two_a);
+        __m256d arc_hit = _mm256_and_pd(_mm256_cmp_pd(disc_outer, zero, _CMP_GE_OQ), _mm256_cmp_pd(a, zero, _CMP_NEQ_OQ));
+        arc_hit = _mm256_and_pd(arc_hit, _mm256_cmp_pd(t_high, zero, _CMP_GE_OQ));
+        arc_hit = _mm256_and_pd(arc_hit, _mm256_cmp_pd(t_low, one, _CMP_LE_OQ));
+        __m256d disc_inner = _mm256_sub_pd(b2, _mm256_mul_pd(four_a, _mm256_sub_pd(f2, _mm256_mul_pd(inner, inner))));
+        __m256d root_inner = _mm256_sqrt_pd(_mm256_max_pd(disc_inner, zero));
+        __m256d inside = _mm256_cmp_pd(disc_inner, zero, _CMP_GT_OQ);
+        inside = _mm256_and_pd(inside, _mm256_cmp_pd(_mm256_div_pd(_mm256_sub_pd(neg_b, root_inner), two_a), zero, _CMP_LT_OQ));
+        inside = _mm256_and_pd(inside, _mm256_cmp_pd(_mm256_div_pd(_mm256_add_pd(neg_b, root_inner), two_a), one, _CMP_GT_OQ));
+        arc_hit = _mm256_andnot_pd(inside, arc_hit);
+        __m256d arc_t_min = _mm256_max_pd(t_low, zero);
+        __m256d arc_t_max = _mm256_min_pd(t_high, one);
+
+        // Segment lanes
+        __m256d x0 = _mm256_load_pd(leaf.x0), y0 = _mm256_load_pd(leaf.y0);
+        __m256d sx = _mm256_sub_pd(_mm256_load_pd(leaf.x1), x0), sy = _mm256_sub_pd(_mm256_load_pd(leaf.y1), y0);
+        __m256d ax = _mm256_sub_pd(x0, ox), ay = _mm256_sub_pd(y0, oy);
+        __m256d bx = _mm256_sub_pd(_mm256_load_pd(leaf.x1), ox), by = _mm256_sub_pd(_mm256_load_pd(leaf.y1), oy);
+        __m256d segment_length = _mm256_add_pd(abs(sx), abs(sy));
+
+        __m256d side_a = _mm256_sub_pd(_mm256_mul_pd(ex, ay), _mm256_mul_pd(ey, ax));
+        __m256d side_b = _mm256_sub_pd(_mm256_mul_pd(ex, by), _mm256_mul_pd(ey, bx));
+        __m256d endpoint_extent = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(abs(ax), abs(ay)), _mm256_add_pd(abs(bx), abs(by))), scale);
+        __m256d ray_bound = _mm256_mul_pd(_mm256_mul_pd(tol, _mm256_add_pd(ray_length, scale)), endpoint_extent);
+        __m256d neg_ray_bound = _mm256_sub_pd(zero, ray_bound);
+        __m256d ray_separated = _mm256_or_pd(
+            _mm256_and_pd(_mm256_cmp_pd(side_a, ray_bound, _CMP_GT_OQ), _mm256_cmp_pd(side_b, ray_bound, _CMP_GT_OQ)),
+            _mm256_and_pd(_mm256_cmp_pd(side_a, neg_ray_bound, _CMP_LT_OQ), _mm256_cmp_pd(side_b, neg_ray_bound, _CMP_LT_OQ))
+        );
+
+        __m256d side_origin = _mm256_sub_pd(_mm256_mul_pd(sx, ay), _mm256_mul_pd(sy, ax));
+        __m256d side_end = _mm256_sub_pd(_mm256_mul_pd(sx, _mm256_sub_pd(ay, ey)), _mm256_mul_pd(sy, _mm256_sub_pd(ax, ex)));
+        __m256d origin_extent = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(abs(ax), abs(ay)), ray_length), scale);
+        __m256d segment_bound = _mm256_mul_pd(_mm256_mul_pd(tol, _mm256_add_pd(segment_length, scale)), origin_extent);
+        __m256d neg_segment_bound = _mm256_sub_pd(zero, segment_bound);
+        __m256d segment_separated = _mm256_or_pd(
+            _mm256_and_pd(_mm256_cmp_pd(side_origin, segment_bound, _CMP_GT_OQ), _mm256_cmp_pd(side_end, segment_bound, _CMP_GT_OQ)),
+            _mm256_and_pd(_mm256_cmp_pd(side_origin, neg_segment_bound, _CMP_LT_OQ), _mm256_cmp_pd(side_end, neg_segment_bound, _CMP_LT_OQ))
+        );
+        __m256d segment_hit = _mm256_andnot_pd(_mm256_or_pd(ray_separated, segment_separated), _mm256_cmp_pd(zero, zero, _CMP_EQ_OQ));
+
+        __m256d denominator = _mm256_sub_pd(side_origin, side_end);
+        __m256d abs_denominator = abs(denominator);
+        __m256d well_conditioned = _mm256_cmp_pd(abs_denominator, _mm256_mul_pd(two, segment_bound), _CMP_GT_OQ);
+        __m256d safe_denominator = _mm256_blendv_pd(one, denominator, well_conditioned);
+        __m256d safe_abs_denominator = _mm256_blendv_pd(one, abs_denominator, well_conditioned);
+        __m256d t = _mm256_div_pd(side_origin, safe_denominator);
+        __m256d spread = _mm256_div_pd(_mm256_mul_pd(two, segment_bound), safe_abs_denominator);
+        __m256d segment_t_min = _mm256_blendv_pd(zero, _mm256_max_pd(_mm256_sub_pd(t, spread), zero), well_conditioned);
+        __m256d segment_t_max = _mm256_blendv_pd(one, _mm256_min_pd(_mm256_add_pd(t, spread), one), well_conditioned);
+
+        // Select per lane and mask out padding
+        __m256d hit = _mm256_and_pd(valid, _mm256_blendv_pd(segment_hit, arc_hit, is_arc));
+        __m256d t_min = _mm256_blendv_pd(segment_t_min, arc_t_min, is_arc);
+        __m256d t_max = _mm256_blendv_pd(segment_t_max, arc_t_max, is_arc);
+        _mm256_store_pd(hits.t_min, _mm256_blendv_pd(zero, t_min, hit));
+        _mm256_store_pd(hits.t_max, _mm256_blendv_pd(one, t_max, hit));
+        hits.mask = static_cast<unsigned>(_mm256_movemask_pd(hit));
+        return hits.mask;
+    }
+#endif
+
+#ifdef __SSE2__
+    /**
+     * @brief SSE2 kernel processing the leaf as two pairs of lanes; matches @ref leaf_hits_scalar.
+     * @return Bit mask of lanes that may be hit; intervals are written to `hits`.
+     */
+    inline unsigned leaf_hits_sse2(const CurveLeaf& leaf, const RaySegment& ray, LeafHits& hits, double tolerance = DEFAULT_TOLERANCE) {
+        const __m128d zero = _mm_setzero_pd();
+        const __m128d one = _mm_set1_pd(1.0);
+        const __m128d two = _mm_set1_pd(2.0);
+        const __m128d four = _mm_set1_pd(4.0);
+        const __m128d sign = _mm_set1_pd(-0.0);
+        const __m128d all = _mm_cmpeq_pd(zero, zero);
+        auto abs = [&sign](__m128d value) { return _mm_andnot_pd(sign, value); };
+        // SSE2 has no blend instruction, so select bitwise
+        auto select = [](__m128d mask, __m128d if_false, __m128d if_true) { return _mm_or_pd(_mm_and_pd(mask, if_true), _mm_andnot_pd(mask, if_false)); };
+
+        const __m128d scale = _mm_set1_pd(ray.scale);
+        const __m128d tol = _mm_set1_pd(tolerance);
+        const __m128d slack = _mm_set1_pd(tolerance * ray.scale);
+        const __m128d ex = _mm_set1_pd(ray.direction_x), ey = _mm_set1_pd(ray.direction_y);
+        const __m128d ox = _mm_set1_pd(ray.origin_x), oy = _mm_set1_pd(ray.origin_y);
+        const __m128d ray_length = _mm_set1_pd(std::abs(ray.direction_x) + std::abs(ray.direction_y));
+
+        hits.mask = 0;
+        for (std::size_t base = 0; base < LANES; base += 2) {
+            const __m128d lane_index = _mm_set_pd(static_cast<double>(base + 1), static_cast<double>(base));
+            const __m128d valid = _mm_cmplt_pd(lane_index, _mm_set1_pd(static_cast<double>(leaf.count)));
+            const __m128d radius = _mm_load_pd(leaf.radius + base);
+            const __m128d is_arc = _mm_cmpgt_pd(radius, zero);
+
+            // Circular lanes
+            __m128d fx = _mm_sub_pd(ox, _mm_load_pd(leaf.center_x + base));
+            __m128d fy = _mm_sub_pd(oy, _mm_load_pd(leaf.center_y + base));
+            __m128d a = _mm_add_pd(_mm_mul_pd(ex, ex), _mm_mul_pd(ey, ey));
+            __m128d b = _mm_mul_pd(two, _mm_add_pd(_mm_mul_pd(ex, fx), _mm_mul_pd(ey, fy)));
+            __m128d f2 = _mm_add_pd(_mm_mul_pd(fx, fx), _mm_mul_pd(fy, fy));
+            __m128d outer = _mm_add_pd(radius, slack);
+            __m128d inner = _mm_max_pd(_mm_sub_pd(radius, slack), zero);
+            __m128d b2 = _mm_mul_pd(b, b);
+            __m128d four_a = _mm_mul_pd(four, a);
+            __m128d two_a = _mm_mul_pd(two, a);
+            __m128d disc_outer = _mm_sub_pd(b2, _mm_mul_pd(four_a, _mm_sub_pd(f2, _mm_mul_pd(outer, outer))));
+            __m128d root_outer = _mm_sqrt_pd(_mm_max_pd(disc_outer, zero));
+            __m128d neg_b = _mm_sub_pd(zero, b);
+            __m128d t_low = _mm_div_pd(_mm_sub_pd(neg_b, root_outer), two_a);
+            __m128d t_high = _mm_div_pd(_mm_add_pd(neg_b, root_outer), two_a);
+            __m128d arc_hit = _mm_and_pd(_mm_cmpge_pd(disc_outer, zero), _mm_cmpneq_pd(a, zero));
+            arc_hit = _mm_and_pd(arc_hit, _mm_cmpge_pd(t_high, zero));
+            arc_hit = _mm_and_pd(arc_hit, _mm_cmple_pd(t_low, one));
+            __m128d disc_inner = _mm_sub_pd(b2, _mm_mul_pd(four_a, _mm_sub_pd(f2, _mm_mul_pd(inner, inner))));
+            __m128d root_inner = _mm_sqrt_pd(_mm_max_pd(disc_inner, zero));
+            __m128d inside = _mm_cmpgt_pd(disc_inner, zero);
+            inside = _mm_and_pd(inside, _mm_cmplt_pd(_mm_div_pd(_mm_sub_pd(neg_b, root_inner), two_a), zero));
+            inside = _mm_and_pd(inside, _mm_cmpgt_pd(_mm_div_pd(_mm_add_pd(neg_b, root_inner), two_a), one));
+            arc_hit = _mm_andnot_pd(inside, arc_hit);
+            __m128d arc_t_min = _mm_max_pd(t_low, zero);
+            __m128d arc_t_max = _mm_min_pd(t_high, one);
+
+            // Segment lanes
+            __m128d x0 = _mm_load_pd(leaf.x0 + base), y0 = _mm_load_pd(leaf.y0 + base);
+            __m128d x1 = _mm_load_pd(leaf.x1 + base), y1 = _mm_load_pd(leaf.y1 + base);
+            __m128d sx = _mm_sub_pd(x1, x0), sy = _mm_sub_pd(y1, y0);
+            __m128d ax = _mm_sub_pd(x0, ox), ay = _mm_sub_pd(y0, oy);
+            __m128d bx = _mm_sub_pd(x1, ox), by = _mm_sub_pd(y1, oy);
+            __m128d segment_length = _mm_add_pd(abs(sx), abs(sy));
+
+            __m128d side_a = _mm_sub_pd(_mm_mul_pd(ex, ay), _mm_mul_pd(ey, ax));
+            __m128d side_b = _mm_sub_pd(_mm_mul_pd(ex, by), _mm_mul_pd(ey, bx));
+            __m128d endpoint_extent = _mm_add_pd(_mm_add_pd(_mm_add_pd(abs(ax), abs(ay)), _mm_add_pd(abs(bx), abs(by))), scale);
+            __m128d ray_bound = _mm_mul_pd(_mm_mul_pd(tol, _mm_add_pd(ray_length, scale)), endpoint_extent);
+            __m128d neg_ray_bound = _mm_sub_pd(zero, ray_bound);
+            __m128d ray_separated = _mm_or_pd(
+                _mm_and_pd(_mm_cmpgt_pd(side_a, ray_bound), _mm_cmpgt_pd(side_b, ray_bound)),
+                _mm_and_pd(_mm_cmplt_pd(side_a, neg_ray_bound), _mm_cmplt_pd(side_b, neg_ray_bound))
+            );
+
+            __m128d side_origin = _mm_sub_pd(_mm_mul_pd(sx, ay), _mm_mul_pd(sy, ax));
+            __m128d side_end = _mm_sub_pd(_mm_mul_pd(sx, _mm_sub_pd(ay, ey)), _mm_mul_pd(sy, _mm_sub_pd(ax, ex)));
+            __m128d origin_extent = _mm_add_pd(_mm_add_pd(_mm_add_pd(abs(ax), abs(ay)), ray_length), scale);
+            __m128d segment_bound = _mm_mul_pd(_mm_mul_pd(tol, _mm_add_pd(segment_length, scale)), origin_extent);
+            __m128d neg_segment_bound = _mm_sub_pd(zero, segment_bound);
+            __m128d segment_separated = _mm_or_pd(
+                _mm_and_pd(_mm_cmpgt_pd(side_origin, segment_bound), _mm_cmpgt_pd(side_end, segment_bound)),
+                _mm_and_pd(_mm_cmplt_pd(side_origin, neg_segment_bound), _mm_cmplt_pd(side_end, neg_segment_bound))
+            );
+            __m128d segment_hit = _mm_andnot_pd(_mm_or_pd(ray_separated, segment_separated), all);
+
+            __m128d denominator = _mm_sub_pd(side_origin, side_end);
+            __m128d abs_denominator = abs(denominator);
+            __m128d well_conditioned = _mm_cmpgt_pd(abs_denominator, _mm_mul_pd(two, segment_bound));
+            __m128d t = _mm_div_pd(side_origin, select(well_conditioned, one, denominator));
+            __m128d spread = _mm_div_pd(_mm_mul_pd(two, segment_bound), select(well_conditioned, one, abs_denominator));
+            __m128d segment_t_min = select(well_conditioned, zero, _mm_max_pd(_mm_sub_pd(t, spread), zero));
+            __m128d segment_t_max = select(well_conditioned, one, _mm_min_pd(_mm_add_pd(t, spread), one));
+
+            // Select per lane and mask out padding
+            __m128d hit = _mm_and_pd(valid, select(is_arc, segment_hit, arc_hit));
+            __m128d t_min = select(is_arc, segment_t_min, arc_t_min);
+            __m128d t_max = select(is_arc, segment_t_max, arc_t_max);
+            _mm_store_pd(hits.t_min + base, select(hit, zero, t_min));
+            _mm_store_pd(hits.t_max + base, select(hit, one, t_max));
+            hits.mask |= static_cast<unsigned>(_mm_movemask_pd(hit)) << base;
+        }
+        return hits.mask;
+    }
+#endif
+
+    /** @brief Name of the kernel selected by @ref leaf_hits (`"avx2"`, `"sse2"`, or `"scalar"`). */
+    constexpr const char* active_kernel() noexcept {
+#if defined(__AVX2__)
+        return "avx2";
+#elif defined(__SSE2__)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    /**
+     * @brief Test `ray` against every curve of `leaf` with the widest kernel compiled in.
+     * @return Bit mask of lanes that may be hit; intervals are written to `hits`.
+     */
+    inline unsigned leaf_hits(const CurveLeaf& leaf, const RaySegment& ray, LeafHits& hits, double tolerance = DEFAULT_TOLERANCE) {
+#if defined(__AVX2__)
+        return leaf_hits_avx2(leaf, ray, hits, tolerance);
+#elif defined(__SSE2__)
+        return leaf_hits_sse2(leaf, ray, hits, tolerance);
+#else
+        return leaf_hits_scalar(leaf, ray, hits, tolerance);
+#endif
+    }
+
+}
+
+#endif
@@ -0,0 +1,329 @@
+#ifndef BURST_SWARM_HPP
+#define BURST_SWARM_HPP
+
+#include <cstdint>
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <source_location>
+
+#include "geometry.hpp"
+#include "numeric.hpp"
+#include "configuration_space.hpp"
+#include "models.hpp"
+#include "robot.hpp"
+#include "memory.hpp"
+#include "logging.hpp"
+#include "tracing.hpp"
+
+/**
+ * @file swarm.hpp
+ * @brief Large robot populations as compact per-robot states driven by one shared, immutable model.
+ *
+ * A @ref Robot owns its rotation model (a full `std::mt19937`), its movement model and a
+ * reference to the configuration space, which makes it several kilobytes. A @ref Swarm keeps only
+ * a @ref RobotState per robot (the exact position and a counter-based noise stream) in one
+ * contiguous array, and shares a @ref RobotModel holding everything the robots have in common.
+ */
+
+namespace BURST {
+
+    /**
+     * @brief Per-robot state of a @ref Swarm: position and position in its noise stream.
+     *
+     * Rotation noise is drawn from a @ref numeric::CounterEngine at (`stream`, `counter`), so
+     * copying a state copies its noise sequence, and resetting `counter` replays it.
+     */
+    struct RobotState {
+        geometry::Point2D position;     ///< Current position, on the configuration-space boundary
+        std::uint64_t stream;           ///< Noise stream identifier
+        std::uint64_t counter;          ///< Index of the next noise draw in the stream
+    };
+
+    /**
+     * @brief Everything robots of one kind share: radius, rotation-noise bound, movement model and configuration space.
+     *
+     * The model is immutable once created and is meant to be held through a
+     * `std::shared_ptr<const RobotModel>`. Its member functions only modify the @ref RobotState
+     * passed to them, so one model can step any number of states from any number of threads.
+     *
+     * @tparam T Trajectory type for the movement model (default @ref geometry::Ray2D).
+     * @tparam P Path type for boundary-to-boundary segments (default @ref geometry::Segment2D).
+     * @tparam D Distribution of rotation noise over `[-1, 1]` (default `std::uniform_real_distribution<double>`).
+     */
+    template <
+        geometry::valid_trajectory_type T = geometry::Ray2D,
+        geometry::valid_path_type P = geometry::Segment2D,
+        numeric::valid_distribution<numeric::CounterEngine> D = std::uniform_real_distribution<double>
+    >
+    class RobotModel {
+    private:
+        numeric::fscalar radius;
+        numeric::fscalar max_rotation_error;
+        models::MovementModel<T, P> movement_model;
+        std::shared_ptr<geometry::ConfigurationSpace> configuration_space;
+
+        // Private constructor since preconditions are validated by the public static create function
+        RobotModel(numeric::fscalar radius, numeric::fscalar max_rotation_error, models::MovementModel<T, P> movement_model, std::shared_ptr<geometry::ConfigurationSpace> configuration_space) :
+            radius{radius},
+            max_rotation_error{CGAL::abs(max_rotation_error)},
+            movement_model{std::move(movement_model)},
+            configuration_space{std::move(configuration_space)} {}
+
+    public:
+        using MovementModelType = models::MovementModel<T, P>;     /**< Concrete movement model type. */
+
+        /**
+         * @brief Construct a shared robot model.
+         * @param robot_radius Physical radius of the disk; must be positive.
+         * @param max_rotation_error Absolute bound on additive heading error (magnitude is taken).
+         * @param configuration_space Configuration space for `robot_radius`.
+         * @param movement_model Movement model, e.g. an @ref models::ArcMovementModel with its curvature.
+         * @return `std::nullopt` if `robot_radius <= 0` or there is no configuration space.
+         */
+        static std::optional<RobotModel> create(numeric::fscalar robot_radius, numeric::fscalar max_rotation_error, std::shared_ptr<geometry::ConfigurationSpace> configuration_space, MovementModelType movement_model = {}, const std::source_location location = std::source_location::current()) {
+            if (robot_radius <= 0) {
+                burst_error("Cannot construct a robot model with non-positive radius", location);
+                return std::nullopt;
+            }
+            if (!configuration_space) {
+                burst_error("Cannot construct a robot model without a configuration space", location);
+                return std::nullopt;
+            }
+            return RobotModel{robot_radius, max_rotation_error, std::move(movement_model), std::move(configuration_space)};
+        }
+
+        /** @brief Physical radius of every robot. */
+        const numeric::fscalar& getRadius() const noexcept {
+            return this->radius;
+        }
+        /** @brief Absolute bound on the additive heading error. */
+        const numeric::fscalar& getMaxRotationError() const noexcept {
+            return this->max_rotation_error;
+        }
+        /** @brief Movement model shared by every robot. */
+        const MovementModelType& getMovementModel() const noexcept {
+            return this->movement_model;
+        }
+        /** @brief Configuration space shared by every robot. */
+        const geometry::ConfigurationSpace& getConfigurationEnvironment() const noexcept {
+            return *this->configuration_space;
+        }
+        /** @brief Configuration space as a shared pointer, e.g. to attach it to a @ref Robot. */
+        const std::shared_ptr<geometry::ConfigurationSpace>& getConfigurationEnvironmentPtr() const noexcept {
+            return this->configuration_space;
+        }
+
+        /**
+         * @brief Sample a perturbed heading from the noise stream of `state`, advancing its counter.
+         * @return `angle + noise * max_rotation_error`, with the noise drawn from `D` over `[-1, 1]`.
+         */
+        numeric::fscalar perturb(const numeric::fscalar& angle, RobotState& state) const {
+            numeric::CounterEngine engine{state.stream, state.counter};
+            D distribution{-1.0, 1.0};
+            numeric::fscalar sample = angle + distribution(engine) * this->max_rotation_error;
+            state.counter = engine.counter();
+            return sample;
+        }
+
+        /**
+         * @brief Move `state` like @ref Robot::step moves a robot.
+         * @return Step result; the position is unchanged unless the status is @ref StepStatus::Moved.
+         */
+        StepResult step(RobotState& state, const numeric::fscalar& angle, bool perturbed = false, const std::source_location location = std::source_location::current()) const {
+            numeric::fscalar effective_angle = perturbed ? this->perturb(angle, state) : angle;
+            std::optional<geometry::Point2D> endpoint = this->movement_model(state.position, effective_angle, *this->configuration_space, location);
+            if (!endpoint.has_value()) return StepResult{state.position, std::nullopt, angle, effective_angle - angle, StepStatus::Invalid};
+            state.position = *endpoint;
+
+            // As in Robot::step, the endpoint lies on the curve that stopped the robot
+            std::optional<std::size_t> curve = this->configuration_space->boundary().locate(state.position);
+            return StepResult{state.position, curve, angle, effective_angle - angle, StepStatus::Moved};
+        }
+    };
+
+    /**
+     * @brief Independent robots stored as a contiguous array of @ref RobotState over one shared @ref RobotModel.
+     *
+     * Robots do not interact (see @ref World for contacts between robots), which suits particle
+     * methods and Monte Carlo estimates over many starts. Batch steps run over contiguous blocks of
+     * states in parallel. Every robot draws noise only from its own counter-based stream, so the
+     * results do not depend on the thread count.
+     *
+     * @tparam T Trajectory type for the movement model (default @ref geometry::Ray2D).
+     * @tparam P Path type for boundary-to-boundary segments (default @ref geometry::Segment2D).
+     * @tparam D Distribution of rotation noise (default `std::uniform_real_distribution<double>`).
+     */
+    template <
+        geometry::valid_trajectory_type T = geometry::Ray2D,
+        geometry::valid_path_type P = geometry::Segment2D,
+        numeric::valid_distribution<numeric::CounterEngine> D = std::uniform_real_distribution<double>
+    >
+    class Swarm {
+    public:
+        using ModelType = RobotModel<T, P, D>;     /**< Shared model type. */
+
+        /** @brief Fewest robots per worker thread before splitting a batch step. */
+        static constexpr std::size_t MIN_ROBOTS_PER_THREAD = 8;
+
+    private:
+        std::shared_ptr<const ModelType> shared_model;
+        std::vector<RobotState> robot_states;
+        std::size_t thread_count;
+
+        Swarm(std::shared_ptr<const ModelType> shared_model, std::vector<RobotState> robot_states, std::size_t thread_count) :
+            shared_model{std::move(shared_model)},
+            robot_states{std::move(robot_states)},
+            thread_count{thread_count} {}
+
+        // Run work(begin, end) over contiguous blocks of states, in parallel when there are enough robots
+        template <typename Work>
+        void forEachBlock(const Work& work) {
+            std::size_t count = this->robot_states.size();
+            std::size_t threads = std::min(this->thread_count, std::max<std::size_t>(count / MIN_ROBOTS_PER_THREAD, 1));
+            if (threads <= 1) {
+                work(std::size_t{0}, count);
+                return;
+            }
+            std::size_t block = (count + threads - 1) / threads;
+            std::vector<std::jthread> workers;
+            workers.reserve(threads - 1);
+            for (std::size_t begin = block; begin < count; begin += block) workers.emplace_back([&work, begin, block, count]() {
+                work(begin, std::min(begin + block, count));
+            });
+            work(std::size_t{0}, std::min(block, count));
+        }
+
+    public:
+        /**
+         * @brief Place one robot at every start.
+         * @param model Shared model of every robot.
+         * @param starts Start positions, each on the boundary of the model's configuration space.
+         * @param seed Seed from which each robot's noise stream is derived.
+         * @param threads Worker threads for batch steps (0 uses the hardware concurrency).
+         * @return `std::nullopt` if there is no model or no start, or a start is off the boundary.
+         */
+        static std::optional<Swarm> create(std::shared_ptr<const ModelType> model, std::span<const geometry::Point2D> starts, std::uint64_t seed, std::size_t threads = 0, const std::source_location location = std::source_location::current()) {
+            if (!model) {
+                burst_error("Cannot construct a swarm without a robot model", location);
+                return std::nullopt;
+            }
+            if (starts.empty()) {
+                burst_error("Cannot construct a swarm without robots", location);
+                return std::nullopt;
+            }
+            std::vector<RobotState> states;
+            states.reserve(starts.size());
+            for (std::size_t index = 0; index < starts.size(); ++index) {
+                if (!model->getConfigurationEnvironment().onEdge(starts[index])) {
+                    std::string error_string = "Cannot place robot " + std::to_string(index) + " of a swarm off the configuration space boundary";
+                    burst_error(error_string.c_str(), location);
+                    return std::nullopt;
+                }
+                states.push_back(RobotState{starts[index], numeric::CounterEngine::at(seed, index), 0});
+            }
+            if (threads == 0) threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            return Swarm{std::move(model), std::move(states), threads};
+        }
+
+        /** @brief Number of robots. */
+        std::size_t size() const noexcept {
+            return this->robot_states.size();
+        }
+        /** @brief Shared model of every robot. */
+        const ModelType& model() const noexcept {
+            return *this->shared_model;
+        }
+        /** @brief States of every robot, in index order. */
+        std::span<const RobotState> states() const noexcept {
+            return this->robot_states;
+        }
+        /** @brief State of robot `index` (unchecked). */
+        const RobotState& state(std::size_t index) const noexcept {
+            return this->robot_states[index];
+        }
+        /** @brief Position of every robot, in index order. */
+        std::vector<geometry::Point2D> positions() const {
+            std::vector<geometry::Point2D> result;
+            result.reserve(this->robot_states.size());
+            for (const RobotState& state : this->robot_states) result.push_back(state.position);
+            return result;
+        }
+
+        /**
+         * @brief Move every robot once along its own heading.
+         * @param angles One heading per robot, in robot index order.
+         * @param perturbed Whether each heading is first perturbed from the robot's noise stream.
+         * @return Result per robot, or `std::nullopt` if the number of headings does not match the number of robots.
+         */
+        std::optional<std::vector<StepResult>> step(std::span<const numeric::fscalar> angles, bool perturbed = false, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"Swarm::step"};
+            if (angles.size() != this->robot_states.size()) {
+                burst_error("Number of headings does not match the number of robots in the swarm", location);
+                return std::nullopt;
+            }
+            std::vector<StepResult> results(this->robot_states.size());
+            this->forEachBlock([this, &results, &angles, perturbed, &location](std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; ++index) results[index] = this->shared_model->step(this->robot_states[index], angles[index], perturbed, location);
+            });
+            return results;
+        }
+        /**
+         * @brief Move every robot once along the heading `policy` chooses from its state.
+         *
+         * `policy` is called as `policy(state)` from the worker threads, so it must be safe to call concurrently.
+         *
+         * @return Result per robot, in robot index order.
+         */
+        template <typename Policy> requires std::invocable<const Policy&, const RobotState&> && std::convertible_to<std::invoke_result_t<const Policy&, const RobotState&>, numeric::fscalar>
+        std::vector<StepResult> step(const Policy& policy, bool perturbed = false, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"Swarm::step"};
+            std::vector<StepResult> results(this->robot_states.size());
+            this->forEachBlock([this, &results, &policy, perturbed, &location](std::size_t begin, std::size_t end) {
+                for (std::size_t index = begin; index < end; ++index) {
+                    numeric::fscalar angle = std::invoke(policy, std::as_const(this->robot_states[index]));
+                    results[index] = this->shared_model->step(this->robot_states[index], angle, perturbed, location);
+                }
+            });
+            return results;
+        }
+
+        /**
+         * @brief Stand-alone @ref Robot at the position of robot `index`, sharing the configuration space.
+         *
+         * The robot gets its own `std::mt19937` rotation model seeded from the robot's stream, so
+         * its noise differs from the swarm's.
+         *
+         * @return Robot, or `std::nullopt` if `index` is out of range.
+         */
+        std::optional<Robot<T, P, std::mt19937, D>> robot(std::size_t index, const std::source_location location = std::source_location::current()) const requires numeric::valid_distribution<D, std::mt19937> {
+            if (index >= this->robot_states.size()) {
+                burst_error("Robot index is out of range for the swarm", location);
+                return std::nullopt;
+            }
+            const RobotState& state = this->robot_states[index];
+            models::RotationModel<std::mt19937, D> rotation_model{this->shared_model->getMaxRotationError(), static_cast<unsigned int>(state.stream)};
+            auto robot = Robot<T, P, std::mt19937, D>::create(this->shared_model->getRadius(), state.position, rotation_model, this->shared_model->getMovementModel(), StartPlacement::AsGiven, location);
+            if (robot) robot->setConfigurationEnvironment(this->shared_model->getConfigurationEnvironmentPtr(), location);
+            return robot;
+        }
+
+        /**
+         * @brief Estimated footprint of the robot states.
+         * @return Memory usage; the shared model and its configuration space are not included.
+         */
+        memory::MemoryUsage memoryUsage() const noexcept {
+            return memory::MemoryUsage{sizeof(*this) + memory::container_bytes(this->robot_states), 0, this->robot_states.size() * memory::EXACT_POINT_BYTES};
+        }
+    };
+
+}
+
+#endif
@@ -0,0 +1,281 @@
+#ifndef BURST_SYMMETRY_HPP
+#define BURST_SYMMETRY_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <ranges>
+#include <utility>
+
+#include "numeric.hpp"
+#include "geometry.hpp"
+#include "wall_space.hpp"
+
+/**
+ * @file symmetry.hpp
+ * @brief Exact symmetry group of a @ref geometry::WallSpace and orbit representatives for start states.
+ */
+
+namespace BURST::geometry {
+
+    /**
+     * @brief Start state of a robot: a position and a heading angle in radians.
+     */
+    struct StartState {
+        Point2D position;
+        numeric::fscalar angle;
+    };
+
+    /**
+     * @brief Rigid motions (rotations and reflections) mapping a layout onto itself.
+     *
+     * The group is computed exactly from the outer ring. Any symmetry maps outer vertex 0 to some
+     * outer vertex `j`, keeping or reversing the traversal direction, so each of the `2n` candidates
+     * is first screened by comparing the cyclic sequences of rigid corner invariants used by
+     * @ref WallSpace::canonical and then confirmed by matching the moved holes against the originals.
+     * The identity is always element 0, followed by the other rotations and then the reflections.
+     *
+     * States in the same orbit are equivalent for any strategy that only depends on the geometry, so
+     * sweeps can evaluate @ref canonical representatives only and expand results with @ref orbit.
+     * Positions are mapped exactly. Headings are mapped through the rotation angle of each element
+     * evaluated in @ref numeric::hpscalar, and are compared with @ref ANGLE_TOLERANCE.
+     *
+     * Configuration spaces are built with approximated offsets, so the image of a point on the
+     * boundary of a robot's configuration space can lie off that boundary by up to the offset
+     * tolerance; snap it back (e.g. with @ref ConfigurationSpace::nearestBoundaryPoint) before
+     * placing a robot there.
+     */
+    class SymmetryGroup {
+    public:
+        /** @brief Headings closer than this (in radians, modulo a full turn) are treated as equal. */
+        static constexpr double ANGLE_TOLERANCE = 1e-12;
+
+        /** @brief One symmetry of the layout. */
+        struct Element {
+            Transformation transformation;  /**< Rigid motion mapping the layout onto itself. */
+            bool reflection;                /**< Whether the motion reverses orientation. */
+            numeric::fscalar turn;          /**< Rotation angle, or twice the mirror axis angle for reflections. */
+
+            /**
+             * @brief Image of `point`.
+             * @return Mapped point.
+             */
+            Point2D operator()(const Point2D& point) const {
+                return this->transformation(point);
+            }
+            /**
+             * @brief Image of the heading `angle`, normalized to `[0, 2π)`.
+             * @return Mapped heading.
+             */
+            numeric::fscalar angle(const numeric::fscalar& angle) const {
+                return SymmetryGroup::normalize(this->reflection ? this->turn - angle : this->turn + angle);
+            }
+            /**
+             * @brief Image of `state`.
+             * @return Mapped start state.
+             */
+            StartState operator()(const StartState& state) const {
+                return StartState{(*this)(state.position), this->angle(state.angle)};
+            }
+        };
+
+    private:
+        std::vector<Element> elements;
+        std::size_t rotation_count;
+
+        SymmetryGroup(std::vector<Element> elements, std::size_t rotation_count) noexcept : elements{std::move(elements)}, rotation_count{rotation_count} {}
+
+        // Heading reduced to [0, 2π)
+        static numeric::fscalar normalize(const numeric::fscalar& angle) {
+            numeric::hpscalar two_pi = 2 * boost::multiprecision::acos(numeric::hpscalar{-1});
+            numeric::hpscalar reduced = boost::multiprecision::fmod(numeric::to_high_precision(angle), two_pi);
+            if (reduced < 0) reduced += two_pi;
+            return numeric::to_fscalar(reduced);
+        }
+
+        // Whether two headings agree up to ANGLE_TOLERANCE, modulo a full turn
+        static bool same_angle(const numeric::fscalar& a, const numeric::fscalar& b) {
+            double difference = std::fabs(std::remainder(CGAL::to_double(a) - CGAL::to_double(b), 2 * CGAL_PI));
+            return difference <= ANGLE_TOLERANCE;
+        }
+
+        // Order of start states: position lexicographically, then heading
+        static bool less(const StartState& a, const StartState& b) {
+            CGAL::Comparison_result result = CGAL::compare_xy(a.position, b.position);
+            if (result != CGAL::EQUAL) return result == CGAL::SMALLER;
+            return !same_angle(a.angle, b.angle) && CGAL::to_double(a.angle) < CGAL::to_double(b.angle);
+        }
+
+        static bool same(const StartState& a, const StartState& b) {
+            return a.position == b.position && same_angle(a.angle, b.angle);
+        }
+
+        static Element make_element(const Transformation& transformation, bool reflection) {
+            numeric::hpscalar turn = boost::multiprecision::atan2(numeric::to_high_precision(transformation.m(1, 0)), numeric::to_high_precision(transformation.m(0, 0)));
+            return Element{transformation, reflection, numeric::to_fscalar(turn)};
+        }
+
+    public:
+        /**
+         * @brief Compute the exact symmetry group of `walls`.
+         * @return Symmetry group containing at least the identity.
+         */
+        static SymmetryGroup of(const WallSpace& walls) {
+            std::vector<Point2D> ring{walls.vertices_begin(), walls.vertices_end()};
+            std::size_t n = ring.size();
+            // Rigid corner invariants at each vertex: outgoing squared edge length, cross and dot products with the incoming edge
+            std::vector<std::array<numeric::fscalar, 3>> signature(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                Vector2D incoming = ring[i] - ring[(i + n - 1) % n];
+                Vector2D outgoing = ring[(i + 1) % n] - ring[i];
+                signature[i] = {outgoing.squared_length(), incoming.x() * outgoing.y() - incoming.y() * outgoing.x(), incoming * outgoing};
+            }
+
+            auto holes = std::ranges::subrange(walls.holes_begin(), walls.holes_end());
+            std::vector<Polygon2D> original = detail::normalized_holes(holes, Transformation{CGAL::IDENTITY});
+            auto holes_match = [&holes, &original](const Transformation& transformation) {
+                std::vector<Polygon2D> moved = detail::normalized_holes(holes, transformation);
+                for (std::size_t i = 0; i < moved.size(); ++i) {
+                    if (detail::compare_rings(moved[i], original[i]) != CGAL::EQUAL) return false;
+                }
+                return true;
+            };
+
+            Transformation from = detail::edge_frame(ring[0], ring[1]);
+            std::vector<Element> elements;
+
+            // Rotations take vertex k to vertex j + k
+            for (std::size_t j = 0; j < n; ++j) {
+                bool candidate = true;
+                for (std::size_t k = 0; k < n && candidate; ++k) candidate = signature[k] == signature[(j + k) % n];
+                if (!candidate) continue;
+                Transformation rotation = j == 0 ? Transformation{CGAL::IDENTITY} : detail::edge_frame(ring[j], ring[(j + 1) % n]).inverse() * from;
+                if (holes_match(rotation)) elements.push_back(make_element(rotation, false));
+            }
+            std::size_t rotation_count = elements.size();
+
+            // Reflections take vertex k to vertex j - k; walking the image backwards swaps which edge is outgoing
+            Transformation mirror{1, 0, 0, 0, -1, 0};
+            for (std::size_t j = 0; j < n; ++j) {
+                bool candidate = true;
+                for (std::size_t k = 0; k < n && candidate; ++k) {
+                    std::size_t image = (j + n - k) % n;
+                    candidate = signature[k][0] == signature[(image + n - 1) % n][0] && signature[k][1] == signature[image][1] && signature[k][2] == signature[image][2];
+                }
+                if (!candidate) continue;
+                Transformation reflection = detail::edge_frame(ring[j], ring[(j + n - 1) % n]).inverse() * mirror * from;
+                if (holes_match(reflection)) elements.push_back(make_element(reflection, true));
+            }
+
+            return SymmetryGroup{std::move(elements), rotation_count};
+        }
+
+        /**
+         * @brief Number of symmetries, including the identity.
+         * @return Group order.
+         */
+        std::size_t size() const noexcept {
+            return this->elements.size();
+        }
+        /**
+         * @brief Number of rotations, including the identity.
+         * @return Rotation subgroup order.
+         */
+        std::size_t rotations() const noexcept {
+            return this->rotation_count;
+        }
+        /**
+         * @brief Number of reflections.
+         * @return Reflection count.
+         */
+        std::size_t reflections() const noexcept {
+            return this->elements.size() - this->rotation_count;
+        }
+        /**
+         * @brief Whether the layout has no symmetry beyond the identity.
+         * @return True if the group is trivial.
+         */
+        bool trivial() const noexcept {
+            return this->elements.size() == 1;
+        }
+
+        /**
+         * @brief Symmetry at `index` (0 is the identity).
+         * @return Group element.
+         */
+        const Element& operator[](std::size_t index) const {
+            return this->elements[index];
+        }
+        std::vector<Element>::const_iterator begin() const noexcept { return this->elements.begin(); }
+        std::vector<Element>::const_iterator end() const noexcept { return this->elements.end(); }
+
+        /**
+         * @brief Canonical representative of the orbit of `state`.
+         *
+         * The representative is the image with the lexicographically smallest position, breaking ties
+         * by the smaller heading in `[0, 2π)`, so every state of an orbit maps to the same one.
+         *
+         * @return Representative, and the index of an element mapping `state` onto it.
+         */
+        std::pair<StartState, std::size_t> canonical(const StartState& state) const {
+            StartState best = this->elements.front()(state);
+            std::size_t best_index = 0;
+            for (std::size_t i = 1; i < this->elements.size(); ++i) {
+                StartState image = this->elements[i](state);
+                if (less(image, best)) {
+                    best = std::move(image);
+                    best_index = i;
+                }
+            }
+            return {std::move(best), best_index};
+        }
+        /** @copydoc canonical */
+        std::pair<Point2D, std::size_t> canonical(const Point2D& point) const {
+            Point2D best = point;
+            std::size_t best_index = 0;
+            for (std::size_t i = 1; i < this->elements.size(); ++i) {
+                Point2D image = this->elements[i](point);
+                if (CGAL::compare_xy(image, best) == CGAL::SMALLER) {
+                    best = image;
+                    best_index = i;
+                }
+            }
+            return {best, best_index};
+        }
+
+        /**
+         * @brief Distinct images of `state`, starting with `state` itself (heading normalized to `[0, 2π)`).
+         *
+         * A result computed for one state holds for every state returned here, so sweeps over
+         * canonical representatives are expanded back to full coverage with this list.
+         *
+         * @return Orbit of `state`; its size divides @ref size.
+         */
+        std::vector<StartState> orbit(const StartState& state) const {
+            std::vector<StartState> images;
+            for (const Element& element : this->elements) {
+                StartState image = element(state);
+                bool seen = false;
+                for (const StartState& other : images) {
+                    if (same(image, other)) {
+                        seen = true;
+                        break;
+                    }
+                }
+                if (!seen) images.push_back(std::move(image));
+            }
+            return images;
+        }
+        /**
+         * @brief Number of distinct images of `state`, the weight of its representative in a sweep.
+         * @return Orbit size.
+         */
+        std::size_t orbitSize(const StartState& state) const {
+            return this->orbit(state).size();
+        }
+    };
+
+}
+
+#endif
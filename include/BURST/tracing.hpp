@@ -0,0 +1,352 @@
+#ifndef BURST_TRACING_HPP
+#define BURST_TRACING_HPP
+
+/**
+ * @file tracing.hpp
+ * @brief Optional scoped trace spans recorded per thread and exported as Chrome trace JSON.
+ *
+ * Define `BURST_ENABLE_TRACING` before including any BURST header (preferably target-wide, since the
+ * definition changes the layout of @ref BURST::tracing::Span) to record spans. Each thread writes
+ * into its own bounded ring buffer, so recording never contends with other threads and the oldest
+ * events are overwritten once a buffer is full. Buffers grow on demand up to their capacity, and a
+ * buffer left behind by an exited thread is released once its events have been cleared. The collected events can be written in the
+ * Chrome trace event format and opened in `chrome://tracing` or Perfetto to inspect per-thread
+ * timelines of a run. Without `BURST_ENABLE_TRACING`, spans are empty objects and every function
+ * in this header is a no-op.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <ostream>
+
+#ifdef BURST_ENABLE_TRACING
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#endif
+
+namespace BURST::tracing {
+
+    /** @brief Number of events each thread's ring buffer holds before overwriting the oldest. */
+    constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 1 << 16;
+
+    /**
+     * @brief A completed span as stored in a thread's ring buffer.
+     *
+     * Timestamps are nanoseconds relative to the first use of the tracing registry in the process.
+     */
+    struct Event {
+        const char* name;
+        std::uint64_t start_ns;
+        std::uint64_t duration_ns;
+    };
+
+#ifdef BURST_ENABLE_TRACING
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        /*
+         * Bounded ring buffer owned by one recording thread
+         * Storage grows with the events recorded until it reaches the capacity, and is released on clear
+         * The mutex is only contended while the buffer is being exported or cleared, so recording stays cheap
+         */
+        class RingBuffer {
+        private:
+            mutable std::mutex buffer_mutex;
+            std::vector<Event> events;
+            std::size_t capacity;
+            std::size_t head;
+            std::size_t count;
+            std::uint32_t thread_id;
+            std::string thread_name;
+            std::atomic<bool> retired;
+
+        public:
+            RingBuffer(std::size_t capacity, std::uint32_t thread_id) : events{}, capacity{std::max<std::size_t>(capacity, 1)}, head{0}, count{0}, thread_id{thread_id}, thread_name{}, retired{false} {}
+
+            void push(const Event& event) {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                if (this->events.size() < this->capacity) this->events.push_back(event);
+                else this->events[this->head] = event;
+                this->head = (this->head + 1) % this->capacity;
+                if (this->count < this->capacity) this->count++;
+            }
+
+            // Copy the buffered events out in recording order (oldest first)
+            std::vector<Event> snapshot() const {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                std::vector<Event> ordered;
+                if (this->count == 0) return ordered;
+                ordered.reserve(this->count);
+                std::size_t start = (this->head + this->events.size() - this->count) % this->events.size();
+                for (std::size_t i = 0; i < this->count; ++i) ordered.push_back(this->events[(start + i) % this->events.size()]);
+                return ordered;
+            }
+
+            void clear() {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                std::vector<Event>{}.swap(this->events);
+                this->head = 0;
+                this->count = 0;
+            }
+
+            std::size_t size() const {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                return this->count;
+            }
+
+            void setName(std::string_view name) {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                this->thread_name = name;
+            }
+
+            std::string name() const {
+                std::lock_guard<std::mutex> lock{this->buffer_mutex};
+                return this->thread_name;
+            }
+
+            std::uint32_t id() const noexcept {
+                return this->thread_id;
+            }
+
+            // Mark the buffer as no longer written by its thread
+            void retire() noexcept {
+                this->retired.store(true, std::memory_order_release);
+            }
+
+            // Whether the owning thread has exited and nothing is left to export
+            bool released() const {
+                return this->retired.load(std::memory_order_acquire) && this->size() == 0;
+            }
+        };
+
+        /*
+         * Process-wide list of every thread's buffer
+         * Buffers are shared so that events recorded by threads that already exited survive until they are exported
+         * Buffers of exited threads are dropped from the list once they are empty, i.e. after a clear
+         */
+        struct Registry {
+            std::mutex registry_mutex;
+            std::vector<std::shared_ptr<RingBuffer>> buffers;
+            std::uint32_t next_id{1};
+            std::atomic<bool> enabled{true};
+            std::atomic<std::size_t> capacity{DEFAULT_BUFFER_CAPACITY};
+            std::chrono::steady_clock::time_point epoch{std::chrono::steady_clock::now()};
+
+            std::shared_ptr<RingBuffer> add() {
+                std::lock_guard<std::mutex> lock{this->registry_mutex};
+                auto buffer = std::make_shared<RingBuffer>(this->capacity.load(std::memory_order_relaxed), this->next_id++);
+                this->buffers.push_back(buffer);
+                return buffer;
+            }
+
+            std::vector<std::shared_ptr<RingBuffer>> all() {
+                std::lock_guard<std::mutex> lock{this->registry_mutex};
+                std::erase_if(this->buffers, [](const std::shared_ptr<RingBuffer>& buffer) { return buffer->released(); });
+                return this->buffers;
+            }
+        };
+
+        inline Registry& registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        // Registration of the calling thread, retired when the thread exits
+        struct LocalBuffer {
+            std::shared_ptr<RingBuffer> buffer = registry().add();
+
+            ~LocalBuffer() {
+                this->buffer->retire();
+            }
+        };
+
+        // Lazily register the calling thread the first time it records an event
+        inline RingBuffer& local_buffer() {
+            thread_local LocalBuffer local;
+            return *local.buffer;
+        }
+
+        inline std::uint64_t now_ns() {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry().epoch).count());
+        }
+
+        inline void write_escaped(std::ostream& stream, std::string_view text) {
+            for (char character : text) {
+                switch (character) {
+                    case '"': stream << "\\\""; break;
+                    case '\\': stream << "\\\\"; break;
+                    case '\n': stream << "\\n"; break;
+                    case '\t': stream << "\\t"; break;
+                    default: stream << character;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief RAII span recorded into the calling thread's ring buffer when it goes out of scope.
+     *
+     * `name` must outlive the export (string literals are the intended use), since only the
+     * pointer is stored. Spans created while tracing is disabled at runtime record nothing.
+     */
+    class Span {
+    private:
+        const char* name;
+        std::uint64_t start_ns;
+        bool active;
+
+    public:
+        explicit Span(const char* name) noexcept : name{name}, start_ns{0}, active{detail::registry().enabled.load(std::memory_order_relaxed)} {
+            if (this->active) this->start_ns = detail::now_ns();
+        }
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+        ~Span() {
+            if (!this->active) return;
+            std::uint64_t end_ns = detail::now_ns();
+            detail::local_buffer().push(Event{this->name, this->start_ns, end_ns - this->start_ns});
+        }
+    };
+
+    /** @brief Whether spans are compiled in (`BURST_ENABLE_TRACING` is defined). */
+    constexpr bool compiled_in() noexcept { return true; }
+
+    /** @brief Enable or disable recording at runtime; spans already open still complete. */
+    inline void set_enabled(bool enabled) noexcept {
+        detail::registry().enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Whether new spans are currently recorded.
+     * @return True if recording is enabled.
+     */
+    inline bool enabled() noexcept {
+        return detail::registry().enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set the ring-buffer capacity used for threads that record their first span afterwards.
+     *
+     * Threads that already own a buffer keep their existing capacity.
+     */
+    inline void set_buffer_capacity(std::size_t capacity) noexcept {
+        detail::registry().capacity.store(std::max<std::size_t>(capacity, 1), std::memory_order_relaxed);
+    }
+
+    /** @brief Label the calling thread in exported timelines (e.g. `"worker 3"`). */
+    inline void set_thread_name(std::string_view name) {
+        detail::local_buffer().setName(name);
+    }
+
+    /** @brief Drop every recorded event, release buffer storage, and forget threads that have exited. */
+    inline void clear() {
+        for (const auto& buffer : detail::registry().all()) buffer->clear();
+        detail::registry().all();
+    }
+
+    /**
+     * @brief Number of thread buffers currently registered.
+     * @return Buffers of live threads, plus those of exited threads whose events were not cleared yet.
+     */
+    inline std::size_t buffer_count() {
+        return detail::registry().all().size();
+    }
+
+    /**
+     * @brief Number of events currently held across all thread buffers.
+     * @return Total buffered event count.
+     */
+    inline std::size_t event_count() {
+        std::size_t total = 0;
+        for (const auto& buffer : detail::registry().all()) total += buffer->size();
+        return total;
+    }
+
+    /**
+     * @brief Write all buffered events as a Chrome trace JSON object.
+     *
+     * Each span becomes a complete (`"ph": "X"`) event with microsecond timestamps, using the
+     * recording thread's index as `tid`. Named threads additionally emit `thread_name` metadata.
+     * Export while worker threads are still recording is safe but only captures a snapshot.
+     *
+     * @param stream Destination stream.
+     */
+    inline void write_chrome_trace(std::ostream& stream) {
+        stream << "{\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&stream, &first]() {
+            if (!first) stream << ',';
+            first = false;
+        };
+
+        std::ios_base::fmtflags flags = stream.flags();
+        std::streamsize precision = stream.precision();
+        stream << std::fixed << std::setprecision(3);
+        for (const auto& buffer : detail::registry().all()) {
+            std::string thread_name = buffer->name();
+            if (!thread_name.empty()) {
+                separator();
+                stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id() << ",\"args\":{\"name\":\"";
+                detail::write_escaped(stream, thread_name);
+                stream << "\"}}";
+            }
+            for (const Event& event : buffer->snapshot()) {
+                separator();
+                stream << "{\"name\":\"";
+                detail::write_escaped(stream, event.name);
+                stream << "\",\"cat\":\"BURST\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id()
+                       << ",\"ts\":" << static_cast<double>(event.start_ns) / 1000.0
+                       << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0 << '}';
+            }
+        }
+        stream.flags(flags);
+        stream.precision(precision);
+        stream << "],\"displayTimeUnit\":\"ms\"}";
+    }
+
+    /**
+     * @brief Write all buffered events as Chrome trace JSON to the file at `path`.
+     * @return True if the file could be opened and written.
+     */
+    inline bool write_chrome_trace(const std::string& path) {
+        std::ofstream file{path};
+        if (!file) return false;
+        write_chrome_trace(file);
+        return static_cast<bool>(file);
+    }
+
+#else
+
+    // Define no-op versions if tracing is disabled so instrumented code compiles to nothing
+
+    class Span {
+    public:
+        explicit constexpr Span(const char*) noexcept {}
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+    };
+
+    constexpr bool compiled_in() noexcept { return false; }
+    inline void set_enabled(bool) noexcept {}
+    inline bool enabled() noexcept { return false; }
+    inline void set_buffer_capacity(std::size_t) noexcept {}
+    inline void set_thread_name(std::string_view) {}
+    inline void clear() {}
+    inline std::size_t buffer_count() { return 0; }
+    inline std::size_t event_count() { return 0; }
+    inline void write_chrome_trace(std::ostream& stream) { stream << "{\"traceEvents\":[],\"displayTimeUnit\":\"ms\"}"; }
+    inline bool write_chrome_trace(const std::string&) { return false; }
+
+#endif
+
+}
+
+#endif
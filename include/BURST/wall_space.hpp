@@ -4,11 +4,17 @@
 #include <optional>
 #include <memory>
 #include <iterator>
+#include <array>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <concepts>
 #include <source_location>
 
 #include <CGAL/approximated_offset_2.h>
 #include <CGAL/General_polygon_set_2.h>
 #include <CGAL/Boolean_set_operations_2.h>
+#include <CGAL/minkowski_sum_2.h>
 #include <CGAL/Graphics_scene_options.h>
 #include <CGAL/draw_arrangement_2.h>
 
@@ -21,13 +27,90 @@
 #include "configuration_space.hpp"
 #include "robot.hpp"
 #include "logging.hpp"
+#include "tracing.hpp"
+#include "memory.hpp"
 
 /**
  * @file wall_space.hpp
- * @brief Environment boundary as a (possibly holed) polygon and factory for @ref ConfigurationSpace.
+ * @brief Environment boundary as a (possibly holed) polygon, factory for @ref ConfigurationSpace (disc or polygonal robots), and a construction cache up to rigid motion.
  */
 
+// Forward declare the environment reader's access point so WallSpace can grant it construction access
+namespace BURST::experiments::detail {
+    struct EnvironmentAccess;
+}
+
 namespace BURST::geometry {
+
+    // Forward declare the cache so WallSpace can grant it construction access
+    class ConfigurationSpaceCache;
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        // Lexicographic order of two vertex rings, shorter rings first
+        inline CGAL::Comparison_result compare_rings(const Polygon2D& a, const Polygon2D& b) {
+            if (a.size() != b.size()) return a.size() < b.size() ? CGAL::SMALLER : CGAL::LARGER;
+            for (auto a_it = a.vertices_begin(), b_it = b.vertices_begin(); a_it != a.vertices_end(); ++a_it, ++b_it) {
+                CGAL::Comparison_result result = CGAL::compare_xy(*a_it, *b_it);
+                if (result != CGAL::EQUAL) return result;
+            }
+            return CGAL::EQUAL;
+        }
+
+        // Estimated footprint of the vertex storage of a holed polygon
+        inline memory::MemoryUsage shape_usage(const HoledPolygon2D& shape) {
+            std::size_t vertices = shape.outer_boundary().size();
+            for (const Polygon2D& hole : shape.holes()) vertices += hole.size();
+            return memory::MemoryUsage{sizeof(HoledPolygon2D) + shape.number_of_holes() * sizeof(Polygon2D) + vertices * sizeof(Point2D), 0, vertices * memory::EXACT_POINT_BYTES};
+        }
+
+        // Lexicographic order of two holed polygons: outer ring, then hole count, then holes in order
+        inline CGAL::Comparison_result compare_shapes(const HoledPolygon2D& a, const HoledPolygon2D& b) {
+            CGAL::Comparison_result result = compare_rings(a.outer_boundary(), b.outer_boundary());
+            if (result != CGAL::EQUAL) return result;
+            if (a.number_of_holes() != b.number_of_holes()) return a.number_of_holes() < b.number_of_holes() ? CGAL::SMALLER : CGAL::LARGER;
+            for (auto a_it = a.holes_begin(), b_it = b.holes_begin(); a_it != a.holes_end(); ++a_it, ++b_it) {
+                result = compare_rings(*a_it, *b_it);
+                if (result != CGAL::EQUAL) return result;
+            }
+            return CGAL::EQUAL;
+        }
+
+        // Ring of `polygon` mapped by `transformation`, starting at vertex `start`
+        inline Polygon2D transform_ring(const Polygon2D& polygon, const Transformation& transformation, std::size_t start = 0) {
+            std::vector<Point2D> vertices;
+            vertices.reserve(polygon.size());
+            for (std::size_t i = 0; i < polygon.size(); ++i) vertices.push_back(transformation(polygon.vertex((start + i) % polygon.size())));
+            return Polygon2D{vertices.begin(), vertices.end()};
+        }
+
+        // Rigid motion taking `origin` to the origin and the direction towards `next` onto the positive x-axis
+        inline Transformation edge_frame(const Point2D& origin, const Point2D& next) {
+            Vector2D edge = next - origin;
+            numeric::fscalar length = CGAL::sqrt(edge.squared_length());
+            numeric::fscalar cosine = edge.x() / length, sine = edge.y() / length;
+            return Transformation{cosine, sine, -(cosine * origin.x() + sine * origin.y()), -sine, cosine, sine * origin.x() - cosine * origin.y()};
+        }
+
+        // Images of `holes` under `transformation` as clockwise rings, each starting at its lexicographically smallest vertex, in sorted order
+        template <typename Holes>
+        std::vector<Polygon2D> normalized_holes(const Holes& holes, const Transformation& transformation) {
+            std::vector<Polygon2D> normalized;
+            for (const Polygon2D& hole : holes) {
+                std::size_t lowest = std::distance(hole.vertices_begin(), std::min_element(hole.vertices_begin(), hole.vertices_end(), [&transformation](const Point2D& a, const Point2D& b) {
+                    return CGAL::compare_xy(transformation(a), transformation(b)) == CGAL::SMALLER;
+                }));
+                Polygon2D ring = transform_ring(hole, transformation, lowest);
+                // Reflections reverse the winding; reversing in place keeps the smallest vertex first
+                if (ring.orientation() != CGAL::CLOCKWISE) ring.reverse_orientation();
+                normalized.push_back(std::move(ring));
+            }
+            std::sort(normalized.begin(), normalized.end(), [](const Polygon2D& a, const Polygon2D& b) {
+                return compare_rings(a, b) == CGAL::SMALLER;
+            });
+            return normalized;
+        }
+    }
     
     /**
      * @brief Static environment geometry: outer walls and optional holes (obstacles).
@@ -47,6 +130,59 @@ namespace BURST::geometry {
         /** @brief Build from a full holed polygon representation. */
         WallSpace(const HoledPolygon2D& shape) noexcept : Renderable{}, wall_shape{shape} {}
 
+        /**
+         * @brief Layout in its canonical pose, and the rigid motion placing the canonical pose onto this layout.
+         *
+         * The canonical pose puts a distinguished outer vertex at the origin with its outgoing edge
+         * along the positive x-axis. The vertex is the start of the lexicographically smallest cyclic
+         * sequence of rigid corner invariants (outgoing squared edge length, then the cross and dot
+         * products with the incoming edge). When several starts tie, as for symmetric outlines, the
+         * one giving the smallest holes wins. Holes start at their lexicographically smallest vertex
+         * and are sorted, so layouts related by a rigid motion have identical canonical shapes.
+         *
+         * @param placement Receives the rigid motion mapping the canonical pose onto this layout.
+         * @return Canonical holed polygon.
+         */
+        HoledPolygon2D canonicalShape(Transformation& placement) const {
+            const Polygon2D& outer = this->wall_shape.outer_boundary();
+            std::size_t n = outer.size();
+            std::vector<std::array<numeric::fscalar, 3>> signature(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                Vector2D incoming = outer.vertex(i) - outer.vertex((i + n - 1) % n);
+                Vector2D outgoing = outer.vertex((i + 1) % n) - outer.vertex(i);
+                signature[i] = {outgoing.squared_length(), incoming.x() * outgoing.y() - incoming.y() * outgoing.x(), incoming * outgoing};
+            }
+            auto compare_starts = [&signature, n](std::size_t a, std::size_t b) {
+                for (std::size_t k = 0; k < n; ++k) {
+                    for (std::size_t j = 0; j < 3; ++j) {
+                        CGAL::Comparison_result result = CGAL::compare(signature[(a + k) % n][j], signature[(b + k) % n][j]);
+                        if (result != CGAL::EQUAL) return result;
+                    }
+                }
+                return CGAL::EQUAL;
+            };
+            std::vector<std::size_t> starts{0};
+            for (std::size_t i = 1; i < n; ++i) {
+                CGAL::Comparison_result result = compare_starts(i, starts.front());
+                if (result == CGAL::SMALLER) starts.assign(1, i);
+                else if (result == CGAL::EQUAL) starts.push_back(i);
+            }
+
+            std::optional<HoledPolygon2D> best;
+            for (std::size_t start : starts) {
+                // Rigid motion taking the start vertex to the origin and its outgoing edge onto the positive x-axis
+                Transformation into = detail::edge_frame(outer.vertex(start), outer.vertex((start + 1) % n));
+                HoledPolygon2D candidate{detail::transform_ring(outer, into, start)};
+                for (const Polygon2D& hole : detail::normalized_holes(this->wall_shape.holes(), into)) candidate.add_hole(hole);
+
+                if (!best || detail::compare_shapes(candidate, *best) == CGAL::SMALLER) {
+                    best = std::move(candidate);
+                    placement = into.inverse();
+                }
+            }
+            return *best;
+        }
+
         /**
          * @brief Compute the configuration space for a robot of radius `robot_radius`.
          *
@@ -57,6 +193,7 @@ namespace BURST::geometry {
          * @return Generated configuration space, or `nullptr` when no free region can be constructed.
          */
         std::shared_ptr<ConfigurationSpace> constructConfigurationSpace(const numeric::fscalar& robot_radius, const std::source_location location = std::source_location::current()) const {
+            tracing::Span span{"WallSpace::constructConfigurationSpace"};
             // TODO: Find an actually good epsilon instead of this approximation
             const double EPSILON = 0.000001;
 
@@ -93,7 +230,72 @@ namespace BURST::geometry {
             }
             
             // Create the configuration space from the resulting polygon set
-            return ConfigurationSpace::create(std::move(config_polygon_set));
+            return ConfigurationSpace::create(std::move(config_polygon_set), location);
+        }
+
+        /**
+         * @brief Compute the configuration space for a translating polygonal robot with outline `footprint`.
+         *
+         * `footprint` is given relative to the robot's reference point (its position) and may be convex
+         * or not. A position is blocked exactly when the footprint placed there meets an obstacle, so the
+         * blocked region is the Minkowski sum of the obstacles with the footprint reflected through the
+         * reference point. Both sums use reduced convolution. The outside of the outer boundary is
+         * bounded by a frame wider than the footprint, so the free region appears as the holes of its
+         * sum. The result has only straight edges and is exact; no offset approximation is involved.
+         *
+         * @return Generated configuration space, or `nullptr` when `footprint` is degenerate or no free region can be constructed.
+         */
+        std::shared_ptr<ConfigurationSpace> constructConfigurationSpace(const Polygon2D& footprint, const std::source_location location = std::source_location::current()) const {
+            tracing::Span span{"WallSpace::constructConfigurationSpace"};
+            if (footprint.size() < 3 || !footprint.is_simple() || footprint.area() == 0) {
+                burst_error("Robot footprint is degenerate, no configuration space could be generated", location);
+                return nullptr;
+            }
+
+            // Reflect the footprint through the reference point, which keeps its orientation
+            std::vector<Point2D> reflected_vertices;
+            reflected_vertices.reserve(footprint.size());
+            for (auto vertex_it = footprint.vertices_begin(); vertex_it != footprint.vertices_end(); ++vertex_it) reflected_vertices.push_back(Point2D{-vertex_it->x(), -vertex_it->y()});
+            Polygon2D reflected{reflected_vertices.begin(), reflected_vertices.end()};
+            if (reflected.orientation() != CGAL::COUNTERCLOCKWISE) reflected.reverse_orientation();
+
+            // Frame the outside of the walls with a margin larger than the footprint's diameter, so the sum of the frame is simply connected outside
+            const Polygon2D& outer = this->wall_shape.outer_boundary();
+            BoundingBox2D walls_box = outer.bbox(), robot_box = reflected.bbox();
+            double margin = (robot_box.xmax() - robot_box.xmin()) + (robot_box.ymax() - robot_box.ymin()) + 1;
+            Polygon2D frame;
+            frame.push_back(Point2D{walls_box.xmin() - margin, walls_box.ymin() - margin});
+            frame.push_back(Point2D{walls_box.xmax() + margin, walls_box.ymin() - margin});
+            frame.push_back(Point2D{walls_box.xmax() + margin, walls_box.ymax() + margin});
+            frame.push_back(Point2D{walls_box.xmin() - margin, walls_box.ymax() + margin});
+            Polygon2D walls_hole = outer;
+            walls_hole.reverse_orientation();
+            HoledPolygon2D exterior{frame};
+            exterior.add_hole(walls_hole);
+
+            // The free region inside the outer boundary is the set of holes left in the blocked exterior
+            // As for disc robots, no region or several disconnected regions are both rejected
+            HoledPolygon2D blocked_exterior = CGAL::minkowski_sum_by_reduced_convolution_2(exterior, reflected);
+            if (blocked_exterior.number_of_holes() != 1) {
+                burst_error("Wall polygon is too small for the robot, no configuration space could be generated", location);
+                return nullptr;
+            }
+            Polygon2D free_region = *blocked_exterior.holes_begin();
+            if (free_region.orientation() != CGAL::COUNTERCLOCKWISE) free_region.reverse_orientation();
+
+            // Remove the sum of every hole with the reflected footprint
+            LinearPolygonSet2D free_set{free_region};
+            for (const Polygon2D& hole : this->wall_shape.holes()) {
+                Polygon2D oriented_hole = hole;
+                if (oriented_hole.orientation() != CGAL::COUNTERCLOCKWISE) oriented_hole.reverse_orientation();
+                free_set.difference(CGAL::minkowski_sum_by_reduced_convolution_2(oriented_hole, reflected));
+            }
+            if (free_set.is_empty()) {
+                burst_error("Holes leave no room for the robot, no configuration space could be generated", location);
+                return nullptr;
+            }
+
+            return ConfigurationSpace::create(std::make_unique<CurvilinearPolygonSet2D>(to_curvilinear(free_set)), location);
         }
 
     public:
@@ -202,6 +404,85 @@ namespace BURST::geometry {
 
             return true;
         }
+        /**
+         * @brief Build and attach the configuration space of a translating polygonal robot with outline `footprint`.
+         *
+         * Uses the polygonal @ref constructConfigurationSpace overload; `robot`'s radius is ignored for
+         * the configuration space, and `footprint` is relative to the robot's position.
+         *
+         * @return True if the configuration space was generated and attached, false otherwise.
+         */
+        template <typename T, typename P, typename R, typename D>
+        bool generateConfigurationSpace(Robot<T, P, R, D>& robot, const Polygon2D& footprint) const {
+            auto config_geometry = this->constructConfigurationSpace(footprint);
+            if (!config_geometry) return false; // Degenerate footprint or configuration geometry, can't set it for the robot
+            robot.setConfigurationEnvironment(std::move(config_geometry));
+
+            return true;
+        }
+        /**
+         * @brief Same as @ref generateConfigurationSpace, reusing the configuration space of any
+         *        layout in `cache` that this one is a rigid motion of.
+         * @return True if the configuration space was generated and attached, false otherwise.
+         */
+        template <typename T, typename P, typename R, typename D, typename Cache> requires std::same_as<Cache, ConfigurationSpaceCache>
+        bool generateConfigurationSpace(Robot<T, P, R, D>& robot, Cache& cache) const {
+            auto config_geometry = cache.get(*this, robot.getRadius());
+            if (!config_geometry) return false; // Degenerate configuration geometry, can't set it for the robot
+            robot.setConfigurationEnvironment(std::move(config_geometry));
+
+            return true;
+        }
+
+        /**
+         * @brief Copy of this layout moved by the rigid motion `transformation`.
+         * @param transformation Rotation followed by a translation (see @ref is_rigid_motion); near-unit
+         *        rotations are normalised first (see @ref normalize_rigid_motion).
+         * @return Moved layout, or `std::nullopt` if `transformation` is not a rigid motion.
+         */
+        std::optional<WallSpace> transformed(const Transformation& transformation, const std::source_location location = std::source_location::current()) const {
+            if (!is_rigid_motion(transformation)) {
+                burst_error("Cannot move a wall space by a transformation that is not a rigid motion", location);
+                return std::nullopt;
+            }
+            Transformation motion = normalize_rigid_motion(transformation);
+            HoledPolygon2D moved{detail::transform_ring(this->wall_shape.outer_boundary(), motion)};
+            for (const Polygon2D& hole : this->wall_shape.holes()) moved.add_hole(detail::transform_ring(hole, motion));
+            return WallSpace{moved};
+        }
+
+        /**
+         * @brief Estimated footprint of the wall polygon and its exact vertices.
+         * @return Memory usage; configuration spaces generated from this layout are not included.
+         */
+        memory::MemoryUsage memoryUsage() const {
+            memory::MemoryUsage usage = detail::shape_usage(this->wall_shape);
+            usage.structure += sizeof(*this) - sizeof(HoledPolygon2D);
+            return usage;
+        }
+
+        /**
+         * @brief Rigid motion placing the canonical pose of this layout (see @ref canonical) onto it.
+         * @return Rotation followed by a translation.
+         */
+        Transformation canonicalPlacement() const {
+            Transformation placement;
+            this->canonicalShape(placement);
+            return placement;
+        }
+
+        /**
+         * @brief This layout in its canonical pose, which is the same for every rigid motion of it.
+         *
+         * A distinguished outer vertex sits at the origin with its outgoing edge along the positive
+         * x-axis; @ref canonicalPlacement maps the result back onto this layout.
+         *
+         * @return Canonical layout.
+         */
+        WallSpace canonical() const {
+            Transformation placement;
+            return WallSpace{this->canonicalShape(placement)};
+        }
 
         /** 
          * @brief Default wall edge color (black); faces use white/black scheme in @ref render.
@@ -326,6 +607,169 @@ namespace BURST::geometry {
         }
 
         friend class std::unique_ptr<WallSpace>;
+        friend class ConfigurationSpaceCache; // For access to construction and the canonical shape
+        friend struct experiments::detail::EnvironmentAccess; // For construction when reading environment files
+    };
+
+    /**
+     * @brief Configuration spaces keyed by layout up to rigid motion and by robot radius.
+     *
+     * A lookup brings the layout into its canonical pose (see @ref WallSpace::canonical). On a miss
+     * the configuration space is constructed once in that pose. The first lookup of each placement
+     * moves the cached space onto the queried layout by @ref ConfigurationSpace::transformed, so the
+     * same obstacle layout placed at many positions and orientations is offset only once. Moved
+     * spaces are kept too, keyed by the layout exactly as queried, so repeating a lookup skips both
+     * the canonical pose and the move, and only copies the placed space.
+     *
+     * Layouts and radii are compared exactly. Because the offsets are approximated in the canonical
+     * pose, a returned space can differ from direct construction by up to the offset tolerance.
+     *
+     * With a memory budget (see @ref setMemoryBudget), least recently used spaces are evicted, with
+     * their placements, until the estimated footprint of the cache fits. Returned spaces are copies
+     * that share the exact region with the cache, so eviction never invalidates them and selecting
+     * another boundary index on one does not affect the others.
+     */
+    class ConfigurationSpaceCache {
+    private:
+        struct Key {
+            numeric::fscalar radius;
+            HoledPolygon2D shape;
+        };
+        struct KeyLess {
+            bool operator()(const Key& a, const Key& b) const {
+                CGAL::Comparison_result result = CGAL::compare(a.radius, b.radius);
+                if (result != CGAL::EQUAL) return result == CGAL::SMALLER;
+                return detail::compare_shapes(a.shape, b.shape) == CGAL::SMALLER;
+            }
+        };
+        struct Entry {
+            std::shared_ptr<ConfigurationSpace> space;
+            std::size_t bytes;          // Estimated footprint of the space, its key and its placements
+            std::uint64_t last_use;
+        };
+        struct Placement {
+            std::shared_ptr<ConfigurationSpace> space;
+            Entry* entry;               // Canonical entry the space was moved from
+        };
+        std::map<Key, Entry, KeyLess> entries;
+        // Spaces already moved onto queried layouts, keyed by the layout as given
+        std::map<Key, Placement, KeyLess> placements;
+        std::size_t hit_count = 0;
+        std::size_t miss_count = 0;
+        std::size_t eviction_count = 0;
+        std::size_t budget = 0;
+        std::size_t cached_bytes = 0;
+        std::uint64_t use_clock = 0;
+
+        // Footprint compared with the budget; matches memoryUsage().total() without walking the spaces
+        std::size_t footprint() const noexcept {
+            return sizeof(*this) + memory::container_bytes(this->entries) + memory::container_bytes(this->placements) + this->cached_bytes;
+        }
+
+        // Evict least recently used entries until the cache fits its budget
+        void enforceBudget() {
+            while (this->budget != 0 && this->footprint() > this->budget && !this->entries.empty()) {
+                auto oldest = std::ranges::min_element(this->entries, {}, [](const auto& entry) { return entry.second.last_use; });
+                this->cached_bytes -= oldest->second.bytes;
+                std::erase_if(this->placements, [&oldest](const auto& placement) { return placement.second.entry == &oldest->second; });
+                this->entries.erase(oldest);
+                this->eviction_count++;
+            }
+        }
+
+    public:
+        /**
+         * @brief Configuration space of `walls` for a robot of radius `robot_radius`.
+         * @return Configuration space placed on `walls`, or `nullptr` when no free region can be constructed.
+         */
+        std::shared_ptr<ConfigurationSpace> get(const WallSpace& walls, const numeric::fscalar& robot_radius, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"ConfigurationSpaceCache::get"};
+            Key layout{robot_radius, walls.wall_shape};
+            auto placement_it = this->placements.find(layout);
+            if (placement_it != this->placements.end()) {
+                this->hit_count++;
+                placement_it->second.entry->last_use = ++this->use_clock;
+                return std::make_shared<ConfigurationSpace>(*placement_it->second.space);
+            }
+
+            Transformation placement;
+            Key key{robot_radius, walls.canonicalShape(placement)};
+            auto entry_it = this->entries.find(key);
+            if (entry_it != this->entries.end()) {
+                this->hit_count++;
+            } else {
+                this->miss_count++;
+                std::shared_ptr<ConfigurationSpace> canonical_space = WallSpace{key.shape}.constructConfigurationSpace(robot_radius, location);
+                // Failed constructions are not cached, so they are reported on every lookup
+                if (!canonical_space) return nullptr;
+                std::size_t bytes = canonical_space->memoryUsage().total() + detail::shape_usage(key.shape).total();
+                entry_it = this->entries.emplace(std::move(key), Entry{std::move(canonical_space), bytes, 0}).first;
+                this->cached_bytes += bytes;
+            }
+            Entry& entry = entry_it->second;
+            entry.last_use = ++this->use_clock;
+            std::shared_ptr<ConfigurationSpace> placed = entry.space->transformed(placement, location);
+            if (!placed) return nullptr;
+            std::size_t bytes = placed->memoryUsage().total() + detail::shape_usage(layout.shape).total();
+            this->placements.emplace(std::move(layout), Placement{placed, &entry});
+            entry.bytes += bytes;
+            this->cached_bytes += bytes;
+            this->enforceBudget();
+            return std::make_shared<ConfigurationSpace>(*placed);
+        }
+
+        /**
+         * @brief Limit the estimated footprint of the cached spaces, evicting the least recently used ones.
+         *
+         * A space larger than the whole budget is still built and returned, but not kept.
+         *
+         * @param bytes Budget in bytes, or 0 for no limit (the default).
+         */
+        void setMemoryBudget(std::size_t bytes) {
+            this->budget = bytes;
+            this->enforceBudget();
+        }
+        /** @brief Current budget in bytes (0 when unlimited). */
+        std::size_t memoryBudget() const noexcept {
+            return this->budget;
+        }
+        /**
+         * @brief Estimated footprint of the cached spaces and their keys.
+         * @return Memory usage, recomputed from the cached spaces.
+         */
+        memory::MemoryUsage memoryUsage() const {
+            memory::MemoryUsage usage{sizeof(*this) + memory::container_bytes(this->entries) + memory::container_bytes(this->placements), 0, 0};
+            for (const auto& [key, entry] : this->entries) usage += entry.space->memoryUsage() + detail::shape_usage(key.shape);
+            for (const auto& [key, placement] : this->placements) usage += placement.space->memoryUsage() + detail::shape_usage(key.shape);
+            return usage;
+        }
+
+        /** @brief Number of cached configuration spaces in canonical pose; placements are not counted. */
+        std::size_t size() const noexcept {
+            return this->entries.size();
+        }
+        /** @brief Lookups answered from the cache. */
+        std::size_t hits() const noexcept {
+            return this->hit_count;
+        }
+        /** @brief Lookups that constructed a configuration space. */
+        std::size_t misses() const noexcept {
+            return this->miss_count;
+        }
+        /** @brief Spaces evicted to stay within the memory budget. */
+        std::size_t evictions() const noexcept {
+            return this->eviction_count;
+        }
+        /** @brief Drop every cached configuration space and reset the counters; the budget is kept. */
+        void clear() noexcept {
+            this->placements.clear();
+            this->entries.clear();
+            this->hit_count = 0;
+            this->miss_count = 0;
+            this->eviction_count = 0;
+            this->cached_bytes = 0;
+            this->use_clock = 0;
+        }
     };
 
 }
@@ -0,0 +1,550 @@
+#ifndef BURST_WORLD_HPP
+#define BURST_WORLD_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include <source_location>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/multiprecision/mpfr.hpp>
+
+#include "geometry.hpp"
+#include "numeric.hpp"
+#include "configuration_space.hpp"
+#include "robot.hpp"
+#include "numa.hpp"
+#include "memory.hpp"
+#include "logging.hpp"
+#include "tracing.hpp"
+
+/**
+ * @file world.hpp
+ * @brief Many robots sharing one configuration space, stopping on contact with walls and with each other.
+ */
+
+namespace BURST {
+
+    /** @brief How a robot's motion ended in a @ref World step. */
+    enum class MoveOutcome : std::uint8_t {
+        Boundary,   ///< Reached the configuration-space boundary
+        Contact,    ///< Stopped on first contact with another robot
+        Blocked,    ///< Already touching another robot in the direction of motion, so did not move
+        Invalid     ///< No valid motion (e.g. pointing outward from the boundary); the robot did not move
+    };
+
+    // Internal implementations not intended for public use
+    namespace detail {
+        /*
+         * Persistent worker threads that each run one share of a task per call to `run`
+         * Workers sleep on a condition variable between calls, so a step costs two wake-ups instead of thread creation
+         */
+        class WorkerPool {
+        private:
+            std::mutex mutex;
+            std::condition_variable wake, done;
+            // Task of the current call, type-erased without allocating
+            const void* task = nullptr;
+            void (*invoke)(const void*, std::size_t) = nullptr;
+            std::uint64_t generation = 0;
+            std::size_t pending = 0;
+            bool stopping = false;
+            // Serialises calls from worlds sharing the pool through copies
+            std::mutex run_mutex;
+            std::vector<std::jthread> threads;
+
+            void work(std::size_t worker, std::span<const unsigned> cpus) {
+                if (!cpus.empty()) numa::pin_current_thread(cpus);
+                std::uint64_t seen = 0;
+                std::unique_lock lock{this->mutex};
+                while (true) {
+                    this->wake.wait(lock, [this, seen]() { return this->stopping || this->generation != seen; });
+                    if (this->stopping) return;
+                    seen = this->generation;
+                    lock.unlock();
+                    this->invoke(this->task, worker);
+                    lock.lock();
+                    if (--this->pending == 0) this->done.notify_one();
+                }
+            }
+
+        public:
+            // One worker per entry of `cpus`, pinned to those CPUs unless the entry is empty
+            explicit WorkerPool(std::vector<std::vector<unsigned>> cpus) {
+                this->threads.reserve(cpus.size());
+                for (std::size_t worker = 0; worker < cpus.size(); ++worker) {
+                    this->threads.emplace_back([this, worker, pinned = std::move(cpus[worker])]() { this->work(worker, pinned); });
+                }
+            }
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+            ~WorkerPool() {
+                {
+                    std::lock_guard lock{this->mutex};
+                    this->stopping = true;
+                }
+                this->wake.notify_all();
+            }
+
+            std::size_t size() const noexcept {
+                return this->threads.size();
+            }
+
+            // Run `task(worker)` on every worker and `local()` on the calling thread, returning once all have finished
+            template <typename Task, typename Local>
+            void run(const Task& task, const Local& local) {
+                std::lock_guard serial{this->run_mutex};
+                {
+                    std::lock_guard lock{this->mutex};
+                    this->task = &task;
+                    this->invoke = [](const void* erased, std::size_t worker) { (*static_cast<const Task*>(erased))(worker); };
+                    this->pending = this->threads.size();
+                    ++this->generation;
+                }
+                this->wake.notify_all();
+                local();
+                std::unique_lock lock{this->mutex};
+                this->done.wait(lock, [this]() { return this->pending == 0; });
+            }
+        };
+    }
+
+    /**
+     * @brief Swarm of straight-moving robots that stop on contact with walls and with each other.
+     *
+     * Every robot shares one @ref geometry::ConfigurationSpace. A @ref step moves every robot once
+     * along its commanded heading in two phases:
+     *
+     * 1. The boundary hit of each robot is resolved against the static boundary index, in parallel
+     *    over contiguous blocks of robots. The worker threads are started with the world and sleep
+     *    between steps, so a step pays for waking them rather than for creating them. A robot only
+     *    draws from its own rotation model, so the outcome is independent of the thread count.
+     * 2. In robot index order, each path is clipped at the first contact with another robot disc,
+     *    seen at its already updated position. Candidates come from a uniform grid over robot
+     *    centers whose cells are at least one contact distance wide, and only the cells along the
+     *    path are visited.
+     *
+     * The step is therefore equivalent to moving the robots one after another in index order.
+     * Contacts are found in double precision and stop a relative @ref CONTACT_EPSILON short of
+     * touching, so robot discs never overlap. A robot stopped by a contact rests inside the
+     * configuration space, and its next motion runs to the first boundary hit from there.
+     *
+     * On multi-socket machines, @ref distributeAcrossNodes gives every NUMA node its own read-only
+     * replica of the configuration space and pins the boundary phase workers, so ray casts read
+     * node-local memory.
+     *
+     * @tparam R PRNG type of the robots' rotation models (default `std::mt19937`).
+     * @tparam D Distribution type of the robots' rotation models (default `std::uniform_real_distribution<double>`).
+     */
+    template <numeric::valid_rng R = std::mt19937, numeric::valid_distribution<R> D = std::uniform_real_distribution<double>>
+    class World {
+    public:
+        using RobotType = Robot<geometry::Ray2D, geometry::Segment2D, R, D>;  /**< Robot type moved by the world. */
+
+        /** @brief Relative gap kept between touching robots so rounding never makes discs overlap. */
+        static constexpr double CONTACT_EPSILON = 1e-9;
+        /** @brief Upper limit on the number of broad-phase cells along either axis. */
+        static constexpr std::size_t MAX_CELLS_PER_AXIS = 1024;
+        /** @brief Fewest robots handed to one worker thread in the boundary phase. */
+        static constexpr std::size_t MIN_ROBOTS_PER_THREAD = 8;
+
+    private:
+        std::vector<RobotType> robot_list;
+        std::shared_ptr<geometry::ConfigurationSpace> configuration_environment;
+        std::size_t thread_count;
+
+        // Per-node replicas of the configuration space and the nodes they were built on (empty when not distributed)
+        std::vector<std::shared_ptr<const geometry::ConfigurationSpace>> node_replicas;
+        std::optional<numa::Topology> topology;
+
+        // Boundary phase workers kept across steps (null when one thread suffices), shared by copies of the world
+        std::shared_ptr<detail::WorkerPool> workers;
+
+        // Approximate centers and radii of the robots, kept in sync with the exact positions
+        std::vector<double> center_x, center_y, radii;
+        double max_radius;
+
+        // Broad phase: robot indices bucketed by the cell of their center
+        double grid_xmin, grid_ymin, cell_size;
+        std::size_t column_count, row_count;
+        std::vector<boost::container::small_vector<std::uint32_t, 4>> cells;
+        std::vector<std::uint32_t> robot_cells;
+
+        World(std::vector<RobotType>&& robots, std::shared_ptr<geometry::ConfigurationSpace> configuration_space, std::size_t threads) :
+            robot_list{std::move(robots)},
+            configuration_environment{std::move(configuration_space)},
+            thread_count{std::max<std::size_t>(threads, 1)},
+            max_radius{0},
+            grid_xmin{0}, grid_ymin{0}, cell_size{1},
+            column_count{1}, row_count{1} {
+            this->center_x.reserve(this->robot_list.size());
+            this->center_y.reserve(this->robot_list.size());
+            this->radii.reserve(this->robot_list.size());
+            for (const RobotType& robot : this->robot_list) {
+                this->center_x.push_back(CGAL::to_double(robot.getPosition().x()));
+                this->center_y.push_back(CGAL::to_double(robot.getPosition().y()));
+                this->radii.push_back(CGAL::to_double(robot.getRadius()));
+                this->max_radius = std::max(this->max_radius, this->radii.back());
+            }
+
+            // Cells at least one contact distance wide over the configuration space
+            geometry::BoundingBox2D box = this->configuration_environment->boundary().bbox();
+            double width = std::max(box.xmax() - box.xmin(), 1e-12), height = std::max(box.ymax() - box.ymin(), 1e-12);
+            this->cell_size = std::max({2 * this->max_radius, width / MAX_CELLS_PER_AXIS, height / MAX_CELLS_PER_AXIS});
+            this->grid_xmin = box.xmin();
+            this->grid_ymin = box.ymin();
+            this->column_count = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(width / this->cell_size)), 1, MAX_CELLS_PER_AXIS);
+            this->row_count = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(height / this->cell_size)), 1, MAX_CELLS_PER_AXIS);
+            this->cells.resize(this->column_count * this->row_count);
+            this->robot_cells.resize(this->robot_list.size());
+            for (std::size_t index = 0; index < this->robot_list.size(); ++index) {
+                std::uint32_t cell = this->cellOf(this->center_x[index], this->center_y[index]);
+                this->robot_cells[index] = cell;
+                this->cells[cell].push_back(static_cast<std::uint32_t>(index));
+            }
+            this->startWorkers();
+        }
+
+        std::size_t columnOf(double x) const {
+            double column = std::floor((x - this->grid_xmin) / this->cell_size);
+            return static_cast<std::size_t>(std::clamp(column, 0.0, static_cast<double>(this->column_count - 1)));
+        }
+
+        std::size_t rowOf(double y) const {
+            double row = std::floor((y - this->grid_ymin) / this->cell_size);
+            return static_cast<std::size_t>(std::clamp(row, 0.0, static_cast<double>(this->row_count - 1)));
+        }
+
+        std::uint32_t cellOf(double x, double y) const {
+            return static_cast<std::uint32_t>(this->rowOf(y) * this->column_count + this->columnOf(x));
+        }
+
+        // Keep the approximate center and the cell of robot `index` in sync with its exact position
+        void relocate(std::size_t index) {
+            const geometry::Point2D& position = this->robot_list[index].getPosition();
+            this->center_x[index] = CGAL::to_double(position.x());
+            this->center_y[index] = CGAL::to_double(position.y());
+            std::uint32_t cell = this->cellOf(this->center_x[index], this->center_y[index]);
+            if (cell == this->robot_cells[index]) return;
+            auto& previous = this->cells[this->robot_cells[index]];
+            *std::find(previous.begin(), previous.end(), static_cast<std::uint32_t>(index)) = previous.back();
+            previous.pop_back();
+            this->cells[cell].push_back(static_cast<std::uint32_t>(index));
+            this->robot_cells[index] = cell;
+        }
+
+        // Boundary endpoint of one robot's motion along `angle`, from on or inside the configuration space
+        std::optional<geometry::Point2D> boundaryEndpoint(std::size_t index, const numeric::fscalar& angle, bool perturbed, const geometry::ConfigurationSpace& space, const std::source_location& location) const {
+            const RobotType& robot = this->robot_list[index];
+            numeric::fscalar effective_angle = perturbed ? robot.perturb(angle) : angle;
+            // Robots on the boundary move exactly as they would alone
+            if (space.onEdge(robot.getPosition())) return robot.shootRay(effective_angle, space, false, location);
+            // Robots resting against another robot move to the first boundary hit from the interior
+            if (!space.contains(robot.getPosition())) {
+                burst_error("Robot lies outside the configuration space, path is invalid", location);
+                return std::nullopt;
+            }
+            numeric::hpscalar hp_angle = numeric::to_high_precision(effective_angle);
+            geometry::Vector2D direction_vector{boost::multiprecision::cos(hp_angle), boost::multiprecision::sin(hp_angle)};
+            std::optional<geometry::Point2D> endpoint = space.firstIntersection<geometry::Ray2D>(geometry::Ray2D{robot.getPosition(), direction_vector});
+            if (!endpoint) burst_error("Trajectory does not intersect with the configuration space boundary, path is invalid", location);
+            return endpoint;
+        }
+
+        /*
+         * Fraction of the path of robot `index` to `(ex, ey)` travelled before first touching another robot
+         * Returns 0 when it already touches a robot it moves towards, and a value above 1 when nothing is hit
+         */
+        double firstContact(std::size_t index, double ex, double ey) const {
+            double px = this->center_x[index], py = this->center_y[index];
+            double dx = ex - px, dy = ey - py;
+            double squared_length = dx * dx + dy * dy;
+            double first = std::numeric_limits<double>::infinity();
+            if (squared_length == 0) return first;
+
+            // Centers of robots that can be touched lie within `reach` of the path
+            double reach = (this->radii[index] + this->max_radius) * (1 + CONTACT_EPSILON);
+            std::size_t row_min = this->rowOf(std::min(py, ey) - reach), row_max = this->rowOf(std::max(py, ey) + reach);
+            for (std::size_t row = row_min; row <= row_max; ++row) {
+                // Part of the path within reach of this row of cells
+                double band_min = this->grid_ymin + static_cast<double>(row) * this->cell_size - reach;
+                double band_max = band_min + this->cell_size + 2 * reach;
+                double t_min = 0, t_max = 1;
+                if (dy != 0) {
+                    double t_a = (band_min - py) / dy, t_b = (band_max - py) / dy;
+                    t_min = std::max(0.0, std::min(t_a, t_b));
+                    t_max = std::min(1.0, std::max(t_a, t_b));
+                    if (t_min > t_max) continue;
+                }
+                double x_a = px + t_min * dx, x_b = px + t_max * dx;
+                std::size_t column_min = this->columnOf(std::min(x_a, x_b) - reach), column_max = this->columnOf(std::max(x_a, x_b) + reach);
+                for (std::size_t column = column_min; column <= column_max; ++column) {
+                    for (std::uint32_t other : this->cells[row * this->column_count + column]) {
+                        if (other == index) continue;
+                        double contact = (this->radii[index] + this->radii[other]) * (1 + CONTACT_EPSILON);
+                        double ox = px - this->center_x[other], oy = py - this->center_y[other];
+                        // |o + t d|^2 = contact^2 as a t^2 + b t + c = 0
+                        double b = 2 * (ox * dx + oy * dy);
+                        double c = ox * ox + oy * oy - contact * contact;
+                        if (c <= 0) {
+                            // Touching already: blocked only when moving towards the other robot
+                            if (b < 0) return 0;
+                            continue;
+                        }
+                        double discriminant = b * b - 4 * squared_length * c;
+                        if (b >= 0 || discriminant < 0) continue;
+                        first = std::min(first, (-b - std::sqrt(discriminant)) / (2 * squared_length));
+                    }
+                }
+            }
+            return first;
+        }
+
+        // Number of pairs of robots whose discs overlap; cells are at least one contact distance wide, so only neighbouring cells are searched
+        std::size_t overlappingPairs() const {
+            std::size_t overlaps = 0;
+            for (std::size_t index = 0; index < this->robot_list.size(); ++index) {
+                std::size_t row = this->robot_cells[index] / this->column_count, column = this->robot_cells[index] % this->column_count;
+                for (std::size_t r = row > 0 ? row - 1 : 0; r <= std::min(row + 1, this->row_count - 1); ++r) {
+                    for (std::size_t c = column > 0 ? column - 1 : 0; c <= std::min(column + 1, this->column_count - 1); ++c) {
+                        for (std::uint32_t other : this->cells[r * this->column_count + c]) {
+                            if (other <= index) continue;
+                            double dx = this->center_x[index] - this->center_x[other], dy = this->center_y[index] - this->center_y[other];
+                            double contact = this->radii[index] + this->radii[other];
+                            if (dx * dx + dy * dy < contact * contact) ++overlaps;
+                        }
+                    }
+                }
+            }
+            return overlaps;
+        }
+
+        // Number of contiguous blocks of robots the boundary phase is split into
+        std::size_t blockCount() const {
+            return std::min(this->thread_count, std::max<std::size_t>(this->robot_list.size() / MIN_ROBOTS_PER_THREAD, 1));
+        }
+
+        // (Re)start the boundary phase workers: one per block but the caller's, or one pinned worker per block when distributed
+        void startWorkers() {
+            this->workers.reset();
+            std::size_t blocks = this->blockCount();
+            if (blocks <= 1) return;
+            std::vector<std::vector<unsigned>> cpus;
+            if (this->node_replicas.empty()) cpus.resize(blocks - 1);
+            else {
+                // Consecutive blocks share a node
+                for (std::size_t b = 0; b < blocks; ++b) {
+                    std::span<const unsigned> node_cpus = this->topology->cpus(b * this->node_replicas.size() / blocks);
+                    cpus.emplace_back(node_cpus.begin(), node_cpus.end());
+                }
+            }
+            this->workers = std::make_shared<detail::WorkerPool>(std::move(cpus));
+        }
+
+        // Run `work(begin, end, space)` over contiguous blocks of robot indices on the persistent workers
+        template <typename Work>
+        void forEachBlock(const Work& work) const {
+            std::size_t count = this->robot_list.size();
+            if (!this->workers) {
+                work(std::size_t{0}, count, *this->configuration_environment);
+                return;
+            }
+            std::size_t blocks = this->blockCount();
+            std::size_t block = (count + blocks - 1) / blocks;
+            if (this->node_replicas.empty()) {
+                // Worker w runs block w + 1 and the caller runs the first
+                this->workers->run([this, &work, block, count](std::size_t worker) {
+                    std::size_t begin = std::min((worker + 1) * block, count);
+                    work(begin, std::min(begin + block, count), *this->configuration_environment);
+                }, [this, &work, block, count]() {
+                    work(std::size_t{0}, std::min(block, count), *this->configuration_environment);
+                });
+                return;
+            }
+            // Every block runs on a worker pinned to its node, leaving the caller's affinity alone
+            this->workers->run([this, &work, blocks, block, count](std::size_t worker) {
+                std::size_t begin = std::min(worker * block, count);
+                work(begin, std::min(begin + block, count), *this->node_replicas[worker * this->node_replicas.size() / blocks]);
+            }, []() {});
+        }
+
+    public:
+        /**
+         * @brief Gather robots into a world.
+         * @param robots Robots to move; all must share one configuration space.
+         * @param threads Worker threads for the boundary phase of @ref step (0 uses the hardware concurrency).
+         * @return `std::nullopt` if there are no robots or they do not share a configuration space.
+         */
+        static std::optional<World> create(std::vector<RobotType> robots, std::size_t threads = 0, const std::source_location location = std::source_location::current()) {
+            if (robots.empty()) {
+                burst_error("Cannot construct a world without robots", location);
+                return std::nullopt;
+            }
+            std::shared_ptr<geometry::ConfigurationSpace> configuration_space = robots.front().getConfigurationEnvironmentPtr();
+            if (!configuration_space) {
+                burst_error("Cannot construct a world from robots without a configuration environment set", location);
+                return std::nullopt;
+            }
+            for (RobotType& robot : robots) {
+                if (robot.getConfigurationEnvironmentPtr() != configuration_space) {
+                    burst_error("Cannot construct a world from robots in different configuration environments", location);
+                    return std::nullopt;
+                }
+            }
+            if (threads == 0) threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            World world{std::move(robots), std::move(configuration_space), threads};
+
+            // Overlapping starts are allowed, but the overlapping robots can only move apart
+            std::size_t overlaps = world.overlappingPairs();
+            if (overlaps > 0) {
+                std::string warning_string = std::to_string(overlaps) + " pair(s) of robots overlap at the start. They can only move apart.";
+                burst_warning(warning_string.c_str(), location);
+            }
+            return world;
+        }
+
+        /** @brief Number of robots. */
+        std::size_t size() const noexcept {
+            return this->robot_list.size();
+        }
+        /** @brief Worker threads used by the boundary phase of @ref step. */
+        std::size_t threads() const noexcept {
+            return this->thread_count;
+        }
+        /** @brief Robot `index` (unchecked). */
+        const RobotType& robot(std::size_t index) const {
+            return this->robot_list[index];
+        }
+        /** @brief All robots in index order. */
+        std::span<const RobotType> robots() const noexcept {
+            return this->robot_list;
+        }
+        /** @brief Shared configuration space of the robots. */
+        std::shared_ptr<geometry::ConfigurationSpace> getConfigurationEnvironmentPtr() const {
+            return this->configuration_environment;
+        }
+
+        /**
+         * @brief Give every NUMA node of `topology` its own replica of the configuration space.
+         *
+         * Each replica is built by a thread pinned to its node, so its curves and boundary index are
+         * placed in that node's memory by first touch. Afterwards the boundary phase of @ref step runs
+         * each block of robots on a worker pinned to one node, consecutive blocks to the same node,
+         * against that node's replica. Replicas hold the same exact curves, so results are unchanged.
+         * Contact resolution stays on the calling thread. The boundary phase workers are restarted
+         * with the new pinning.
+         *
+         * On a single-node topology (including machines where NUMA cannot be detected) any replicas
+         * are dropped and every worker reads the shared configuration space, as without this call.
+         *
+         * @param topology Nodes to distribute over (default: this machine's).
+         * @return Number of replicas in use, 0 when falling back to the shared configuration space.
+         */
+        std::size_t distributeAcrossNodes(const numa::Topology& topology = numa::Topology::detect(), const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"World::distributeAcrossNodes"};
+            this->node_replicas.clear();
+            this->topology.reset();
+            if (!topology.multiNode()) {
+                this->startWorkers();
+                return 0;
+            }
+
+            std::vector<std::shared_ptr<const geometry::ConfigurationSpace>> replicas(topology.nodes());
+            {
+                std::vector<std::jthread> builders;
+                builders.reserve(topology.nodes());
+                for (std::size_t node = 0; node < topology.nodes(); ++node) builders.emplace_back([this, &topology, &replicas, node, &location]() {
+                    numa::pin_current_thread(topology.cpus(node));
+                    replicas[node] = this->configuration_environment->transformed(geometry::Transformation{CGAL::IDENTITY}, location);
+                });
+            }
+            if (std::ranges::any_of(replicas, [](const auto& replica) { return replica == nullptr; })) {
+                burst_warning("Failed to replicate the configuration space on every NUMA node, using the shared configuration space", location);
+                this->startWorkers();
+                return 0;
+            }
+            this->node_replicas = std::move(replicas);
+            this->topology = topology;
+            this->startWorkers();
+            return this->node_replicas.size();
+        }
+        /** @brief Number of per-node configuration-space replicas in use (0 when the shared one is used). */
+        std::size_t replicas() const noexcept {
+            return this->node_replicas.size();
+        }
+
+        /**
+         * @brief Estimated footprint of the robots, the contact grid, and any per-node replicas.
+         *
+         * The shared configuration space is not included, since it usually outlives the world; the
+         * replicas are owned by the world and are.
+         */
+        memory::MemoryUsage memoryUsage() const {
+            memory::MemoryUsage usage{sizeof(*this), 0, 0};
+            usage.structure += memory::container_bytes(this->robot_list) + memory::container_bytes(this->node_replicas)
+                             + memory::container_bytes(this->center_x) + memory::container_bytes(this->center_y) + memory::container_bytes(this->radii)
+                             + memory::container_bytes(this->cells) + memory::container_bytes(this->robot_cells);
+            for (const RobotType& robot : this->robot_list) usage.exact += robot.memoryUsage().exact;
+            // Cells that outgrew their inline storage hold a heap buffer
+            for (const auto& cell : this->cells) {
+                if (cell.capacity() > 4) usage.structure += cell.capacity() * sizeof(std::uint32_t);
+            }
+            for (const auto& replica : this->node_replicas) usage += replica->memoryUsage();
+            return usage;
+        }
+
+        /**
+         * @brief Move every robot once along its heading, stopping at the boundary or the first robot contact.
+         * @param angles One heading per robot, in robot index order.
+         * @param perturbed Whether each heading is first passed through the robot's rotation model.
+         * @return Outcome per robot, or `std::nullopt` if the number of headings does not match the number of robots.
+         */
+        std::optional<std::vector<MoveOutcome>> step(std::span<const numeric::fscalar> angles, bool perturbed = false, const std::source_location location = std::source_location::current()) {
+            tracing::Span span{"World::step"};
+            if (angles.size() != this->robot_list.size()) {
+                burst_error("Cannot step a world with a different number of headings than robots", location);
+                return std::nullopt;
+            }
+
+            // Phase 1: boundary endpoints, independent per robot
+            std::vector<std::optional<geometry::Point2D>> endpoints(this->robot_list.size());
+            this->forEachBlock([this, &endpoints, &angles, perturbed, &location](std::size_t begin, std::size_t end, const geometry::ConfigurationSpace& space) {
+                for (std::size_t index = begin; index < end; ++index) endpoints[index] = this->boundaryEndpoint(index, angles[index], perturbed, space, location);
+            });
+
+            // Phase 2: clip each path at its first robot contact, in index order
+            std::vector<MoveOutcome> outcomes(this->robot_list.size(), MoveOutcome::Invalid);
+            for (std::size_t index = 0; index < this->robot_list.size(); ++index) {
+                if (!endpoints[index]) continue;
+                const geometry::Point2D& endpoint = *endpoints[index];
+                double contact = this->firstContact(index, CGAL::to_double(endpoint.x()), CGAL::to_double(endpoint.y()));
+                if (contact > 1) {
+                    this->robot_list[index].placeAt(endpoint);
+                    outcomes[index] = MoveOutcome::Boundary;
+                } else if (contact <= 0) {
+                    outcomes[index] = MoveOutcome::Blocked;
+                    continue;
+                } else {
+                    const geometry::Point2D& origin = this->robot_list[index].getPosition();
+                    this->robot_list[index].placeAt(origin + (endpoint - origin) * numeric::fscalar{contact});
+                    outcomes[index] = MoveOutcome::Contact;
+                }
+                this->relocate(index);
+            }
+            return outcomes;
+        }
+    };
+
+}
+
+#endif
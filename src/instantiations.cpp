@@ -0,0 +1,32 @@
+/**
+ * @file instantiations.cpp
+ * @brief Explicit instantiations of the default BURST templates for the compiled `BURST_compiled` library.
+ *
+ * Every translation unit that links `BURST_compiled` sees the matching `extern template`
+ * declarations (enabled by `BURST_EXTERN_TEMPLATES`), so these specializations and the CGAL
+ * machinery they pull in are compiled once here instead of in every including file.
+ */
+
+#include <BURST/configuration_space.hpp>
+#include <BURST/models.hpp>
+#include <BURST/robot.hpp>
+
+namespace BURST::geometry {
+    template size_t ConfigurationSpace::intersection<Ray2D, Segment2D, std::vector<Point2D>>(
+        const Ray2D&, std::back_insert_iterator<std::vector<Point2D>>, const Point2D&(Ray2D::*)() const, Vector2D(Ray2D::*)() const
+    ) const noexcept;
+    template std::optional<Point2D> ConfigurationSpace::firstIntersection<Ray2D>(
+        const Ray2D&, const Point2D&(Ray2D::*)() const, Vector2D(Ray2D::*)() const
+    ) const noexcept;
+}
+
+namespace BURST::models {
+    template class RotationModel<std::mt19937, std::uniform_real_distribution<double>>;
+    template class RotationModel<std::mt19937, numeric::flat_distribution>;
+    template class MovementModel<geometry::Ray2D, geometry::Segment2D>;
+}
+
+namespace BURST {
+    template class Robot<geometry::Ray2D, geometry::Segment2D, std::mt19937, std::uniform_real_distribution<double>>;
+    template class Robot<geometry::Ray2D, geometry::Segment2D, std::mt19937, numeric::flat_distribution>;
+}
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <BURST/geometry.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/boundary.hpp>
+#include <BURST/simd.hpp>
+#include <BURST/wall_space.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <variant>
+#include <random>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the room around a pillar fixture, so the configuration space has two loops and circular arcs
+class CompactBoundaryTest : public PillarRoomTest {
+protected:
+    // Reference implementation: insert the long segment into a copy of the arrangement and collect the new vertices
+    std::vector<BURST::geometry::Point2D> arrangementIntersections(const BURST::geometry::Segment2D& long_path, const BURST::geometry::Point2D& source) const {
+        auto arrangement = this->configuration_space->arrangement();
+        CGAL::insert(arrangement, long_path);
+        std::vector<BURST::geometry::Point2D> points;
+        for (auto vertex_it = arrangement.vertices_begin(); vertex_it != arrangement.vertices_end(); ++vertex_it) {
+            if (vertex_it->degree() <= 2) continue;
+            auto point = vertex_it->point();
+            auto converted = BURST::geometry::convert_point<BURST::geometry::Point2D, decltype(point)>(point, BURST::numeric::sqrt_to_fscalar<decltype(point.x())>);
+            if (converted != source && long_path.has_on(converted)) points.push_back(converted);
+        }
+        return points;
+    }
+};
+
+// -- STRUCTURE TESTS ----------------------------------------------------------
+
+// Test that the compact boundary records every loop and curve of the configuration space
+TEST_F(CompactBoundaryTest, CurvesAndLoops) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    EXPECT_EQ(boundary.loops(), 2) << "Expected one outer loop and one hole";
+    EXPECT_EQ(boundary.size(), this->configuration_space->arrangement().number_of_edges()) << "Expected one compact curve per arrangement edge";
+
+    size_t arcs = 0;
+    for (size_t i = 0; i < boundary.size(); ++i) arcs += boundary.isArc(i) ? 1 : 0;
+    EXPECT_GE(arcs, 4) << "Expected the rounded corners around the pillar to be stored as arcs";
+}
+
+// Test that loop adjacency links every curve to neighbours in the same loop that share its endpoints
+TEST_F(CompactBoundaryTest, Adjacency) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    for (size_t i = 0; i < boundary.size(); ++i) {
+        EXPECT_EQ(boundary.previous(boundary.next(i)), i) << "Expected next and previous to be inverse at curve " << i;
+        EXPECT_EQ(boundary.loop(boundary.next(i)), boundary.loop(i)) << "Expected neighbours to share a loop at curve " << i;
+
+        const auto& curve = boundary.curve(i);
+        const auto& next = boundary.curve(boundary.next(i));
+        bool shares_endpoint = curve.source() == next.source() || curve.source() == next.target() || curve.target() == next.source() || curve.target() == next.target();
+        EXPECT_TRUE(shares_endpoint) << "Expected curve " << i << " to share an endpoint with its successor";
+    }
+}
+
+// Test that hierarchy leaves hold at most LEAF_SIZE curves and together cover every curve once
+TEST_F(CompactBoundaryTest, HierarchyLeaves) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    size_t covered = 0;
+    for (const auto& node : boundary.hierarchy()) {
+        if (node.count == 0) continue;
+        EXPECT_LE(node.count, BURST::geometry::CompactBoundary::LEAF_SIZE) << "Expected leaves of at most LEAF_SIZE curves";
+        covered += node.count;
+    }
+    EXPECT_EQ(covered, boundary.size()) << "Expected the leaves to partition the curves";
+}
+
+// Test that every leaf is packed for the SIMD filters with its curves in lane order
+TEST_F(CompactBoundaryTest, PackedLeavesMatchCurves) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    for (const auto& node : boundary.hierarchy()) {
+        if (node.count == 0) continue;
+        ASSERT_LT(node.leaf, boundary.leaves().size()) << "Expected every leaf node to reference a packed leaf";
+        const BURST::simd::CurveLeaf& leaf = boundary.leaves()[node.leaf];
+        EXPECT_EQ(leaf.count, node.count) << "Expected the packed leaf to hold every curve of its node";
+        for (std::uint32_t lane = 0; lane < node.count; ++lane) {
+            EXPECT_EQ(leaf.radius[lane] > 0, boundary.isArc(node.first + lane)) << "Expected arcs to be packed with their radius at curve " << node.first + lane;
+            EXPECT_EQ(leaf.x0[lane], boundary.source(node.first + lane).first) << "Expected packed endpoints to match at curve " << node.first + lane;
+        }
+    }
+}
+
+// -- QUERY TESTS --------------------------------------------------------------
+
+// Test that boundary membership agrees with the polygon set
+TEST_F(CompactBoundaryTest, OnEdgeAgreesWithPolygonSet) {
+    std::vector<BURST::geometry::Point2D> points{
+        BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{1, 10}, BURST::geometry::Point2D{19, 5},
+        BURST::geometry::Point2D{7, 10}, BURST::geometry::Point2D{10, 7}, BURST::geometry::Point2D{5, 5},
+        BURST::geometry::Point2D{10, 10}, BURST::geometry::Point2D{-1, 5}, BURST::geometry::Point2D{7, 7}
+    };
+    using arrangement_t = BURST::geometry::CurvilinearPolygonSet2D::Arrangement_2;
+    CGAL::Arr_naive_point_location<arrangement_t> point_location{this->configuration_space->arrangement()};
+    for (const BURST::geometry::Point2D& point : points) {
+        auto result = point_location.locate(BURST::CurvedTraits::Point_2(point.x(), point.y()));
+        bool expected = !std::holds_alternative<arrangement_t::Face_const_handle>(result);
+        EXPECT_EQ(this->configuration_space->boundary().onEdge(point), expected) << "Expected the compact boundary to agree with point location at (" << point << ")";
+    }
+    EXPECT_TRUE(this->configuration_space->onEdge(BURST::geometry::Point2D{1, 10})) << "Expected the inset outer wall to be on the boundary";
+    EXPECT_TRUE(this->configuration_space->onEdge(BURST::geometry::Point2D{7, 10})) << "Expected the offset pillar wall to be on the boundary";
+    EXPECT_FALSE(this->configuration_space->onEdge(BURST::geometry::Point2D{5, 5})) << "Expected an interior point not to be on the boundary";
+}
+
+// Test that segment intersections match inserting the segment into the arrangement for a fan of rays
+TEST_F(CompactBoundaryTest, SegmentIntersectionsMatchArrangement) {
+    std::vector<BURST::geometry::Point2D> sources{
+        BURST::geometry::Point2D{1, 5}, BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{5, 19}, BURST::geometry::Point2D{7, 10}
+    };
+    for (const BURST::geometry::Point2D& source : sources) {
+        for (int step = 0; step < 16; ++step) {
+            double angle = 2 * CGAL_PI * step / 16;
+            BURST::geometry::Segment2D long_path{source, source + BURST::geometry::Vector2D{40 * std::cos(angle), 40 * std::sin(angle)}};
+
+            std::vector<BURST::geometry::Point2D> compact;
+            auto output = std::back_inserter(compact);
+            this->configuration_space->boundary().segmentIntersections(long_path, source, output);
+            std::vector<BURST::geometry::Point2D> reference = this->arrangementIntersections(long_path, source);
+
+            EXPECT_EQ(compact.size(), reference.size()) << "Expected matching hit counts from (" << source << ") at step " << step;
+            for (const BURST::geometry::Point2D& point : reference) {
+                EXPECT_NE(std::find(compact.begin(), compact.end(), point), compact.end()) << "Expected hit (" << point << ") from (" << source << ") at step " << step;
+            }
+        }
+    }
+}
+
+// Test that every intersection lies within the interval reported for some candidate curve
+TEST_F(CompactBoundaryTest, SegmentHitIntervalsContainIntersections) {
+    BURST::geometry::Point2D source{1, 5};
+    for (int step = 0; step < 16; ++step) {
+        double angle = 2 * CGAL_PI * step / 16;
+        BURST::geometry::Point2D target = source + BURST::geometry::Vector2D{40 * std::cos(angle), 40 * std::sin(angle)};
+        std::vector<std::pair<double, double>> intervals;
+        this->configuration_space->boundary().segmentHits(source, target, [&intervals](std::size_t, double t_min, double t_max) {
+            intervals.emplace_back(t_min, t_max);
+        });
+
+        for (const BURST::geometry::Point2D& point : this->arrangementIntersections(BURST::geometry::Segment2D{source, target}, source)) {
+            double t = CGAL::to_double((point - source).squared_length() / (target - source).squared_length());
+            t = std::sqrt(t);
+            bool contained = std::any_of(intervals.begin(), intervals.end(), [t](const std::pair<double, double>& interval) {
+                return interval.first - 1e-9 <= t && t <= interval.second + 1e-9;
+            });
+            EXPECT_TRUE(contained) << "Expected hit (" << point << ") at step " << step << " to lie in a reported interval";
+        }
+    }
+}
+
+// Test that a segment running along a boundary edge reports only the far end of the overlap
+TEST_F(CompactBoundaryTest, SegmentOverlapReportsEndpoint) {
+    BURST::geometry::Point2D source{1, 1};
+    BURST::geometry::Segment2D long_path{source, BURST::geometry::Point2D{40, 1}};
+
+    std::vector<BURST::geometry::Point2D> hits;
+    auto output = std::back_inserter(hits);
+    size_t count = this->configuration_space->boundary().segmentIntersections(long_path, source, output);
+
+    ASSERT_EQ(count, 1) << "Expected a single hit at the far corner of the overlapped edge";
+    EXPECT_EQ(hits.front(), (BURST::geometry::Point2D{19, 1})) << "Expected the far corner of the overlapped edge";
+}
+
+// -- ARC LENGTH TESTS ---------------------------------------------------------
+
+// Test that the perimeter sums the inset walls and the rounded outline of the pillar
+TEST_F(CompactBoundaryTest, Perimeter) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    double sum = 0;
+    for (size_t i = 0; i < boundary.size(); ++i) sum += boundary.length(i);
+    EXPECT_NEAR(boundary.perimeter(), sum, 1e-9) << "Expected the perimeter to be the sum of the curve lengths";
+    EXPECT_NEAR(this->configuration_space->perimeter(), 4 * 18 + 4 * 4 + 2 * CGAL_PI, 1e-9) << "Expected the inset room and the rounded pillar outline";
+}
+
+// Test that points at any arc length lie exactly on the boundary and on the curve they were located in
+TEST_F(CompactBoundaryTest, PointsAtArcLengthAreOnBoundary) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+
+    for (int step = 0; step <= 200; ++step) {
+        double fraction = step / 200.0;
+        auto located = boundary.locateArcLength(fraction);
+        ASSERT_TRUE(located.has_value()) << "Expected a curve at fraction " << fraction;
+        auto point = this->configuration_space->pointAtArcLength(fraction);
+        ASSERT_TRUE(point.has_value()) << "Expected a point at fraction " << fraction;
+        EXPECT_TRUE(this->configuration_space->onEdge(*point)) << "Expected (" << *point << ") at fraction " << fraction << " to lie on the boundary";
+        EXPECT_EQ(boundary.locate(*point).has_value(), true) << "Expected (" << *point << ") to be located on a boundary curve";
+
+        // The point should be where the cumulative length says, up to the approximation of the arc
+        auto [sx, sy] = boundary.source(located->first);
+        double along = CGAL::to_double(CGAL::squared_distance(*point, BURST::geometry::Point2D{sx, sy}));
+        EXPECT_LE(std::sqrt(along), boundary.length(located->first) + 1e-9) << "Expected the point within its curve at fraction " << fraction;
+    }
+}
+
+// Test that uniform samples hit the rounded corners in proportion to their length
+TEST_F(CompactBoundaryTest, UniformSamplesFollowArcLength) {
+    std::mt19937_64 engine{42};
+    std::vector<BURST::geometry::Point2D> samples = this->configuration_space->sampleBoundary(2000, engine);
+    ASSERT_EQ(samples.size(), 2000) << "Expected one sample per request";
+
+    size_t on_pillar = 0;
+    for (const BURST::geometry::Point2D& sample : samples) {
+        double x = CGAL::to_double(sample.x()), y = CGAL::to_double(sample.y());
+        on_pillar += (x > 6.5 && x < 13.5 && y > 6.5 && y < 13.5) ? 1 : 0;
+    }
+    double expected = (16 + 2 * CGAL_PI) / (88 + 2 * CGAL_PI);
+    EXPECT_NEAR(static_cast<double>(on_pillar) / samples.size(), expected, 0.04) << "Expected the pillar to receive samples in proportion to its perimeter";
+
+    for (size_t i = 0; i < 50; ++i) {
+        EXPECT_TRUE(this->configuration_space->onEdge(samples[i])) << "Expected sample (" << samples[i] << ") to lie on the boundary";
+    }
+}
+
+// -- ARC TRAJECTORY TESTS -----------------------------------------------------
+
+// Test that the pruned first arc hit matches refining every curve against the whole circle
+TEST_F(CompactBoundaryTest, FirstArcIntersectionMatchesExhaustive) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+    std::vector<BURST::geometry::Point2D> sources{BURST::geometry::Point2D{1, 5}, BURST::geometry::Point2D{10, 1}, BURST::geometry::Point2D{7, 10}};
+    std::vector<double> curvatures{0.05, 0.2, -0.3, 1.0};
+
+    for (const BURST::geometry::Point2D& source : sources) {
+        for (double curvature : curvatures) {
+            for (int step = 0; step < 8; ++step) {
+                double angle = 2 * CGAL_PI * step / 8;
+                BURST::geometry::ArcTrajectory trajectory{source, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)}, BURST::numeric::fscalar{curvature}};
+
+                // Reference: every meeting point of every curve with the two halves of the circle
+                const BURST::geometry::Point2D& center = trajectory.center();
+                BURST::numeric::fscalar radius = CGAL::sqrt(trajectory.squaredRadius());
+                CGAL::Circle_2<BURST::Kernel> circle{center, trajectory.squaredRadius()};
+                std::vector<BURST::geometry::MonotoneCurve2D> halves{
+                    BURST::geometry::MonotoneCurve2D{circle, BURST::CurvedTraits::Point_2{center.x() - radius, center.y()}, BURST::CurvedTraits::Point_2{center.x() + radius, center.y()}, CGAL::COUNTERCLOCKWISE},
+                    BURST::geometry::MonotoneCurve2D{circle, BURST::CurvedTraits::Point_2{center.x() + radius, center.y()}, BURST::CurvedTraits::Point_2{center.x() - radius, center.y()}, CGAL::COUNTERCLOCKWISE}
+                };
+                std::optional<BURST::geometry::Point2D> expected;
+                for (size_t curve = 0; curve < boundary.size(); ++curve) {
+                    for (const auto& half : halves) {
+                        boundary.refine(curve, half, [&](const BURST::CurvedTraits::Point_2& point) {
+                            auto converted = BURST::geometry::convert_point<BURST::geometry::Point2D, BURST::CurvedTraits::Point_2>(point, BURST::numeric::sqrt_to_fscalar<decltype(point.x())>);
+                            if (converted == source) return;
+                            if (!expected || trajectory.before(converted, *expected)) expected = converted;
+                        });
+                    }
+                }
+
+                EXPECT_EQ(boundary.firstArcIntersection(trajectory), expected) << "Expected matching first hits from (" << source << ") with curvature " << curvature << " at step " << step;
+            }
+        }
+    }
+}
+
+// Test that exact sweep ordering follows the direction of travel around the circle
+TEST_F(CompactBoundaryTest, ArcTrajectoryOrdering) {
+    BURST::geometry::ArcTrajectory left{BURST::geometry::Point2D{1, 0}, BURST::geometry::Vector2D{0, 1}, BURST::numeric::fscalar{1}};
+    BURST::geometry::ArcTrajectory right{BURST::geometry::Point2D{1, 0}, BURST::geometry::Vector2D{0, -1}, BURST::numeric::fscalar{-1}};
+    EXPECT_EQ(left.center(), (BURST::geometry::Point2D{0, 0})) << "Expected the left turn to circle the origin";
+    EXPECT_EQ(right.center(), (BURST::geometry::Point2D{0, 0})) << "Expected the right turn to circle the origin";
+
+    BURST::geometry::Point2D quarter{0, 1}, half{-1, 0}, three_quarters{0, -1};
+    EXPECT_TRUE(left.before(quarter, half) && left.before(half, three_quarters)) << "Expected counterclockwise order for a left turn";
+    EXPECT_TRUE(right.before(three_quarters, half) && right.before(half, quarter)) << "Expected clockwise order for a right turn";
+    EXPECT_NEAR(left.sweep(0, 1), CGAL_PI / 2, 1e-12) << "Expected a quarter turn to the top of the circle";
+    EXPECT_NEAR(right.sweep(0, 1), 3 * CGAL_PI / 2, 1e-12) << "Expected three quarter turns to the top of the circle when turning right";
+}
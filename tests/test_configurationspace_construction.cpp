@@ -2,6 +2,7 @@
 #include <BURST/geometry.hpp>
 #include <BURST/configuration_space.hpp>
 #include <BURST/wall_space.hpp>
+#include <BURST/robot.hpp>
 
 #include "test_helpers.hpp"
 
@@ -365,3 +366,157 @@ TEST(ConfigurationSpaceConstructionTest, DegenerateTightFittingWallSpace) {
     // i.e., it is nullptr
     EXPECT_EQ(configuration_space, nullptr) << "Expected degenerate ConfigurationSpace for a tight-fitting WallSpace, but got a valid geometry.";
 }
+
+
+// -- POLYGONAL ROBOT TESTS ----------------------------------------------------
+
+// Test that a square robot in a square room gets the exact inner square as its configuration space
+TEST(ConfigurationSpaceConstructionTest, PolygonalRobotSquareRoom) {
+    auto wall_space = TestWallSpace::create({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(10, 0),
+        BURST::geometry::Point2D(10, 10),
+        BURST::geometry::Point2D(0, 10)
+    });
+    ASSERT_TRUE(wall_space.has_value()) << "Failed to construct non-degenerate WallSpace";
+
+    // Square footprint of side 2 centred on the robot's position
+    auto footprint = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(-1, -1),
+        BURST::geometry::Point2D(1, -1),
+        BURST::geometry::Point2D(1, 1),
+        BURST::geometry::Point2D(-1, 1)
+    });
+    ASSERT_TRUE(footprint.has_value());
+    auto configuration_space = wall_space->testConstructConfigurationSpace(*footprint);
+    ASSERT_NE(configuration_space, nullptr) << "Expected a configuration space for a square robot in a square room";
+
+    // The free region is exactly [1, 9] x [1, 9]
+    EXPECT_NEAR(static_cast<double>(configuration_space->area()), 64, 1e-12);
+    EXPECT_TRUE(configuration_space->onEdge(BURST::geometry::Point2D(1, 5)));
+    EXPECT_TRUE(configuration_space->onEdge(BURST::geometry::Point2D(9, 9)));
+    EXPECT_TRUE(configuration_space->contains(BURST::geometry::Point2D(5, 5)));
+    EXPECT_FALSE(configuration_space->contains(BURST::geometry::Point2D(0.5, 5)));
+}
+
+// Test that an off-centre footprint is placed relative to the robot's position, not reflected
+TEST(ConfigurationSpaceConstructionTest, PolygonalRobotOffCentreFootprint) {
+    auto wall_space = TestWallSpace::create({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(10, 0),
+        BURST::geometry::Point2D(10, 10),
+        BURST::geometry::Point2D(0, 10)
+    });
+    ASSERT_TRUE(wall_space.has_value()) << "Failed to construct non-degenerate WallSpace";
+
+    // Right triangle extending 2 to the right of and 1 above the robot's position
+    auto footprint = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(2, 0),
+        BURST::geometry::Point2D(0, 1)
+    });
+    ASSERT_TRUE(footprint.has_value());
+    auto configuration_space = wall_space->testConstructConfigurationSpace(*footprint);
+    ASSERT_NE(configuration_space, nullptr);
+
+    // The free region is [0, 8] x [0, 9]
+    EXPECT_NEAR(static_cast<double>(configuration_space->area()), 72, 1e-12);
+    EXPECT_TRUE(configuration_space->onEdge(BURST::geometry::Point2D(0, 0)));
+    EXPECT_TRUE(configuration_space->onEdge(BURST::geometry::Point2D(8, 9)));
+    EXPECT_FALSE(configuration_space->contains(BURST::geometry::Point2D(9, 5)));
+}
+
+// Test a non-convex footprint in a room with a hole
+TEST(ConfigurationSpaceConstructionTest, PolygonalRobotNonConvexWithHole) {
+    std::optional<BURST::geometry::Polygon2D> hole = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(4, 4),
+        BURST::geometry::Point2D(6, 4),
+        BURST::geometry::Point2D(6, 6),
+        BURST::geometry::Point2D(4, 6)
+    });
+    ASSERT_TRUE(hole.has_value()) << "Failed to construct non-degenerate hole.";
+    auto wall_space = TestWallSpace::create({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(10, 0),
+        BURST::geometry::Point2D(10, 10),
+        BURST::geometry::Point2D(0, 10)
+    },
+    {
+        *hole
+    });
+    ASSERT_TRUE(wall_space.has_value()) << "Failed to construct non-degenerate WallSpace";
+
+    // L-shaped footprint whose notch faces up and to the right of the robot's position
+    auto footprint = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(2, 0),
+        BURST::geometry::Point2D(2, 1),
+        BURST::geometry::Point2D(1, 1),
+        BURST::geometry::Point2D(1, 2),
+        BURST::geometry::Point2D(0, 2)
+    });
+    ASSERT_TRUE(footprint.has_value());
+    auto configuration_space = wall_space->testConstructConfigurationSpace(*footprint);
+    ASSERT_NE(configuration_space, nullptr);
+
+    // The hole blocks [2, 6] x [3, 6] and [3, 6] x [2, 3], leaving the notch [2, 3] x [2, 3] free below its corner
+    EXPECT_TRUE(configuration_space->contains(BURST::geometry::Point2D(1, 1)));
+    EXPECT_FALSE(configuration_space->contains(BURST::geometry::Point2D(3.5, 3.5)));
+    EXPECT_TRUE(configuration_space->contains(BURST::geometry::Point2D(2.5, 2.5)));
+    EXPECT_TRUE(configuration_space->contains(BURST::geometry::Point2D(6.5, 6.5)));
+    // At (3, 3) both arms of the L touch the hole without overlapping it
+    EXPECT_TRUE(configuration_space->onEdge(BURST::geometry::Point2D(3, 3)));
+    // Free area is the 8 x 8 square of positions minus the 15 blocked by the hole
+    EXPECT_NEAR(static_cast<double>(configuration_space->area()), 49, 1e-12);
+}
+
+// Test that degenerate footprints and rooms too small for the footprint are rejected
+TEST(ConfigurationSpaceConstructionTest, PolygonalRobotDegenerate) {
+    auto wall_space = TestWallSpace::create({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(10, 0),
+        BURST::geometry::Point2D(10, 2),
+        BURST::geometry::Point2D(0, 2)
+    });
+    ASSERT_TRUE(wall_space.has_value()) << "Failed to construct non-degenerate WallSpace";
+
+    BURST::geometry::Polygon2D collinear;
+    collinear.push_back(BURST::geometry::Point2D(0, 0));
+    collinear.push_back(BURST::geometry::Point2D(1, 0));
+    collinear.push_back(BURST::geometry::Point2D(2, 0));
+    EXPECT_EQ(wall_space->testConstructConfigurationSpace(collinear), nullptr) << "Expected a collinear footprint to be rejected";
+
+    // A footprint exactly as tall as the room leaves only a degenerate segment
+    auto tight = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(-1, -1),
+        BURST::geometry::Point2D(1, -1),
+        BURST::geometry::Point2D(1, 1),
+        BURST::geometry::Point2D(-1, 1)
+    });
+    ASSERT_TRUE(tight.has_value());
+    EXPECT_EQ(wall_space->testConstructConfigurationSpace(*tight), nullptr) << "Expected a tight-fitting footprint to be rejected";
+}
+
+// Test that robots move in a polygonal configuration space like in a disc one
+TEST(ConfigurationSpaceConstructionTest, PolygonalRobotMovement) {
+    auto wall_space = BURST::geometry::WallSpace::create({
+        BURST::geometry::Point2D(0, 0),
+        BURST::geometry::Point2D(10, 0),
+        BURST::geometry::Point2D(10, 10),
+        BURST::geometry::Point2D(0, 10)
+    });
+    ASSERT_TRUE(wall_space.has_value());
+    auto footprint = BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D(-1, -1),
+        BURST::geometry::Point2D(1, -1),
+        BURST::geometry::Point2D(1, 1),
+        BURST::geometry::Point2D(-1, 1)
+    });
+    ASSERT_TRUE(footprint.has_value());
+    auto robot = BURST::Robot<>::create(1, BURST::geometry::Point2D(1, 5), 0);
+    ASSERT_TRUE(robot.has_value());
+    ASSERT_TRUE(wall_space->generateConfigurationSpace(*robot, *footprint));
+
+    ASSERT_TRUE(robot->move(0));
+    EXPECT_EQ(robot->getPosition(), BURST::geometry::Point2D(9, 5));
+}
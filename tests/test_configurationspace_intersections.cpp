@@ -188,6 +188,20 @@ TEST_F(ConfigurationSpaceRegularPolygonIntersectionTest, RayIntersectionRegularP
     check_origin_membership(intersections, ray.source());
 }  
 
+// Test that a curve-typed path, answered through a temporary arrangement (arena-backed with BURST_ENABLE_ARENA), finds the same hit as the indexed segment path
+TEST_F(ConfigurationSpaceRegularPolygonIntersectionTest, CurvePathMatchesSegmentPath) {
+    BURST::geometry::Ray2D ray{BURST::geometry::Point2D{1, 5}, BURST::geometry::Vector2D{1, 0}};
+    std::vector<BURST::geometry::Point2D> segment_hits;
+    std::vector<BURST::geometry::Point2D> curve_hits;
+
+    this->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::Segment2D>(ray, std::back_inserter(segment_hits));
+    size_t curve_count = this->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::MonotoneCurve2D>(ray, std::back_inserter(curve_hits));
+
+    EXPECT_EQ(curve_count, 1) << "Expected the curve path to hit the ConfigurationSpace exactly once, but got " << curve_count << " intersections";
+    EXPECT_EQ(curve_hits, segment_hits) << "Expected both paths to find the same intersection";
+    EXPECT_EQ(BURST::memory::thread_arena().used(), 0) << "Expected no arena memory to be held after the query returns";
+}
+
 // Test ray intersection for a ConfigurationSpace with a regular polygon with a ray that starts at the corner of the ConfigurationSpace and points inward along the angle bisector of the corner
 TEST_F(ConfigurationSpaceRegularPolygonIntersectionTest, RayIntersectionAtCornerRegularPolygon) {
     // Create a ray that starts at the corner of the ConfigurationSpace and points inward along the angle bisector of the corner
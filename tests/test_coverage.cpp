@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+#include <BURST/geometry.hpp>
+#include <BURST/coverage.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the 10 by 10 room fixture, so a robot of radius 1 moves in the square [1, 9] x [1, 9]
+class AreaCoverageTest : public RoomTest {
+protected:
+    // Stadium swept by moving straight up from the bottom wall at `x`
+    BURST::geometry::CurvilinearPolygonSet2D upwardStadium(double x) {
+        this->robot->setPosition(BURST::geometry::Point2D{x, 1});
+        auto covered = this->robot->coveredArea(CGAL_PI / 2);
+        EXPECT_TRUE(covered.has_value()) << "Expected a covered area for an upward move at x = " << x;
+        return covered.value_or(BURST::geometry::CurvilinearPolygonSet2D{});
+    }
+};
+
+// -- COVERAGE TESTS -----------------------------------------------------------
+
+// Test that a fresh tracker reports the whole configuration space as one uncovered region centred in the room
+TEST_F(AreaCoverageTest, NothingCovered) {
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value()) << "Expected a coverage tracker for a valid configuration space";
+
+    EXPECT_NEAR(coverage->coveredFraction(), 0, 1e-12) << "Expected nothing to be covered";
+    const auto& regions = coverage->regions();
+    ASSERT_EQ(regions.size(), 1) << "Expected a single uncovered region";
+    EXPECT_NEAR(regions.front().area, 64, 1e-9) << "Expected the whole 8 by 8 configuration space to be uncovered";
+    EXPECT_NEAR(regions.front().clearance, 4, 0.01) << "Expected the centre of the room to be 4 from the walls";
+    EXPECT_NEAR(CGAL::to_double(regions.front().deepest.x()), 5, 0.1) << "Expected the deepest point near the centre of the room";
+    EXPECT_NEAR(CGAL::to_double(regions.front().deepest.y()), 5, 0.1) << "Expected the deepest point near the centre of the room";
+}
+
+// Test that a precision that is not positive falls back to the default instead of subdividing forever
+TEST_F(AreaCoverageTest, NonPositivePrecision) {
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value()) << "Expected a coverage tracker for a valid configuration space";
+
+    testing::internal::CaptureStderr();
+    for (double precision : {0.0, -1.0, std::nan("")}) {
+        const auto& regions = coverage->regions(precision);
+        ASSERT_EQ(regions.size(), 1) << "Expected a single uncovered region with precision " << precision;
+        EXPECT_NEAR(regions.front().clearance, 4, 0.01) << "Expected the default precision to be used instead of " << precision;
+        EXPECT_TRUE(coverage->largest(precision).has_value()) << "Expected a largest region with precision " << precision;
+    }
+    testing::internal::GetCapturedStderr();
+}
+
+// Test that covering a strip splits the room and ranks the remaining gaps by area
+TEST_F(AreaCoverageTest, RankedGaps) {
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value()) << "Expected a coverage tracker for a valid configuration space";
+
+    // Cover x in [2, 6], leaving [1, 2] and [6, 9] across the full height
+    coverage->add(this->upwardStadium(5));
+    coverage->add(this->upwardStadium(3));
+    EXPECT_NEAR(coverage->coveredFraction(), 32.0 / 64.0, 1e-9) << "Expected half of the configuration space to be covered";
+
+    const auto& regions = coverage->regions();
+    ASSERT_EQ(regions.size(), 2) << "Expected two uncovered strips";
+    EXPECT_NEAR(regions[0].area, 24, 1e-9) << "Expected the wide strip to be ranked first";
+    EXPECT_NEAR(regions[1].area, 8, 1e-9) << "Expected the narrow strip to be ranked second";
+    EXPECT_NEAR(regions[0].clearance, 1.5, 0.01) << "Expected the wide strip to have clearance of half its width";
+    EXPECT_NEAR(CGAL::to_double(regions[0].deepest.x()), 7.5, 0.05) << "Expected the deepest point on the centre line of the wide strip";
+    EXPECT_NEAR(regions[1].clearance, 0.5, 0.01) << "Expected the narrow strip to have clearance of half its width";
+
+    auto largest = coverage->largest();
+    ASSERT_TRUE(largest.has_value()) << "Expected a largest region while gaps remain";
+    EXPECT_NEAR(largest->area, 24, 1e-9) << "Expected the largest region to be the wide strip";
+}
+
+// Test that covering everything leaves no regions and that a null configuration space is rejected
+TEST_F(AreaCoverageTest, FullCoverageAndInvalidInput) {
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value()) << "Expected a coverage tracker for a valid configuration space";
+    coverage->add(this->robot->getConfigurationEnvironment().shape());
+    EXPECT_NEAR(coverage->coveredFraction(), 1, 1e-12) << "Expected everything to be covered";
+    EXPECT_TRUE(coverage->regions().empty()) << "Expected no uncovered regions";
+    EXPECT_FALSE(coverage->largest().has_value()) << "Expected no largest region";
+
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::geometry::AreaCoverage::create(nullptr).has_value()) << "Expected a null configuration space to be rejected";
+    testing::internal::GetCapturedStderr();
+}
+
+// -- BOUNDARY COVERAGE TESTS --------------------------------------------------
+
+// Test that contacts mark merged intervals of the contact width along the wall
+TEST_F(AreaCoverageTest, BoundaryContactIntervals) {
+    auto coverage = BURST::geometry::BoundaryCoverage::create(this->robot->getConfigurationEnvironmentPtr(), 2.0);
+    ASSERT_TRUE(coverage.has_value()) << "Expected a boundary coverage tracker for a valid configuration space";
+    ASSERT_EQ(coverage->loops(), 1) << "Expected a single wall loop";
+    EXPECT_FALSE(coverage->isHole(0)) << "Expected the single loop to be the outer wall";
+    EXPECT_NEAR(coverage->loopLength(0), 32, 1e-9) << "Expected the inset square to have perimeter 32";
+
+    EXPECT_TRUE(coverage->touch(BURST::geometry::Point2D{5, 1})) << "Expected a contact on the bottom wall to be recorded";
+    EXPECT_NEAR(coverage->touchedLength(0), 2, 1e-9) << "Expected one contact width to be touched";
+    EXPECT_TRUE(coverage->touch(BURST::geometry::Point2D{5, 1})) << "Expected a repeated contact to be recorded";
+    EXPECT_NEAR(coverage->touchedLength(0), 2, 1e-9) << "Expected a repeated contact not to add length";
+    EXPECT_TRUE(coverage->touch(BURST::geometry::Point2D{5.5, 1})) << "Expected an overlapping contact to be recorded";
+    EXPECT_NEAR(coverage->touchedLength(0), 2.5, 1e-9) << "Expected an overlapping contact to extend the interval";
+    EXPECT_EQ(coverage->touchedIntervals(0).size(), 1) << "Expected overlapping contacts to merge";
+
+    // A corner contact spans two walls and may wrap around the start of the loop
+    EXPECT_TRUE(coverage->touch(BURST::geometry::Point2D{1, 1})) << "Expected a corner contact to be recorded";
+    EXPECT_NEAR(coverage->touchedLength(0), 4.5, 1e-9) << "Expected a corner contact to add a full contact width";
+    EXPECT_NEAR(coverage->touchedFraction(), 4.5 / 32, 1e-9) << "Expected the touched fraction of the whole boundary";
+}
+
+// Test that points off the boundary and invalid widths are rejected
+TEST_F(AreaCoverageTest, BoundaryContactInvalidInput) {
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::geometry::BoundaryCoverage::create(this->robot->getConfigurationEnvironmentPtr(), 0).has_value()) << "Expected a zero contact width to be rejected";
+    auto coverage = BURST::geometry::BoundaryCoverage::create(this->robot->getConfigurationEnvironmentPtr(), 1.0);
+    ASSERT_TRUE(coverage.has_value()) << "Expected a boundary coverage tracker for a valid configuration space";
+    EXPECT_FALSE(coverage->touch(BURST::geometry::Point2D{5, 5})) << "Expected an interior point to be rejected";
+    std::string errors = testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(errors.empty()) << "Expected the rejected inputs to be reported";
+    EXPECT_NEAR(coverage->touchedFraction(), 0, 1e-12) << "Expected nothing to be touched";
+}
+
+// Use the room around a pillar fixture, so contacts can land on the outer wall or the pillar
+class BoundaryCoverageWithHoleTest : public PillarRoomTest {};
+
+// Test that contacts with a hole are reported against the hole and moves record their endpoints
+TEST_F(BoundaryCoverageWithHoleTest, TouchedFractionPerLoop) {
+    std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{1, 10}, 0);
+    ASSERT_TRUE(robot.has_value() && this->wall_space->generateConfigurationSpace(*robot)) << "Failed to set up the robot";
+
+    auto coverage = BURST::geometry::BoundaryCoverage::create(robot->getConfigurationEnvironmentPtr(), 2.0);
+    ASSERT_TRUE(coverage.has_value()) << "Expected a boundary coverage tracker for a valid configuration space";
+    ASSERT_EQ(coverage->loops(), 2) << "Expected the outer wall and the pillar";
+
+    // Move right from the left wall onto the pillar
+    ASSERT_TRUE(robot->move(0)) << "Expected the move onto the pillar to succeed";
+    EXPECT_TRUE(coverage->touch(robot->getPosition())) << "Expected the move endpoint to be on the boundary";
+
+    std::vector<double> fractions = coverage->touchedFractions();
+    for (size_t loop = 0; loop < coverage->loops(); ++loop) {
+        if (coverage->isHole(loop)) EXPECT_NEAR(fractions[loop], 2 / (16 + 2 * CGAL_PI), 1e-9) << "Expected the pillar to be touched";
+        else EXPECT_NEAR(fractions[loop], 0, 1e-12) << "Expected the outer wall not to be touched";
+    }
+}
+
+// -- MEMORY USAGE TESTS -------------------------------------------------------
+
+// Test that the reported footprints grow with the cached regions and with disjoint contacts
+TEST_F(AreaCoverageTest, MemoryUsageGrowsWithState) {
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value()) << "Expected a coverage tracker for a valid configuration space";
+    BURST::memory::MemoryUsage fresh = coverage->memoryUsage();
+    EXPECT_GT(fresh.arrangement, 0) << "Expected the uncovered set to have arrangement records";
+    EXPECT_GT(fresh.exact, 0) << "Expected the uncovered set to hold exact numbers";
+
+    coverage->add(this->upwardStadium(5));
+    coverage->regions();
+    EXPECT_GT(coverage->memoryUsage().total(), fresh.total()) << "Expected the split set and ranked regions to take more memory";
+
+    auto contacts = BURST::geometry::BoundaryCoverage::create(this->robot->getConfigurationEnvironmentPtr(), 1.0);
+    ASSERT_TRUE(contacts.has_value()) << "Expected a boundary coverage tracker for a valid configuration space";
+    std::size_t untouched = contacts->memoryUsage().total();
+    ASSERT_TRUE(contacts->touch(BURST::geometry::Point2D{3, 1}) && contacts->touch(BURST::geometry::Point2D{7, 1})) << "Expected both contacts to be recorded";
+    EXPECT_GT(contacts->memoryUsage().total(), untouched) << "Expected disjoint intervals to take more memory";
+    EXPECT_EQ(contacts->memoryUsage().exact, 0) << "Expected contact intervals to hold no exact numbers";
+}
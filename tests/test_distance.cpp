@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <BURST/geometry.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/boundary.hpp>
+#include <BURST/wall_space.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the room around a pillar fixture, so nearest points can lie on walls or rounded corners
+class BoundaryDistanceTest : public PillarRoomTest {};
+
+// -- EXACT NEAREST POINT TESTS ------------------------------------------------
+
+// Test that the nearest point of an interior point can be on a straight wall
+TEST_F(BoundaryDistanceTest, NearestOnWall) {
+    auto nearest = this->configuration_space->nearestBoundaryPoint(BURST::geometry::Point2D{3, 10});
+    ASSERT_TRUE(nearest.has_value()) << "Expected a nearest boundary point";
+    EXPECT_EQ(nearest->point, (BURST::geometry::Point2D{1, 10})) << "Expected the nearest point on the inset left wall";
+    EXPECT_EQ(nearest->squared_distance, 4) << "Expected an exact squared distance of 4";
+}
+
+// Test that the nearest point can lie on the rounded corner around the pillar
+TEST_F(BoundaryDistanceTest, NearestOnArc) {
+    BURST::geometry::Point2D query{5, 5};
+    auto nearest = this->configuration_space->nearestBoundaryPoint(query);
+    ASSERT_TRUE(nearest.has_value()) << "Expected a nearest boundary point";
+    EXPECT_TRUE(this->configuration_space->boundary().isArc(nearest->curve)) << "Expected the nearest curve to be the rounded pillar corner";
+    EXPECT_EQ(CGAL::squared_distance(nearest->point, BURST::geometry::Point2D{8, 8}), 1) << "Expected the nearest point on the unit circle around the pillar corner";
+    EXPECT_TRUE(this->configuration_space->onEdge(nearest->point)) << "Expected the nearest point to lie exactly on the boundary";
+    EXPECT_NEAR(CGAL::to_double(nearest->squared_distance), std::pow(std::sqrt(18.0) - 1.0, 2), 1e-12) << "Expected the squared distance to the rounded corner";
+}
+
+// Test that boundary points are their own nearest points and points outside the free space are handled
+TEST_F(BoundaryDistanceTest, NearestOnAndOutsideBoundary) {
+    auto on_boundary = this->configuration_space->nearestBoundaryPoint(BURST::geometry::Point2D{1, 7});
+    ASSERT_TRUE(on_boundary.has_value()) << "Expected a nearest boundary point";
+    EXPECT_EQ(on_boundary->point, (BURST::geometry::Point2D{1, 7})) << "Expected a boundary point to be its own nearest point";
+    EXPECT_EQ(on_boundary->squared_distance, 0) << "Expected zero distance for a boundary point";
+
+    auto outside = this->configuration_space->nearestBoundaryPoint(BURST::geometry::Point2D{0.5, 7});
+    ASSERT_TRUE(outside.has_value()) << "Expected a nearest boundary point";
+    EXPECT_EQ(outside->point, (BURST::geometry::Point2D{1, 7})) << "Expected the wall to be nearest to a point outside the free space";
+    EXPECT_FALSE(this->configuration_space->contains(BURST::geometry::Point2D{0.5, 7})) << "Expected the query point to lie outside the free space";
+}
+
+// -- APPROXIMATE DISTANCE TESTS -----------------------------------------------
+
+// Test that approximate distances agree with the exact nearest points over a grid of query points
+TEST_F(BoundaryDistanceTest, ApproximateMatchesExact) {
+    for (int i = 0; i <= 20; ++i) {
+        for (int j = 0; j <= 20; ++j) {
+            BURST::geometry::Point2D query{0.25 + i * 0.95, 0.4 + j * 0.93};
+            auto exact = this->configuration_space->nearestBoundaryPoint(query);
+            ASSERT_TRUE(exact.has_value()) << "Expected a nearest boundary point at (" << query << ")";
+            double distance = this->configuration_space->distanceToBoundary(query);
+            EXPECT_NEAR(distance, std::sqrt(CGAL::to_double(exact->squared_distance)), 1e-9) << "Expected matching distances at (" << query << ")";
+        }
+    }
+}
+
+// Test that batch queries return the same answers as individual queries
+TEST_F(BoundaryDistanceTest, BatchMatchesSingle) {
+    std::vector<BURST::geometry::Point2D> queries;
+    for (int step = 0; step < 50; ++step) queries.emplace_back(2 + 0.3 * step, 3 + 0.25 * step);
+
+    std::vector<double> distances(queries.size());
+    this->configuration_space->distancesToBoundary(queries, distances);
+    auto nearest = this->configuration_space->nearestBoundaryPoints(queries);
+    ASSERT_EQ(nearest.size(), queries.size()) << "Expected one result per query";
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto single = this->configuration_space->nearestBoundaryPoint(queries[i]);
+        ASSERT_TRUE(single.has_value() && nearest[i].has_value()) << "Expected nearest points for query " << i;
+        EXPECT_EQ(nearest[i]->squared_distance, single->squared_distance) << "Expected the batch to match the single query " << i;
+        EXPECT_NEAR(distances[i], this->configuration_space->distanceToBoundary(queries[i]), 1e-12) << "Expected batch distances to match single distances at query " << i;
+    }
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <BURST/environments.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/robot.hpp>
+
+// Utility includes for tests
+#include <optional>
+
+// -- STAR ROOM TESTS ----------------------------------------------------------
+
+// Test that the same seed reproduces the same star layout
+TEST(EnvironmentGeneratorTest, StarLayoutDeterministic) {
+    BURST::environments::StarParameters parameters;
+    parameters.vertex_count = 48;
+    parameters.hole_count = 6;
+
+    auto first = BURST::environments::star_layout(parameters, 7);
+    auto second = BURST::environments::star_layout(parameters, 7);
+
+    ASSERT_EQ(first.outer.size(), second.outer.size()) << "Expected identical vertex counts for identical seeds";
+    ASSERT_EQ(first.holes.size(), second.holes.size()) << "Expected identical hole counts for identical seeds";
+    for (size_t i = 0; i < first.outer.size(); ++i) {
+        EXPECT_EQ(first.outer[i], second.outer[i]) << "Expected identical outer vertices for identical seeds at index " << i;
+    }
+    for (size_t i = 0; i < first.holes.size(); ++i) {
+        EXPECT_EQ(first.holes[i], second.holes[i]) << "Expected identical holes for identical seeds at index " << i;
+    }
+}
+
+// Test that different seeds produce different star layouts
+TEST(EnvironmentGeneratorTest, StarLayoutSeedSensitive) {
+    BURST::environments::StarParameters parameters;
+
+    auto first = BURST::environments::star_layout(parameters, 1);
+    auto second = BURST::environments::star_layout(parameters, 2);
+
+    ASSERT_EQ(first.outer.size(), second.outer.size()) << "Expected the vertex count to depend only on the parameters";
+    EXPECT_NE(first.outer, second.outer) << "Expected different seeds to produce different outer boundaries";
+}
+
+// Test that a star room with holes is a valid wall space with the requested shape
+TEST(EnvironmentGeneratorTest, StarRoomValid) {
+    BURST::environments::StarParameters parameters;
+    parameters.vertex_count = 64;
+    parameters.hole_count = 8;
+
+    auto layout = BURST::environments::star_layout(parameters, 42);
+    EXPECT_EQ(layout.outer.size(), 64) << "Expected the requested number of outer vertices";
+    EXPECT_EQ(layout.holes.size(), 8) << "Expected the requested number of holes";
+
+    auto wall_space = BURST::environments::build(layout);
+    EXPECT_TRUE(wall_space.has_value()) << "Expected the generated star layout to be a valid wall space";
+}
+
+// Test that zero non-convexity produces a convex outer boundary
+TEST(EnvironmentGeneratorTest, StarRoomConvexWithoutNonConvexity) {
+    BURST::environments::StarParameters parameters;
+    parameters.non_convexity = 0.0;
+
+    auto layout = BURST::environments::star_layout(parameters, 3);
+    BURST::geometry::Polygon2D outer{layout.outer.begin(), layout.outer.end()};
+    EXPECT_TRUE(outer.is_convex()) << "Expected a convex outer boundary with zero non-convexity";
+}
+
+// Test that degenerate star parameters are rejected
+TEST(EnvironmentGeneratorTest, StarRoomDegenerate) {
+    BURST::environments::StarParameters parameters;
+    parameters.vertex_count = 2;
+
+    EXPECT_FALSE(BURST::environments::star_room(parameters, 1).has_value()) << "Expected a two-vertex star room to be rejected";
+}
+
+// -- FLOOR PLAN TESTS ---------------------------------------------------------
+
+// Test that a grid floor plan is a valid wall space whose rooms the robot can move between
+TEST(EnvironmentGeneratorTest, FloorPlanValid) {
+    BURST::environments::FloorPlanParameters parameters;
+    parameters.rows = 3;
+    parameters.columns = 4;
+
+    auto wall_space = BURST::environments::floor_plan(parameters, 11);
+    ASSERT_TRUE(wall_space.has_value()) << "Expected the generated floor plan to be a valid wall space";
+
+    // A robot narrower than the corridors must get a configuration space
+    auto robot = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{1, 1}, 0);
+    ASSERT_TRUE(robot.has_value()) << "Failed to construct robot";
+    EXPECT_TRUE(wall_space->generateConfigurationSpace(*robot)) << "Expected a configuration space for a robot narrower than the corridors";
+}
+
+// Test that walls thicker than the corridors are rejected
+TEST(EnvironmentGeneratorTest, FloorPlanDegenerate) {
+    BURST::environments::FloorPlanParameters parameters;
+    parameters.wall_thickness = 5.0;
+    parameters.corridor_width = 4.0;
+
+    EXPECT_FALSE(BURST::environments::floor_plan(parameters, 1).has_value()) << "Expected walls thicker than the corridors to be rejected";
+}
+
+// -- WAREHOUSE TESTS ----------------------------------------------------------
+
+// Test that a cluttered warehouse with loading bays is a valid wall space
+TEST(EnvironmentGeneratorTest, WarehouseValid) {
+    BURST::environments::WarehouseParameters parameters;
+    parameters.clutter_count = 10;
+    parameters.bay_count = 3;
+
+    auto layout = BURST::environments::warehouse_layout(parameters, 5);
+    EXPECT_EQ(layout.outer.size(), 4 + 4 * parameters.bay_count) << "Expected four extra outer vertices per loading bay";
+    EXPECT_GE(layout.holes.size(), parameters.shelf_rows * parameters.shelves_per_row) << "Expected at least one hole per shelf";
+
+    auto wall_space = BURST::environments::build(layout);
+    EXPECT_TRUE(wall_space.has_value()) << "Expected the generated warehouse layout to be a valid wall space";
+}
+
+// Test that shelves which do not fit with the requested aisles are rejected
+TEST(EnvironmentGeneratorTest, WarehouseDegenerate) {
+    BURST::environments::WarehouseParameters parameters;
+    parameters.height = 10.0;
+    parameters.shelf_rows = 10;
+
+    EXPECT_FALSE(BURST::environments::warehouse(parameters, 1).has_value()) << "Expected an overfull warehouse to be rejected";
+}
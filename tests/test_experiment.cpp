@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <BURST/experiment.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/environments.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <filesystem>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Create a test fixture with a 10 by 10 room around a square pillar, and a scratch directory for files
+class ExperimentTest : public ::testing::Test {
+protected:
+    BURST::environments::Layout layout;
+    std::filesystem::path directory;
+
+    void SetUp() override {
+        this->layout.outer = square_room(10);
+        this->layout.holes.push_back(square_pillar(4, 6));
+        this->directory = std::filesystem::temp_directory_path() / ("burst_experiment_" + std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()});
+        std::filesystem::remove_all(this->directory);
+        ASSERT_TRUE(std::filesystem::create_directories(this->directory)) << "Failed to create scratch directory in test fixture setup";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(this->directory);
+    }
+
+    // Run a few noisy steps from a start spread along the boundary, recording the final position
+    static std::vector<double> walk(std::size_t run, const BURST::experiments::Environment& environment) {
+        std::optional<BURST::geometry::Point2D> start = environment.configuration_space->pointAtArcLength(static_cast<double>(run) / 16.0);
+        auto robot = BURST::Robot<>::create(environment.radius, *start, 0.1, static_cast<unsigned int>(BURST::experiments::run_seed(7, run)));
+        robot->setConfigurationEnvironment(environment.configuration_space);
+        for (int step = 0; step < 4; ++step) {
+            double x = CGAL::to_double(robot->getPosition().x());
+            double y = CGAL::to_double(robot->getPosition().y());
+            robot->move(std::atan2(5 - y, 5 - x) + 0.3 * step);
+        }
+        return {CGAL::to_double(robot->getPosition().x()), CGAL::to_double(robot->getPosition().y())};
+    }
+};
+
+// -- SHARD TESTS --------------------------------------------------------------
+
+// Test that shards partition the runs and parse from text
+TEST(ShardTest, PartitionAndParse) {
+    std::vector<int> owners(10, 0);
+    for (std::size_t index = 0; index < 3; ++index) {
+        BURST::experiments::Shard shard = *BURST::experiments::Shard::create(index, 3);
+        std::size_t owned = 0;
+        for (std::size_t run = 0; run < owners.size(); ++run) {
+            if (shard.owns(run)) {
+                owners[run]++;
+                owned++;
+            }
+        }
+        EXPECT_EQ(shard.size(owners.size()), owned);
+    }
+    EXPECT_EQ(owners, std::vector<int>(10, 1)) << "Expected every run in exactly one shard";
+
+    std::optional<BURST::experiments::Shard> parsed = BURST::experiments::Shard::parse("2/8");
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->index, 2u);
+    EXPECT_EQ(parsed->count, 8u);
+
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::experiments::Shard::parse("8/8").has_value());
+    EXPECT_FALSE(BURST::experiments::Shard::parse("1/").has_value());
+    EXPECT_FALSE(BURST::experiments::Shard::parse("x").has_value());
+    EXPECT_FALSE(BURST::experiments::Shard::create(0, 0).has_value());
+    testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(BURST::experiments::run_seed(1, 5), BURST::experiments::run_seed(1, 5));
+    EXPECT_NE(BURST::experiments::run_seed(1, 5), BURST::experiments::run_seed(1, 6));
+}
+
+// -- FILE FORMAT TESTS --------------------------------------------------------
+
+// Test that an environment file rebuilds the same layout and configuration space
+TEST_F(ExperimentTest, EnvironmentRoundTrip) {
+    std::filesystem::path path = this->directory / "room.env";
+    ASSERT_TRUE(BURST::experiments::write_environment(path, this->layout, 0.5));
+    EXPECT_FALSE(std::filesystem::exists(this->directory / "room.env.partial")) << "Expected the temporary file to be renamed";
+
+    std::optional<BURST::experiments::Environment> environment = BURST::experiments::read_environment(path);
+    ASSERT_TRUE(environment.has_value());
+    EXPECT_EQ(environment->radius, 0.5);
+    EXPECT_EQ(environment->layout.outer, this->layout.outer);
+    ASSERT_EQ(environment->layout.holes.size(), 1u);
+    EXPECT_EQ(environment->layout.holes[0], this->layout.holes[0]);
+    ASSERT_NE(environment->configuration_space, nullptr);
+    EXPECT_TRUE(environment->configuration_space->contains(BURST::geometry::Point2D{2, 2}));
+    EXPECT_FALSE(environment->configuration_space->contains(BURST::geometry::Point2D{5, 5}));
+}
+
+// Test that malformed data and inexact coordinates are rejected
+TEST_F(ExperimentTest, RejectsInvalidData) {
+    testing::internal::CaptureStderr();
+    std::stringstream truncated;
+    ASSERT_TRUE(BURST::experiments::write_environment(truncated, this->layout, 0.5));
+    std::string bytes = truncated.str();
+    std::stringstream shortened{bytes.substr(0, bytes.size() - 4)};
+    EXPECT_FALSE(BURST::experiments::read_environment(shortened).has_value());
+
+    std::stringstream wrong_kind{bytes};
+    EXPECT_FALSE(BURST::experiments::read_results(wrong_kind).has_value()) << "Expected an environment file to be rejected as results";
+
+    // A record count larger than the data that follows is rejected before anything is reserved
+    std::stringstream header;
+    ASSERT_TRUE(BURST::experiments::write_results(header, BURST::experiments::ResultSet{std::uint64_t{1} << 39, 0, 1, 2, {}}));
+    std::string result_bytes = header.str();
+    constexpr std::size_t RECORD_COUNT_OFFSET = 40;
+    for (std::size_t i = 0; i < 8; ++i) result_bytes[RECORD_COUNT_OFFSET + i] = static_cast<char>(((std::uint64_t{1} << 39) >> (8 * i)) & 0xFF);
+    std::stringstream inflated{result_bytes};
+    EXPECT_FALSE(BURST::experiments::read_results(inflated).has_value()) << "Expected a count beyond the file size to be rejected";
+
+    std::stringstream inexact;
+    EXPECT_FALSE(BURST::experiments::write_environment(inexact, this->layout, BURST::numeric::fscalar{1} / 3));
+    EXPECT_FALSE(BURST::experiments::read_environment(this->directory / "missing.env").has_value());
+    testing::internal::GetCapturedStderr();
+}
+
+// -- SHARDED RUN TESTS --------------------------------------------------------
+
+// Test that shards run in any order merge into the same bytes as one unsharded run
+TEST_F(ExperimentTest, ShardedRunsMergeDeterministically) {
+    constexpr std::size_t RUNS = 16;
+    std::filesystem::path environment_path = this->directory / "room.env";
+    ASSERT_TRUE(BURST::experiments::write_environment(environment_path, this->layout, 0.5));
+
+    // Every "process" loads the environment file on its own
+    std::optional<BURST::experiments::Environment> whole_environment = BURST::experiments::read_environment(environment_path);
+    ASSERT_TRUE(whole_environment.has_value());
+    std::optional<BURST::experiments::ResultSet> whole = BURST::experiments::run_shard(*whole_environment, RUNS, 2, BURST::experiments::Shard{}, walk);
+    ASSERT_TRUE(whole.has_value());
+    EXPECT_TRUE(whole->complete());
+
+    std::vector<std::filesystem::path> files;
+    for (std::size_t index : {2u, 0u, 1u}) {
+        std::optional<BURST::experiments::Environment> environment = BURST::experiments::read_environment(environment_path);
+        ASSERT_TRUE(environment.has_value());
+        std::optional<BURST::experiments::ResultSet> shard = BURST::experiments::run_shard(*environment, RUNS, 2, *BURST::experiments::Shard::create(index, 3), walk);
+        ASSERT_TRUE(shard.has_value());
+        EXPECT_EQ(shard->results.size(), BURST::experiments::Shard{index, 3}.size(RUNS));
+        files.push_back(this->directory / ("shard" + std::to_string(index) + ".bin"));
+        ASSERT_TRUE(BURST::experiments::write_results(files.back(), *shard));
+    }
+
+    std::optional<BURST::experiments::ResultSet> merged = BURST::experiments::merge_result_files(files, this->directory / "merged.bin");
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_TRUE(merged->complete());
+    EXPECT_EQ(*merged, *whole);
+
+    std::stringstream whole_bytes;
+    std::stringstream merged_bytes;
+    ASSERT_TRUE(BURST::experiments::write_results(whole_bytes, *whole));
+    ASSERT_TRUE(BURST::experiments::write_results(merged_bytes, *BURST::experiments::read_results(this->directory / "merged.bin")));
+    EXPECT_EQ(merged_bytes.str(), whole_bytes.str()) << "Expected the merged file to match an unsharded run byte for byte";
+}
+
+// Test that concurrent runs within a memory budget produce the same results as serial runs
+TEST_F(ExperimentTest, ThrottledRunsMatchSerial) {
+    constexpr std::size_t RUNS = 8;
+    std::stringstream stream;
+    ASSERT_TRUE(BURST::experiments::write_environment(stream, this->layout, 0.5));
+    std::optional<BURST::experiments::Environment> environment = BURST::experiments::read_environment(stream);
+    ASSERT_TRUE(environment.has_value());
+
+    std::size_t shared = environment->configuration_space->memoryUsage().total();
+    EXPECT_EQ(BURST::experiments::concurrent_runs(*environment, {4, 0, 0}), 4u) << "Expected no memory limit without a budget";
+    EXPECT_EQ(BURST::experiments::concurrent_runs(*environment, {4, shared + 2048, 1000}), 2u) << "Expected the budget to allow two runs";
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(BURST::experiments::concurrent_runs(*environment, {4, shared, 1000}), 1u) << "Expected at least one run when nothing fits";
+    EXPECT_FALSE(testing::internal::GetCapturedStderr().empty()) << "Expected a warning when the budget is too small";
+
+    std::optional<BURST::experiments::ResultSet> serial = BURST::experiments::run_shard(*environment, RUNS, 2, BURST::experiments::Shard{}, walk);
+    std::optional<BURST::experiments::ResultSet> concurrent = BURST::experiments::run_shard(*environment, RUNS, 2, BURST::experiments::Shard{}, {3, shared + 3000, 1000}, walk);
+    ASSERT_TRUE(serial.has_value());
+    ASSERT_TRUE(concurrent.has_value());
+    EXPECT_EQ(*concurrent, *serial) << "Expected results in run order regardless of concurrency";
+}
+
+// Test that merging rejects overlapping or mismatched shards and reports missing runs
+TEST_F(ExperimentTest, MergeValidation) {
+    BURST::experiments::ResultSet first{4, 0, 2, 1, {{0, {1.0}}, {2, {3.0}}}};
+    BURST::experiments::ResultSet second{4, 1, 2, 1, {{1, {2.0}}}};
+
+    std::vector<BURST::experiments::ResultSet> partial{second, first};
+    std::optional<BURST::experiments::ResultSet> merged = BURST::experiments::merge_results(partial);
+    ASSERT_TRUE(merged.has_value());
+    EXPECT_FALSE(merged->complete());
+    ASSERT_EQ(merged->results.size(), 3u);
+    EXPECT_EQ(merged->results[1], (BURST::experiments::RunResult{1, {2.0}}));
+
+    testing::internal::CaptureStderr();
+    std::vector<BURST::experiments::ResultSet> overlapping{first, first};
+    EXPECT_FALSE(BURST::experiments::merge_results(overlapping).has_value());
+    BURST::experiments::ResultSet other_experiment = second;
+    other_experiment.value_count = 2;
+    std::vector<BURST::experiments::ResultSet> mismatched{first, other_experiment};
+    EXPECT_FALSE(BURST::experiments::merge_results(mismatched).has_value());
+    testing::internal::GetCapturedStderr();
+}
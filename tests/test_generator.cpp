@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <BURST/generator.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the 10 by 10 room fixture for robot steps
+class GeneratorTest : public RoomTest {};
+
+// Integers from 0 up to, but excluding, `count`, counting how many were produced
+static BURST::Generator<int> count_up(int count, int& produced) {
+    for (int i = 0; i < count; ++i) {
+        ++produced;
+        co_yield i;
+    }
+}
+
+// -- GENERATOR TESTS ----------------------------------------------------------
+
+// Test that values are produced lazily and compose with range adaptors
+TEST(GeneratorBasicTest, LazyRangePipeline) {
+    int produced = 0;
+    BURST::Generator<int> numbers = count_up(100, produced);
+    EXPECT_EQ(produced, 0) << "Expected nothing to run before the first value is requested";
+
+    std::vector<int> squares;
+    for (int square : std::move(numbers) | std::views::filter([](int i) { return i % 2 == 1; }) | std::views::transform([](int i) { return i * i; })) {
+        squares.push_back(square);
+        if (squares.size() == 3) break;
+    }
+    EXPECT_EQ(squares, (std::vector<int>{1, 9, 25}));
+    EXPECT_EQ(produced, 6) << "Expected generation to stop when the loop is left";
+}
+
+// Test that exceptions thrown inside the coroutine reach the consumer
+TEST(GeneratorBasicTest, PropagatesExceptions) {
+    auto throwing = []() -> BURST::Generator<int> {
+        co_yield 1;
+        throw std::runtime_error{"generator failure"};
+    };
+    BURST::Generator<int> values = throwing();
+    auto it = values.begin();
+    EXPECT_EQ(*it, 1);
+    EXPECT_THROW(++it, std::runtime_error);
+}
+
+// -- ROBOT STEP TESTS ---------------------------------------------------------
+
+// Test that each commanded heading produces one step result
+TEST_F(GeneratorTest, StepsOverHeadings) {
+    std::vector<BURST::numeric::fscalar> angles{0, CGAL_PI};
+    std::vector<BURST::StepResult> results;
+    for (const BURST::StepResult& result : this->robot->steps(angles)) results.push_back(result);
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].status, BURST::StepStatus::Moved);
+    EXPECT_EQ(results[0].position, BURST::geometry::Point2D(9, 5));
+    EXPECT_TRUE(results[0].curve.has_value());
+    EXPECT_EQ(results[0].error, 0);
+    EXPECT_EQ(results[1].status, BURST::StepStatus::Moved);
+    EXPECT_NEAR(CGAL::to_double(results[1].position.x()), 1.0, 1e-12);
+    EXPECT_NE(results[0].curve, results[1].curve) << "Expected opposite walls to be different boundary curves";
+    EXPECT_EQ(this->robot->getPosition(), results[1].position);
+}
+
+// Test that a policy-driven run only computes the steps that are consumed
+TEST_F(GeneratorTest, PolicyStepsStopEarly) {
+    int calls = 0;
+    auto bounce = [&calls](const BURST::Robot<>& robot) -> BURST::numeric::fscalar {
+        ++calls;
+        return robot.getPosition().x() < 5 ? 0 : CGAL_PI;
+    };
+
+    size_t consumed = 0;
+    for (const BURST::StepResult& result : this->robot->steps(bounce)) {
+        EXPECT_EQ(result.status, BURST::StepStatus::Moved);
+        if (++consumed == 5) break;
+    }
+    EXPECT_EQ(calls, 5) << "Expected no steps beyond the consumed ones";
+    EXPECT_NEAR(CGAL::to_double(this->robot->getPosition().x()), 9.0, 1e-12);
+
+    // Range adaptors can bound the unbounded run, too
+    auto positions = this->robot->steps(bounce) | std::views::take(2) | std::views::transform([](const BURST::StepResult& result) { return result.position; });
+    size_t count = 0;
+    for (const BURST::geometry::Point2D& position : positions) {
+        EXPECT_TRUE(this->robot->getConfigurationEnvironment().onEdge(position));
+        ++count;
+    }
+    EXPECT_EQ(count, 2u);
+}
+
+// Test that a robot without a configuration space yields a single failed step
+TEST_F(GeneratorTest, UnattachedRobotStops) {
+    std::optional<BURST::Robot<>> detached = BURST::Robot<>::create(1, BURST::geometry::Point2D{1, 5}, 0);
+    ASSERT_TRUE(detached.has_value());
+    std::vector<BURST::numeric::fscalar> angles{0, 0, 0};
+
+    testing::internal::CaptureStderr();
+    std::vector<BURST::StepStatus> statuses;
+    for (const BURST::StepResult& result : detached->steps(angles)) statuses.push_back(result.status);
+    testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(statuses, (std::vector<BURST::StepStatus>{BURST::StepStatus::Unattached}));
+}
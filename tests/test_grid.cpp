@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include <BURST/geometry.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/boundary.hpp>
+#include <BURST/grid.hpp>
+#include <BURST/wall_space.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Create a test fixture with a square room around a two-by-two grid of square pillars
+class BoundaryGridTest : public ::testing::Test {
+protected:
+    std::shared_ptr<BURST::geometry::ConfigurationSpace> configuration_space;
+    std::vector<BURST::geometry::Point2D> sources{
+        BURST::geometry::Point2D{1, 5}, BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{15, 29}, BURST::geometry::Point2D{7, 10}
+    };
+
+    void SetUp() override {
+        auto pillar = [](double x, double y) {
+            return *BURST::geometry::construct_polygon({
+                BURST::geometry::Point2D{x, y},
+                BURST::geometry::Point2D{x + 4, y},
+                BURST::geometry::Point2D{x + 4, y + 4},
+                BURST::geometry::Point2D{x, y + 4}
+            });
+        };
+        auto wall_space = TestWallSpace::create({
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{30, 0},
+            BURST::geometry::Point2D{30, 30},
+            BURST::geometry::Point2D{0, 30}
+        }, {pillar(8, 8), pillar(18, 8), pillar(8, 18), pillar(18, 18)});
+        ASSERT_TRUE(wall_space.has_value()) << "Failed to construct non-degenerate WallSpace in test fixture setup";
+
+        this->configuration_space = wall_space->testConstructConfigurationSpace(1);
+        ASSERT_NE(this->configuration_space, nullptr) << "Failed to construct non-degenerate ConfigurationSpace in test fixture setup";
+    }
+
+    // Long segment from `source` in the direction of fan step `step` out of 16
+    static BURST::geometry::Segment2D fanPath(const BURST::geometry::Point2D& source, int step) {
+        double angle = 2 * CGAL_PI * step / 16 + 0.1;
+        return BURST::geometry::Segment2D{source, source + BURST::geometry::Vector2D{60 * std::cos(angle), 60 * std::sin(angle)}};
+    }
+};
+
+// -- STRUCTURE TESTS ----------------------------------------------------------
+
+// Test that every curve is bucketed into the cell containing each of its endpoints
+TEST_F(BoundaryGridTest, CellsHoldCurveEndpoints) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+    BURST::geometry::BoundaryGrid grid{boundary};
+    ASSERT_GT(grid.columns() * grid.rows(), 1) << "Expected the grid to subdivide the boundary";
+    EXPECT_GE(grid.entries(), boundary.size()) << "Expected every curve to be bucketed at least once";
+
+    BURST::geometry::BoundingBox2D box = boundary.bbox();
+    double cell_width = (box.xmax() - box.xmin()) / static_cast<double>(grid.columns());
+    double cell_height = (box.ymax() - box.ymin()) / static_cast<double>(grid.rows());
+    for (std::size_t curve = 0; curve < boundary.size(); ++curve) {
+        auto [x, y] = boundary.source(curve);
+        std::size_t column = std::min(static_cast<std::size_t>((x - box.xmin()) / cell_width), grid.columns() - 1);
+        std::size_t row = std::min(static_cast<std::size_t>((y - box.ymin()) / cell_height), grid.rows() - 1);
+        auto cell = grid.cell(column, row);
+        EXPECT_NE(std::find(cell.begin(), cell.end(), curve), cell.end()) << "Expected curve " << curve << " in the cell of its source";
+    }
+}
+
+// Test that the DDA walk visits adjacent cells with contiguous, increasing parameter ranges
+TEST_F(BoundaryGridTest, TraverseVisitsCellsInOrder) {
+    BURST::geometry::BoundaryGrid grid{this->configuration_space->boundary(), 4.0};
+    for (int step = 0; step < 16; ++step) {
+        BURST::geometry::Segment2D path = fanPath(BURST::geometry::Point2D{3, 7}, step);
+        std::size_t previous_column = 0, previous_row = 0;
+        double previous_exit = -1;
+        std::size_t visited = 0;
+        grid.traverse(path.source(), path.target(), [&](std::size_t column, std::size_t row, double t_enter, double t_exit) {
+            EXPECT_LE(t_enter, t_exit) << "Expected a non-empty parameter range at step " << step;
+            if (visited > 0) {
+                EXPECT_DOUBLE_EQ(t_enter, previous_exit) << "Expected contiguous parameter ranges at step " << step;
+                std::size_t distance = (column > previous_column ? column - previous_column : previous_column - column) + (row > previous_row ? row - previous_row : previous_row - row);
+                EXPECT_EQ(distance, 1) << "Expected consecutive cells to share a side at step " << step;
+            }
+            previous_column = column;
+            previous_row = row;
+            previous_exit = t_exit;
+            visited++;
+            return true;
+        });
+        EXPECT_GT(visited, 1) << "Expected the walk to cross several cells at step " << step;
+    }
+}
+
+// -- QUERY TESTS --------------------------------------------------------------
+
+// Test that the grid finds the same intersections as the hierarchy for a fan of rays
+TEST_F(BoundaryGridTest, SegmentIntersectionsMatchHierarchy) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+    BURST::geometry::BoundaryGrid grid{boundary};
+    for (const BURST::geometry::Point2D& source : this->sources) {
+        for (int step = 0; step < 16; ++step) {
+            BURST::geometry::Segment2D path = fanPath(source, step);
+            std::vector<BURST::geometry::Point2D> from_grid, from_hierarchy;
+            auto grid_output = std::back_inserter(from_grid);
+            auto hierarchy_output = std::back_inserter(from_hierarchy);
+            grid.segmentIntersections(boundary, path, source, grid_output);
+            boundary.segmentIntersections(path, source, hierarchy_output);
+
+            EXPECT_EQ(from_grid.size(), from_hierarchy.size()) << "Expected matching hit counts from (" << source << ") at step " << step;
+            for (const BURST::geometry::Point2D& point : from_hierarchy) {
+                EXPECT_NE(std::find(from_grid.begin(), from_grid.end(), point), from_grid.end()) << "Expected hit (" << point << ") from (" << source << ") at step " << step;
+            }
+        }
+    }
+}
+
+// Test that both first-hit searches return the closest of all intersections
+TEST_F(BoundaryGridTest, FirstIntersectionIsClosest) {
+    const BURST::geometry::CompactBoundary& boundary = this->configuration_space->boundary();
+    BURST::geometry::BoundaryGrid grid{boundary};
+    for (const BURST::geometry::Point2D& source : this->sources) {
+        for (int step = 0; step < 16; ++step) {
+            BURST::geometry::Segment2D path = fanPath(source, step);
+            std::vector<BURST::geometry::Point2D> all;
+            auto output = std::back_inserter(all);
+            boundary.segmentIntersections(path, source, output);
+            ASSERT_FALSE(all.empty()) << "Expected a ray from inside the room to hit the boundary";
+            BURST::geometry::Point2D closest = *std::min_element(all.begin(), all.end(), [&source](const BURST::geometry::Point2D& a, const BURST::geometry::Point2D& b) {
+                return CGAL::squared_distance(a, source) < CGAL::squared_distance(b, source);
+            });
+
+            auto from_grid = grid.firstSegmentIntersection(boundary, path, source);
+            auto from_hierarchy = boundary.firstSegmentIntersection(path, source);
+            ASSERT_TRUE(from_grid.has_value()) << "Expected a first hit from the grid from (" << source << ") at step " << step;
+            ASSERT_TRUE(from_hierarchy.has_value()) << "Expected a first hit from the hierarchy from (" << source << ") at step " << step;
+            EXPECT_EQ(*from_grid, closest) << "Expected the grid to return the closest hit from (" << source << ") at step " << step;
+            EXPECT_EQ(*from_hierarchy, closest) << "Expected the hierarchy to return the closest hit from (" << source << ") at step " << step;
+        }
+    }
+}
+
+// Test that a ray running along a wall stops at the far end of the overlap
+TEST_F(BoundaryGridTest, FirstIntersectionAlongWall) {
+    BURST::geometry::Point2D source{1, 1};
+    BURST::geometry::Segment2D path{source, BURST::geometry::Point2D{60, 1}};
+    BURST::geometry::BoundaryGrid grid{this->configuration_space->boundary()};
+
+    auto hit = grid.firstSegmentIntersection(this->configuration_space->boundary(), path, source);
+    ASSERT_TRUE(hit.has_value()) << "Expected a hit at the far corner of the overlapped wall";
+    EXPECT_EQ(*hit, (BURST::geometry::Point2D{29, 1})) << "Expected the far corner of the overlapped wall";
+}
+
+// -- CONFIGURATION SPACE TESTS ------------------------------------------------
+
+// Test that switching the configuration space to the grid index leaves query results unchanged
+TEST_F(BoundaryGridTest, ConfigurationSpaceIndexSelection) {
+    EXPECT_EQ(this->configuration_space->boundaryIndex(), BURST::geometry::BoundaryIndex::Hierarchy) << "Expected the hierarchy to be the default index";
+
+    std::vector<BURST::geometry::Ray2D> rays;
+    for (int step = 0; step < 16; ++step) {
+        double angle = 2 * CGAL_PI * step / 16 + 0.1;
+        rays.emplace_back(BURST::geometry::Point2D{1, 5}, BURST::geometry::Vector2D{std::cos(angle), std::sin(angle)});
+    }
+    std::vector<std::optional<BURST::geometry::Point2D>> first_hits;
+    std::vector<size_t> hit_counts;
+    for (const BURST::geometry::Ray2D& ray : rays) {
+        std::vector<BURST::geometry::Point2D> all;
+        hit_counts.push_back(this->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::Segment2D>(ray, std::back_inserter(all)));
+        first_hits.push_back(this->configuration_space->firstIntersection(ray));
+    }
+
+    this->configuration_space->useBoundaryIndex(BURST::geometry::BoundaryIndex::Grid);
+    EXPECT_EQ(this->configuration_space->boundaryIndex(), BURST::geometry::BoundaryIndex::Grid) << "Expected the grid index to be selected";
+    for (size_t i = 0; i < rays.size(); ++i) {
+        std::vector<BURST::geometry::Point2D> all;
+        EXPECT_EQ(this->configuration_space->intersection<BURST::geometry::Ray2D, BURST::geometry::Segment2D>(rays[i], std::back_inserter(all)), hit_counts[i]) << "Expected the same hit count from both indices for ray " << i;
+        EXPECT_EQ(this->configuration_space->firstIntersection(rays[i]), first_hits[i]) << "Expected the same first hit from both indices for ray " << i;
+    }
+}
@@ -3,12 +3,16 @@
 
 #include <gtest/gtest.h>
 #include <BURST/wall_space.hpp>
+#include <BURST/robot.hpp>
 #include <BURST/configuration_space.hpp>
 #include <BURST/numeric.hpp>
 #include <BURST/geometry.hpp>
 #include <BURST/kernel.hpp>
 
 #include <initializer_list>
+#include <memory>
+#include <optional>
+#include <vector>
 
 #include <CGAL/Arr_walk_along_line_point_location.h>
 
@@ -53,6 +57,74 @@ public:
     std::shared_ptr<BURST::geometry::ConfigurationSpace> testConstructConfigurationSpace(BURST::numeric::fscalar robot_radius) const {
         return this->constructConfigurationSpace(robot_radius);
     }
+    std::shared_ptr<BURST::geometry::ConfigurationSpace> testConstructConfigurationSpace(const BURST::geometry::Polygon2D& footprint) const {
+        return this->constructConfigurationSpace(footprint);
+    }
+};
+
+// -- SHARED GEOMETRY ----------------------------------------------------------
+
+// Outer walls of a `size` by `size` room with a corner at the origin
+inline std::vector<BURST::geometry::Point2D> square_room(double size) {
+    return {
+        BURST::geometry::Point2D{0.0, 0.0},
+        BURST::geometry::Point2D{size, 0.0},
+        BURST::geometry::Point2D{size, size},
+        BURST::geometry::Point2D{0.0, size}
+    };
+}
+
+// Square pillar covering [low, high] on both axes
+inline BURST::geometry::Polygon2D square_pillar(double low, double high) {
+    return *BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D{low, low},
+        BURST::geometry::Point2D{high, low},
+        BURST::geometry::Point2D{high, high},
+        BURST::geometry::Point2D{low, high}
+    });
+}
+
+// -- SHARED FIXTURES ----------------------------------------------------------
+
+// Create a test fixture with a 10 by 10 room and a robot of radius 1 on the middle of its left wall
+class RoomTest : public ::testing::Test {
+protected:
+    std::optional<TestWallSpace> wall_space;
+    std::optional<BURST::Robot<>> robot;
+
+    void SetUp() override {
+        this->wall_space = TestWallSpace::create({
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{10, 0},
+            BURST::geometry::Point2D{10, 10},
+            BURST::geometry::Point2D{0, 10}
+        });
+        ASSERT_TRUE(this->wall_space.has_value()) << "Failed to construct wall space in test fixture setup";
+        this->robot = BURST::Robot<>::create(1, BURST::geometry::Point2D{1, 5}, 0);
+        ASSERT_TRUE(this->robot.has_value()) << "Failed to construct robot in test fixture setup";
+        ASSERT_TRUE(this->wall_space->generateConfigurationSpace(*this->robot)) << "Failed to generate configuration space in test fixture setup";
+    }
+};
+
+// Create a test fixture with a 20 by 20 room around a 4 by 4 square pillar and the configuration space of a robot of radius 1,
+// which has two loops and rounded corners around the pillar
+class PillarRoomTest : public ::testing::Test {
+protected:
+    std::optional<TestWallSpace> wall_space;
+    std::shared_ptr<BURST::geometry::ConfigurationSpace> configuration_space;
+
+    void SetUp() override {
+        this->wall_space = TestWallSpace::create({
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{20, 0},
+            BURST::geometry::Point2D{20, 20},
+            BURST::geometry::Point2D{0, 20}
+        }, {square_pillar(8, 12)});
+        ASSERT_TRUE(this->wall_space.has_value()) << "Failed to construct non-degenerate WallSpace in test fixture setup";
+
+        this->configuration_space = this->wall_space->testConstructConfigurationSpace(1);
+        ASSERT_NE(this->configuration_space, nullptr) << "Failed to construct non-degenerate ConfigurationSpace in test fixture setup";
+    }
 };
 
 #endif
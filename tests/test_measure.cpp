@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <BURST/geometry.hpp>
+#include <BURST/measure.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+
+#include <boost/math/constants/constants.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Whether robots of type R can report the area swept by a move
+template <typename R>
+concept sweeps_area = requires(const R& robot) { robot.coveredArea(0); };
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the room around a pillar fixture, whose free area and perimeter are known in closed form
+class MeasureTest : public PillarRoomTest {
+protected:
+    // Linear polygon promoted to a curvilinear polygon set
+    static BURST::geometry::CurvilinearPolygonSet2D promote(const BURST::geometry::Polygon2D& polygon) {
+        std::vector<BURST::geometry::MonotoneCurve2D> curves;
+        for (auto edge_it = polygon.edges_begin(); edge_it != polygon.edges_end(); ++edge_it) curves.push_back(BURST::geometry::construct_curve(*edge_it));
+        BURST::geometry::CurvilinearPolygonSet2D shape;
+        shape.join(BURST::geometry::CurvilinearPolygon2D{curves.begin(), curves.end()});
+        return shape;
+    }
+};
+
+// -- POLYGON SET TESTS --------------------------------------------------------
+
+// Test that a linear square is measured exactly in both modes
+TEST_F(MeasureTest, Square) {
+    auto shape = promote(*BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D{0, 0}, BURST::geometry::Point2D{10, 0}, BURST::geometry::Point2D{10, 10}, BURST::geometry::Point2D{0, 10}
+    }));
+    EXPECT_EQ(BURST::geometry::area(shape), 100) << "Expected the exact area of a 10 by 10 square";
+    EXPECT_EQ(BURST::geometry::perimeter(shape), 40) << "Expected the exact perimeter of a 10 by 10 square";
+    EXPECT_DOUBLE_EQ(BURST::geometry::area<double>(shape), 100) << "Expected the double area of a 10 by 10 square";
+}
+
+// Test that a circle built from two semicircular arcs has area pi r^2 and perimeter 2 pi r
+TEST_F(MeasureTest, Circle) {
+    BURST::geometry::CurvilinearPolygonSet2D shape;
+    shape.join(*BURST::geometry::construct_circle(2, BURST::geometry::Point2D{3, -1}));
+
+    BURST::numeric::hpscalar pi = boost::math::constants::pi<BURST::numeric::hpscalar>();
+    auto measured = BURST::geometry::measure(shape);
+    EXPECT_LT(boost::multiprecision::abs(measured.area - 4 * pi), 1e-40) << "Expected the high-precision area of a circle of radius 2";
+    EXPECT_LT(boost::multiprecision::abs(measured.perimeter - 4 * pi), 1e-40) << "Expected the high-precision perimeter of a circle of radius 2";
+
+    auto approximate = BURST::geometry::measure<double>(shape);
+    EXPECT_NEAR(approximate.area, 4 * CGAL_PI, 1e-12) << "Expected the double area of a circle of radius 2";
+    EXPECT_NEAR(approximate.perimeter, 4 * CGAL_PI, 1e-12) << "Expected the double perimeter of a circle of radius 2";
+}
+
+// Test that full circles anywhere, whose semicircles have a signed-zero cross product, measure pi r^2
+TEST_F(MeasureTest, CircleAreaMatchesClosedForm) {
+    for (const BURST::geometry::Point2D& center : {BURST::geometry::Point2D{0, 0}, BURST::geometry::Point2D{-4, 7}, BURST::geometry::Point2D{0.5, -2.25}}) {
+        for (int radius : {1, 3}) {
+            BURST::geometry::CurvilinearPolygonSet2D shape;
+            shape.join(*BURST::geometry::construct_circle(radius, center));
+            EXPECT_NEAR(BURST::geometry::area<double>(shape), CGAL_PI * radius * radius, 1e-12) << "Expected the double area of a circle of radius " << radius << " at (" << center << ")";
+            EXPECT_NEAR(static_cast<double>(BURST::geometry::area(shape)), CGAL_PI * radius * radius, 1e-12) << "Expected the high-precision area of a circle of radius " << radius << " at (" << center << ")";
+            EXPECT_NEAR(BURST::geometry::perimeter<double>(shape), 2 * CGAL_PI * radius, 1e-12) << "Expected the perimeter of a circle of radius " << radius;
+        }
+    }
+}
+
+// Test that holes subtract from the area and add to the perimeter
+TEST_F(MeasureTest, SquareWithHole) {
+    auto shape = promote(*BURST::geometry::construct_polygon({
+        BURST::geometry::Point2D{0, 0}, BURST::geometry::Point2D{10, 0}, BURST::geometry::Point2D{10, 10}, BURST::geometry::Point2D{0, 10}
+    }));
+    shape.difference(*BURST::geometry::construct_circle(1, BURST::geometry::Point2D{5, 5}));
+
+    EXPECT_NEAR(BURST::geometry::area<double>(shape), 100 - CGAL_PI, 1e-12) << "Expected the hole to be subtracted";
+    EXPECT_NEAR(BURST::geometry::perimeter<double>(shape), 40 + 2 * CGAL_PI, 1e-12) << "Expected the hole boundary to be counted";
+}
+
+// -- CONFIGURATION SPACE TESTS ------------------------------------------------
+
+// Test the free area of the room: the inset square minus the pillar grown by the robot radius
+TEST_F(MeasureTest, ConfigurationSpaceArea) {
+    double expected_area = 18 * 18 - (4 * 4 + 4 * 4 + CGAL_PI);
+    EXPECT_NEAR(this->configuration_space->approximateArea(), expected_area, 1e-9) << "Expected the free area of the room";
+    EXPECT_NEAR(static_cast<double>(this->configuration_space->area()), expected_area, 1e-12) << "Expected the high-precision free area of the room";
+    EXPECT_NEAR(this->configuration_space->approximateMeasure().perimeter, this->configuration_space->perimeter(), 1e-9) << "Expected the measured perimeter to match the compact boundary";
+
+    // Cached results are returned by reference and stay the same
+    EXPECT_EQ(&this->configuration_space->measure(), &this->configuration_space->measure()) << "Expected the measure to be cached";
+}
+
+// Test that first requests for the cached measures and box from several threads agree
+TEST_F(MeasureTest, ConcurrentFirstRequests) {
+    auto fresh = this->wall_space->testConstructConfigurationSpace(1);
+    ASSERT_NE(fresh, nullptr) << "Failed to construct configuration space";
+    constexpr std::size_t THREADS = 8;
+    std::vector<double> exact_areas(THREADS), approximate_areas(THREADS), widths(THREADS);
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t i = 0; i < THREADS; ++i) workers.emplace_back([&, i]() {
+            exact_areas[i] = static_cast<double>(fresh->area());
+            approximate_areas[i] = fresh->approximateArea();
+            widths[i] = fresh->bbox().xmax() - fresh->bbox().xmin();
+        });
+    }
+    for (std::size_t i = 0; i < THREADS; ++i) {
+        EXPECT_EQ(exact_areas[i], exact_areas[0]);
+        EXPECT_EQ(approximate_areas[i], approximate_areas[0]);
+        EXPECT_EQ(widths[i], widths[0]);
+    }
+    EXPECT_NEAR(approximate_areas[0], 18 * 18 - (4 * 4 + 4 * 4 + CGAL_PI), 1e-9) << "Expected the free area of the room";
+    EXPECT_GE(widths[0], 18) << "Expected the box to cover the configuration space";
+}
+
+// Test that the area swept by a straight move is a stadium: two half disks and a rectangle
+TEST_F(MeasureTest, CoveredAreaOfMove) {
+    std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{5, 1}, 0);
+    ASSERT_TRUE(robot.has_value()) << "Failed to construct robot with valid parameters";
+    ASSERT_TRUE(this->wall_space->generateConfigurationSpace(*robot)) << "Failed to generate configuration space for robot";
+
+    auto covered = robot->coveredArea(CGAL_PI / 2);
+    ASSERT_TRUE(covered.has_value()) << "Expected a covered area for an upward move";
+    EXPECT_NEAR(BURST::geometry::area<double>(*covered), CGAL_PI + 2 * 18, 1e-9) << "Expected a stadium of length 18 and radius 1";
+    double fraction = BURST::geometry::area<double>(*covered) / robot->getConfigurationEnvironment().approximateArea();
+    EXPECT_GT(fraction, 0) << "Expected a positive coverage fraction";
+    EXPECT_LT(fraction, 1) << "Expected a coverage fraction below one";
+}
+
+// Test that an oblique sweep is a stadium across the chord, and that arc motion offers no stadium
+TEST_F(MeasureTest, ObliqueSweptArea) {
+    auto covered = BURST::Robot<>::sweptArea(1, BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{4, 5});
+    EXPECT_NEAR(BURST::geometry::area<double>(covered), CGAL_PI + 2 * 5, 1e-9) << "Expected a stadium of length 5 and radius 1";
+    auto still = BURST::Robot<>::sweptArea(1, BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{1, 1});
+    EXPECT_NEAR(BURST::geometry::area<double>(still), CGAL_PI, 1e-9) << "Expected a move of length zero to cover the disk";
+
+    static_assert(sweeps_area<BURST::Robot<>>, "Expected straight-moving robots to sweep stadiums");
+    static_assert(!sweeps_area<BURST::Robot<BURST::geometry::ArcTrajectory>>, "Expected arc-moving robots not to offer a straight stadium");
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <BURST/memory.hpp>
+#include <BURST/arena_arrangement.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/kernel.hpp>
+
+// Utility includes for tests
+#include <cstdint>
+#include <map>
+#include <vector>
+#include <thread>
+
+// -- ARENA TESTS --------------------------------------------------------------
+
+// Test that arena allocations honour the requested alignment
+TEST(ArenaTest, AllocationsAligned) {
+    BURST::memory::Arena arena{256};
+    for (std::size_t alignment : {1, 2, 8, 16, 64}) {
+        void* pointer = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % alignment, 0) << "Expected an allocation aligned to " << alignment << " bytes";
+        EXPECT_TRUE(arena.owns(pointer)) << "Expected the arena to own its own allocation";
+    }
+}
+
+// Test that requests larger than a block still succeed by growing the arena
+TEST(ArenaTest, GrowsForLargeRequests) {
+    BURST::memory::Arena arena{128};
+    void* small = arena.allocate(64);
+    void* large = arena.allocate(4096);
+
+    EXPECT_TRUE(arena.owns(small)) << "Expected the small allocation to come from the arena";
+    EXPECT_TRUE(arena.owns(large)) << "Expected the large allocation to come from a new arena block";
+    EXPECT_GE(arena.stats().bytes_reserved, 4096 + 64) << "Expected the arena to reserve enough memory for both allocations";
+}
+
+// Test that resetting rewinds the arena and reuses its memory
+TEST(ArenaTest, ResetReusesMemory) {
+    BURST::memory::Arena arena{1024};
+    void* first = arena.allocate(100);
+    arena.allocate(100);
+    EXPECT_GT(arena.used(), 0) << "Expected the arena to report used memory before reset";
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0) << "Expected no used memory after reset";
+    EXPECT_EQ(arena.allocate(100), first) << "Expected the first allocation after reset to reuse the start of the block";
+    EXPECT_EQ(arena.stats().resets, 1) << "Expected one recorded reset";
+}
+
+// Test that resetting keeps only the largest block
+TEST(ArenaTest, ResetKeepsLargestBlock) {
+    BURST::memory::Arena arena{128};
+    arena.allocate(100);
+    arena.allocate(1000);
+    arena.allocate(5000);
+    std::size_t reserved_before = arena.stats().bytes_reserved;
+
+    arena.reset();
+    std::size_t reserved_after = arena.stats().bytes_reserved;
+    EXPECT_LT(reserved_after, reserved_before) << "Expected the smaller blocks to be released";
+    void* pointer = arena.allocate(5000);
+    EXPECT_TRUE(arena.owns(pointer)) << "Expected the retained block to fit the largest earlier request";
+    EXPECT_EQ(arena.stats().bytes_reserved, reserved_after) << "Expected no new block for a request that fits the retained block";
+}
+
+// -- ALLOCATOR TESTS ----------------------------------------------------------
+
+// Test that the allocator uses the heap when no scope is open
+TEST(ArenaAllocatorTest, HeapOutsideScope) {
+    BURST::memory::reset_stats();
+    std::vector<int, BURST::memory::ArenaAllocator<int>> values(16, 1);
+
+    EXPECT_FALSE(BURST::memory::thread_arena().owns(values.data())) << "Expected a heap allocation without an open scope";
+    EXPECT_GE(BURST::memory::stats().heap_allocations, 1) << "Expected the heap fallback to be counted";
+}
+
+// Test that the allocator uses the thread arena inside a scope and the arena is rewound when it closes
+TEST(ArenaAllocatorTest, ArenaInsideScope) {
+    BURST::memory::reset_stats();
+    {
+        BURST::memory::ArenaScope scope;
+        std::vector<int, BURST::memory::ArenaAllocator<int>> values(16, 1);
+        EXPECT_TRUE(BURST::memory::scope_active()) << "Expected an open scope";
+        EXPECT_TRUE(BURST::memory::thread_arena().owns(values.data())) << "Expected an arena allocation inside a scope";
+    }
+    EXPECT_FALSE(BURST::memory::scope_active()) << "Expected no open scope after it closes";
+    EXPECT_EQ(BURST::memory::thread_arena().used(), 0) << "Expected the arena to be rewound when the scope closes";
+    EXPECT_GE(BURST::memory::stats().allocations, 1) << "Expected the arena allocation to be counted";
+}
+
+// Test that only the outermost scope rewinds the arena
+TEST(ArenaAllocatorTest, NestedScopes) {
+    BURST::memory::ArenaScope outer;
+    std::vector<int, BURST::memory::ArenaAllocator<int>> values(16, 7);
+    {
+        BURST::memory::ArenaScope inner;
+        std::vector<int, BURST::memory::ArenaAllocator<int>> scratch(16, 3);
+    }
+    EXPECT_GT(BURST::memory::thread_arena().used(), 0) << "Expected the arena to keep its contents until the outermost scope closes";
+    EXPECT_EQ(values.front(), 7) << "Expected outer allocations to survive an inner scope";
+}
+
+// Test that every thread gets its own arena
+TEST(ArenaAllocatorTest, ArenasArePerThread) {
+    BURST::memory::ArenaScope scope;
+    std::vector<int, BURST::memory::ArenaAllocator<int>> values(16, 1);
+
+    bool owned_by_other_thread = true;
+    std::thread worker([&values, &owned_by_other_thread]() {
+        owned_by_other_thread = BURST::memory::thread_arena().owns(values.data());
+    });
+    worker.join();
+    EXPECT_FALSE(owned_by_other_thread) << "Expected another thread's arena not to own this thread's allocation";
+}
+
+// -- ARRANGEMENT TESTS --------------------------------------------------------
+
+// Test that an arena-backed arrangement builds the same subdivision as the default one
+TEST(ArenaArrangementTest, SquareArrangement) {
+    BURST::memory::ArenaScope scope;
+    BURST::memory::ArenaArrangement<BURST::CurvedTraits> arrangement;
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{0, 0}, BURST::geometry::Point2D{1, 0}});
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{1, 0}, BURST::geometry::Point2D{1, 1}});
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{1, 1}, BURST::geometry::Point2D{0, 1}});
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{0, 1}, BURST::geometry::Point2D{0, 0}});
+
+    EXPECT_EQ(arrangement.number_of_vertices(), 4) << "Expected four vertices for a square";
+    EXPECT_EQ(arrangement.number_of_edges(), 4) << "Expected four edges for a square";
+    EXPECT_EQ(arrangement.number_of_faces(), 2) << "Expected an inner and an outer face for a square";
+    EXPECT_GT(BURST::memory::thread_arena().used(), 0) << "Expected the arrangement records to be allocated from the arena";
+}
+
+// -- FOOTPRINT TESTS ----------------------------------------------------------
+
+// Test that usages add up by kind and containers report their reserved storage
+TEST(MemoryUsageTest, ArithmeticAndContainers) {
+    BURST::memory::MemoryUsage a{10, 20, 30};
+    BURST::memory::MemoryUsage b{1, 2, 3};
+    EXPECT_EQ(a + b, (BURST::memory::MemoryUsage{11, 22, 33}));
+    EXPECT_EQ((a + b).total(), 66) << "Expected the total to sum every kind";
+
+    std::vector<double> values;
+    values.reserve(5);
+    EXPECT_EQ(BURST::memory::container_bytes(values), values.capacity() * sizeof(double)) << "Expected reserved but unused elements to count";
+    std::map<int, int> intervals{{1, 2}, {3, 4}};
+    EXPECT_GE(BURST::memory::container_bytes(intervals), 2 * sizeof(std::pair<const int, int>)) << "Expected at least the stored pairs";
+}
+
+// Test that an arrangement's footprint counts its records and exact points
+TEST(MemoryUsageTest, ArrangementUsage) {
+    CGAL::Arrangement_2<BURST::CurvedTraits> arrangement;
+    BURST::memory::MemoryUsage empty = BURST::memory::arrangement_usage(arrangement);
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{0, 0}, BURST::geometry::Point2D{1, 0}});
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{1, 0}, BURST::geometry::Point2D{0, 1}});
+    CGAL::insert(arrangement, BURST::geometry::Segment2D{BURST::geometry::Point2D{0, 1}, BURST::geometry::Point2D{0, 0}});
+
+    BURST::memory::MemoryUsage triangle = BURST::memory::arrangement_usage(arrangement);
+    EXPECT_GT(triangle.arrangement, empty.arrangement) << "Expected records for the triangle's vertices and edges";
+    EXPECT_EQ(triangle.exact, 3 * (BURST::memory::EXACT_POINT_BYTES + BURST::memory::EXACT_CURVE_BYTES)) << "Expected exact numbers for three vertices and three edges";
+    EXPECT_EQ(triangle.structure, 0) << "Expected an arrangement to be counted as arrangement storage only";
+}
@@ -780,3 +780,57 @@ TEST_F(MovementModelWithHolesTest, InvalidLinearTrajectoryFromHoleToInterior) {
     // i.e., it is nullopt
     EXPECT_FALSE(maybe_path.has_value()) << "Expected invalid path to not have a trajectory, but got a valid trajectory";
 }
+
+
+// -- MOVEMENTMODEL ARC FUNCTOR TESTS ------------------------------------------
+
+// Test that a counterclockwise arc from the bottom edge turns left onto the left edge
+TEST_F(MovementModelInSquareTest, ValidLeftArcMovementInSquare) {
+    // Radius 4 about (1, 1), so the quarter turn from (5, 1) ends at (1, 5)
+    auto movement_model = BURST::models::ArcMovementModel{BURST::numeric::fscalar{0.25}};
+    std::optional<BURST::geometry::Point2D> maybe_endpoint = movement_model(this->edge_midpoint, CGAL_PI/2, *this->configuration_space);
+
+    ASSERT_TRUE(maybe_endpoint.has_value()) << "Expected valid arc movement to have an endpoint, but got nullopt";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->x()), 1, 1e-9) << "Expected the arc to end on the left edge";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->y()), 5, 1e-9) << "Expected the arc to end a quarter turn from the origin";
+    EXPECT_TRUE(this->configuration_space->onEdge(*maybe_endpoint)) << "Expected the endpoint to lie exactly on the boundary";
+}
+
+// Test that a clockwise arc from the bottom edge turns right onto the right edge
+TEST_F(MovementModelInSquareTest, ValidRightArcMovementInSquare) {
+    auto movement_model = BURST::models::ArcMovementModel{BURST::numeric::fscalar{-0.25}};
+    std::optional<BURST::geometry::Point2D> maybe_endpoint = movement_model(this->edge_midpoint, CGAL_PI/2, *this->configuration_space);
+
+    ASSERT_TRUE(maybe_endpoint.has_value()) << "Expected valid arc movement to have an endpoint, but got nullopt";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->x()), 9, 1e-9) << "Expected the arc to end on the right edge";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->y()), 5, 1e-9) << "Expected the arc to end a quarter turn from the origin";
+}
+
+// Test that a tight arc returns to the edge it started from after half a turn
+TEST_F(MovementModelInSquareTest, ValidHalfTurnArcMovementInSquare) {
+    // Radius 1 about (4, 1), so the arc comes back down onto the bottom edge at (3, 1)
+    auto movement_model = BURST::models::ArcMovementModel{BURST::numeric::fscalar{1}};
+    std::optional<BURST::geometry::Point2D> maybe_endpoint = movement_model(this->edge_midpoint, CGAL_PI/2, *this->configuration_space);
+
+    ASSERT_TRUE(maybe_endpoint.has_value()) << "Expected valid arc movement to have an endpoint, but got nullopt";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->x()), 3, 1e-9) << "Expected the arc to land back on the bottom edge";
+    EXPECT_NEAR(CGAL::to_double(maybe_endpoint->y()), 1, 1e-9) << "Expected the arc to land back on the bottom edge";
+}
+
+// Test that zero curvature reproduces the linear movement model
+TEST_F(MovementModelInSquareTest, StraightArcMovementMatchesLinearInSquare) {
+    auto arc_model = BURST::models::ArcMovementModel{};
+    auto linear_model = BURST::models::LinearMovementModel{};
+    for (int step = 1; step < 8; ++step) {
+        double angle = CGAL_PI * step / 8;
+        EXPECT_EQ(arc_model(this->edge_midpoint, angle, *this->configuration_space), linear_model(this->edge_midpoint, angle, *this->configuration_space)) << "Expected matching endpoints at angle " << angle;
+    }
+}
+
+// Test that an arc leaving the configuration space is rejected even though its circle comes back to the boundary
+TEST_F(MovementModelInSquareTest, InvalidArcMovementPointingOutwardInSquare) {
+    auto movement_model = BURST::models::ArcMovementModel{BURST::numeric::fscalar{0.25}};
+    std::optional<BURST::geometry::Point2D> maybe_endpoint = movement_model(this->edge_midpoint, -CGAL_PI/2, *this->configuration_space);
+
+    EXPECT_FALSE(maybe_endpoint.has_value()) << "Expected invalid arc movement to not have an endpoint, but got a valid endpoint at (" << maybe_endpoint->x() << ", " << maybe_endpoint->y() << ")";
+}
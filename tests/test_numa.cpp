@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <BURST/numa.hpp>
+
+// Utility includes for tests
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -- CPU LIST TESTS -----------------------------------------------------------
+
+// Test parsing of sysfs CPU lists
+TEST(NumaTest, ParseCpuList) {
+    std::optional<std::vector<unsigned>> cpus = BURST::numa::parse_cpu_list("0-3,8,10-11\n");
+    ASSERT_TRUE(cpus.has_value());
+    EXPECT_EQ(*cpus, (std::vector<unsigned>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(BURST::numa::parse_cpu_list("5,1-2"), (std::vector<unsigned>{1, 2, 5}));
+    EXPECT_EQ(BURST::numa::parse_cpu_list(""), std::vector<unsigned>{}) << "Expected a memoryless node to have no CPUs";
+
+    EXPECT_FALSE(BURST::numa::parse_cpu_list("3-1").has_value());
+    EXPECT_FALSE(BURST::numa::parse_cpu_list("1,,2").has_value());
+    EXPECT_FALSE(BURST::numa::parse_cpu_list("x").has_value());
+}
+
+// -- TOPOLOGY TESTS -----------------------------------------------------------
+
+// Test that detection always yields at least one node with CPUs, and that explicit topologies drop empty nodes
+TEST(NumaTest, TopologyDetection) {
+    BURST::numa::Topology machine = BURST::numa::Topology::detect();
+    ASSERT_GE(machine.nodes(), 1u);
+    for (std::size_t node = 0; node < machine.nodes(); ++node) EXPECT_FALSE(machine.cpus(node).empty()) << "Expected node " << node << " to have usable CPUs";
+    EXPECT_EQ(machine.multiNode(), machine.nodes() > 1);
+
+    BURST::numa::Topology emulated = BURST::numa::Topology::fromNodes({{0}, {}, {0}});
+    EXPECT_EQ(emulated.nodes(), 2u);
+    EXPECT_TRUE(emulated.multiNode());
+    EXPECT_FALSE(BURST::numa::Topology::fromNodes({}).multiNode()) << "Expected no nodes to fall back to a single node";
+}
+
+// Test that nodes after a gap in the node IDs are found, with and without the online list
+TEST(NumaTest, SparseNodeIds) {
+#if defined(__linux__)
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "burst_numa_sparse";
+    std::filesystem::remove_all(root);
+    std::string cpu = std::to_string(BURST::numa::Topology::detect().cpus(0).front());
+    for (const char* node : {"node0", "node2", "node10"}) {
+        std::filesystem::create_directories(root / node);
+        std::ofstream{root / node / "cpulist"} << cpu << '\n';
+    }
+
+    EXPECT_EQ(BURST::numa::Topology::detect(root).nodes(), 3u) << "Expected every node<N> directory to be found without the online list";
+    std::ofstream{root / "online"} << "0,2\n";
+    EXPECT_EQ(BURST::numa::Topology::detect(root).nodes(), 2u) << "Expected only the online nodes to be listed";
+    std::filesystem::remove_all(root);
+#else
+    GTEST_SKIP() << "Node discovery reads sysfs on Linux only";
+#endif
+}
+
+// Test that a thread can be pinned to the CPUs of a node
+TEST(NumaTest, PinThread) {
+    BURST::numa::Topology machine = BURST::numa::Topology::detect();
+    bool pinned = false;
+    std::jthread{[&machine, &pinned] { pinned = BURST::numa::pin_current_thread(machine.cpus(0)); }}.join();
+#if defined(__linux__)
+    EXPECT_TRUE(pinned);
+#else
+    EXPECT_FALSE(pinned) << "Expected pinning to be unsupported off Linux";
+#endif
+    EXPECT_FALSE(BURST::numa::pin_current_thread({}));
+}
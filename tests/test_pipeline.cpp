@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <BURST/pipeline.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/coverage.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the 10 by 10 room fixture with a heading policy for the robot
+class PipelineTest : public RoomTest {
+protected:
+    // Heading policy aiming a fixed amount to the left of the room centre
+    static BURST::numeric::fscalar zigzag(const BURST::Robot<>& robot) {
+        double x = CGAL::to_double(robot.getPosition().x());
+        double y = CGAL::to_double(robot.getPosition().y());
+        return std::atan2(5 - y, 5 - x) + 0.4;
+    }
+};
+
+// -- QUEUE TESTS --------------------------------------------------------------
+
+// Test that the queue keeps order and refuses elements when full
+TEST(SpscQueueTest, BoundedFifo) {
+    BURST::SpscQueue<int> queue{3};
+    EXPECT_EQ(queue.capacity(), 3u);
+    for (int i = 0; i < 3; ++i) {
+        int value = i;
+        EXPECT_TRUE(queue.tryPush(value));
+    }
+    int overflow = 3;
+    EXPECT_FALSE(queue.tryPush(overflow));
+    EXPECT_EQ(overflow, 3) << "Expected a rejected element to be left untouched";
+
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_TRUE(queue.tryPush(overflow));
+    EXPECT_EQ(queue.tryPop(), 1);
+    EXPECT_EQ(queue.tryPop(), 2);
+    EXPECT_EQ(queue.tryPop(), 3);
+    EXPECT_EQ(queue.tryPop(), std::nullopt);
+
+    queue.close();
+    EXPECT_TRUE(queue.closed());
+    EXPECT_EQ(queue.pop(), std::nullopt);
+}
+
+// Test that every element crosses between threads in order, including those pushed just before closing
+TEST(SpscQueueTest, ThreadedTransfer) {
+    constexpr int COUNT = 100000;
+    BURST::SpscQueue<int> queue{16};
+    std::jthread producer{[&queue] {
+        for (int i = 0; i < COUNT; ++i) queue.push(i);
+        queue.close();
+    }};
+
+    int expected = 0;
+    while (std::optional<int> value = queue.pop()) {
+        ASSERT_EQ(*value, expected);
+        ++expected;
+    }
+    EXPECT_EQ(expected, COUNT);
+}
+
+// -- PIPELINE TESTS -----------------------------------------------------------
+
+// Test that the stages of a single-robot run see the same moves as a serial run
+TEST_F(PipelineTest, MatchesSerialRun) {
+    constexpr std::size_t STEPS = 20;
+    BURST::Robot<> serial = *this->robot;
+    std::vector<BURST::geometry::Point2D> expected{serial.getPosition()};
+    auto serial_coverage = BURST::geometry::AreaCoverage::create(serial.getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(serial_coverage.has_value());
+    for (std::size_t i = 0; i < STEPS; ++i) {
+        BURST::geometry::Point2D start = serial.getPosition();
+        BURST::StepResult result = serial.step(zigzag(serial));
+        ASSERT_EQ(result.status, BURST::StepStatus::Moved);
+        serial_coverage->add(BURST::Robot<>::sweptArea(serial.getRadius(), start, result.position));
+        expected.push_back(result.position);
+    }
+
+    auto coverage = BURST::geometry::AreaCoverage::create(this->robot->getConfigurationEnvironmentPtr());
+    ASSERT_TRUE(coverage.has_value());
+    std::vector<std::vector<BURST::geometry::Point2D>> trajectories;
+    BURST::MoveStatistics statistics;
+    BURST::Pipeline<> pipeline{4};
+    pipeline.addStage(BURST::Pipeline<>::coverage(*coverage))
+            .addStage(BURST::Pipeline<>::recorder(trajectories))
+            .addStage(BURST::Pipeline<>::statistics(statistics));
+    EXPECT_EQ(pipeline.stageCount(), 3u);
+
+    std::optional<std::size_t> moves = pipeline.run(std::span{&*this->robot, 1}, zigzag, STEPS);
+    ASSERT_TRUE(moves.has_value());
+    EXPECT_EQ(*moves, STEPS);
+    ASSERT_EQ(trajectories.size(), 1u);
+    EXPECT_EQ(trajectories[0], expected);
+    EXPECT_EQ(statistics.moves, STEPS);
+    EXPECT_EQ(statistics.failures, 0u);
+    EXPECT_GT(statistics.path_length, 0.0);
+    EXPECT_EQ(statistics.meanAbsoluteError(), 0.0) << "Expected no heading error without perturbation";
+    EXPECT_NEAR(coverage->coveredFraction(), serial_coverage->coveredFraction(), 1e-12);
+    EXPECT_EQ(this->robot->getPosition(), serial.getPosition());
+}
+
+// Test that each robot's trajectory does not depend on the number of motion threads
+TEST_F(PipelineTest, ParallelProducersKeepTrajectories) {
+    constexpr std::size_t STEPS = 10;
+    std::vector<BURST::geometry::Point2D> starts{
+        BURST::geometry::Point2D{1, 5},
+        BURST::geometry::Point2D{9, 5},
+        BURST::geometry::Point2D{5, 1},
+        BURST::geometry::Point2D{5, 9}
+    };
+    auto make_robots = [&] {
+        std::vector<BURST::Robot<>> robots;
+        for (const BURST::geometry::Point2D& start : starts) {
+            BURST::Robot<> copy = *this->robot;
+            copy.setPosition(start);
+            robots.push_back(copy);
+        }
+        return robots;
+    };
+
+    std::vector<BURST::Robot<>> serial_robots = make_robots();
+    std::vector<std::vector<BURST::geometry::Point2D>> serial_trajectories;
+    BURST::Pipeline<> serial_pipeline;
+    serial_pipeline.addStage(BURST::Pipeline<>::recorder(serial_trajectories));
+    ASSERT_EQ(serial_pipeline.run(std::span{serial_robots}, zigzag, STEPS), starts.size() * STEPS);
+
+    std::vector<BURST::Robot<>> parallel_robots = make_robots();
+    std::vector<std::vector<BURST::geometry::Point2D>> parallel_trajectories;
+    BURST::MoveStatistics statistics;
+    BURST::Pipeline<> parallel_pipeline{2};
+    parallel_pipeline.addStage(BURST::Pipeline<>::recorder(parallel_trajectories))
+                     .addStage(BURST::Pipeline<>::statistics(statistics));
+    ASSERT_EQ(parallel_pipeline.run(std::span{parallel_robots}, zigzag, STEPS, 2), starts.size() * STEPS);
+
+    EXPECT_EQ(parallel_trajectories, serial_trajectories);
+    EXPECT_EQ(statistics.moves, starts.size() * STEPS);
+    for (std::size_t i = 0; i < starts.size(); ++i) {
+        ASSERT_EQ(parallel_trajectories[i].size(), STEPS + 1);
+        EXPECT_EQ(parallel_trajectories[i].front(), starts[i]);
+        EXPECT_EQ(parallel_robots[i].getPosition(), serial_robots[i].getPosition());
+    }
+}
+
+// Test that a run without robots fails
+TEST_F(PipelineTest, EmptyRun) {
+    BURST::Pipeline<> pipeline;
+    std::vector<BURST::Robot<>> robots;
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(pipeline.run(std::span{robots}, zigzag, 5).has_value());
+    testing::internal::GetCapturedStderr();
+}
@@ -8,6 +8,8 @@
 #include <BURST/models.hpp>
 
 #include <optional>
+#include <source_location>
+#include <string>
 
 // -- TEST FIXTURE SETUP -------------------------------------------------------
 class RobotTest : public ::testing::Test {
@@ -96,6 +98,22 @@ TEST_F(RobotTest, InvalidConstructionWithModels) {
     ASSERT_FALSE(robot.has_value()) << "Successfully constructed robot with invalid parameters and explicit models";
 }
 
+// Test that a caller's source location can be passed positionally, with or without a start placement
+TEST_F(RobotTest, InvalidConstructionReportsCallerLocation) {
+    const std::source_location caller = std::source_location::current();
+    std::string expected = "[BURST] Line:\t" + std::to_string(caller.line());
+
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::Robot<>::create(-1.0, BURST::geometry::Point2D{1, 1}, 0.1, caller).has_value());
+    EXPECT_FALSE(BURST::Robot<>::create(-1.0, BURST::geometry::Point2D{1, 1}, 0.1, 42, caller).has_value());
+    EXPECT_FALSE(BURST::Robot<>::create(-1.0, BURST::geometry::Point2D{1, 1}, 0.1, BURST::StartPlacement::SnapToBoundary, caller).has_value());
+    std::string errors = testing::internal::GetCapturedStderr();
+
+    std::size_t reports = 0;
+    for (std::size_t at = errors.find(expected); at != std::string::npos; at = errors.find(expected, at + 1)) reports++;
+    EXPECT_EQ(reports, 3) << "Expected every error to point at the caller's line, but got: " << errors;
+}
+
 
 // -- ROBOT POSITION WARNING TESTS ---------------------------------------------
 
@@ -246,6 +264,32 @@ TEST_F(RobotTest, WarningOnPosition) {
 }
 
 
+// -- ROBOT START PLACEMENT TESTS ----------------------------------------------
+
+// Test that a robot created with SnapToBoundary is moved to the nearest wall instead of warning
+TEST_F(RobotTest, SnapStartToWall) {
+    testing::internal::CaptureStderr();
+
+    std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{1.5, 5}, 1, BURST::StartPlacement::SnapToBoundary);
+    ASSERT_TRUE(robot.has_value()) << "Failed to construct robot with valid parameters";
+    bool result = this->wall_space->generateConfigurationSpace(*robot);
+    ASSERT_TRUE(result) << "Failed to generate configuration space for robot";
+
+    std::string warning = testing::internal::GetCapturedStderr();
+    EXPECT_EQ(warning, "") << "Expected no warning when snapping the start point, but got: " << warning;
+    EXPECT_EQ(robot->getPosition(), (BURST::geometry::Point2D{1, 5})) << "Expected the start point to snap to the nearest point of the inset wall";
+}
+
+// Test that snapping can land on the rounded corner of an expanded hole
+TEST_F(RobotTest, SnapStartToHoleCorner) {
+    std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{2.5, 2.5}, 1, BURST::StartPlacement::SnapToBoundary);
+    ASSERT_TRUE(robot.has_value()) << "Failed to construct robot with valid parameters";
+    ASSERT_TRUE(this->wall_space->generateConfigurationSpace(*robot)) << "Failed to generate configuration space for robot";
+
+    EXPECT_TRUE(robot->getConfigurationEnvironment().onEdge(robot->getPosition())) << "Expected the snapped start point to lie on the boundary";
+    EXPECT_EQ(CGAL::squared_distance(robot->getPosition(), BURST::geometry::Point2D{4, 4}), 1) << "Expected the snapped start point on the arc around the hole corner";
+}
+
 // -- ROBOT RAYCAST TESTS ------------------------------------------------------
 
 // Test that a raycast from a robot on the boundary of the configuration space to another spot on the boundary of the configuration space is valid
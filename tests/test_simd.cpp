@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <BURST/simd.hpp>
+
+// Utility includes for tests
+#include <cmath>
+#include <random>
+#include <vector>
+
+// -- TEST HELPERS -------------------------------------------------------------
+
+// Build a leaf from segments given as {x0, y0, x1, y1}
+static BURST::simd::CurveLeaf segment_leaf(const std::vector<std::vector<double>>& segments) {
+    BURST::simd::CurveLeaf leaf;
+    leaf.count = static_cast<std::uint32_t>(segments.size());
+    for (std::size_t lane = 0; lane < segments.size(); ++lane) {
+        leaf.x0[lane] = segments[lane][0];
+        leaf.y0[lane] = segments[lane][1];
+        leaf.x1[lane] = segments[lane][2];
+        leaf.y1[lane] = segments[lane][3];
+    }
+    return leaf;
+}
+
+// Build a leaf from one circle given by its centre and radius
+static BURST::simd::CurveLeaf circle_leaf(double center_x, double center_y, double radius) {
+    BURST::simd::CurveLeaf leaf;
+    leaf.count = 1;
+    leaf.center_x[0] = center_x;
+    leaf.center_y[0] = center_y;
+    leaf.radius[0] = radius;
+    return leaf;
+}
+
+// Fill a leaf with random segments and circles
+static BURST::simd::CurveLeaf random_leaf(std::mt19937& generator) {
+    std::uniform_real_distribution<double> coordinate(-10, 10);
+    std::uniform_real_distribution<double> unit(0, 1);
+    BURST::simd::CurveLeaf leaf;
+    leaf.count = 1 + generator() % BURST::simd::LANES;
+    for (std::size_t lane = 0; lane < BURST::simd::LANES; ++lane) {
+        leaf.x0[lane] = coordinate(generator);
+        leaf.y0[lane] = coordinate(generator);
+        leaf.x1[lane] = coordinate(generator);
+        leaf.y1[lane] = coordinate(generator);
+        if (unit(generator) < 0.4) {
+            leaf.center_x[lane] = coordinate(generator);
+            leaf.center_y[lane] = coordinate(generator);
+            leaf.radius[lane] = 1 + 5 * unit(generator);
+        }
+    }
+    return leaf;
+}
+
+// -- SEGMENT LANE TESTS -------------------------------------------------------
+
+// Test that a crossing segment is reported with an interval containing the crossing
+TEST(SimdKernelTest, SegmentCrossing) {
+    BURST::simd::CurveLeaf leaf = segment_leaf({{2, -1, 2, 1}});
+    BURST::simd::LeafHits hits;
+    unsigned mask = BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(0, 0, 4, 0, 1), hits);
+
+    ASSERT_EQ(mask, 1u) << "Expected the crossing segment to be reported";
+    EXPECT_LE(hits.t_min[0], 0.5) << "Expected the interval to start before the crossing";
+    EXPECT_GE(hits.t_max[0], 0.5) << "Expected the interval to end after the crossing";
+    EXPECT_LT(hits.t_max[0] - hits.t_min[0], 1e-6) << "Expected a tight interval for a well-conditioned crossing";
+}
+
+// Test that segments beside or beyond the query are rejected
+TEST(SimdKernelTest, SegmentMiss) {
+    BURST::simd::CurveLeaf leaf = segment_leaf({{2, 1, 2, 3}, {5, -1, 5, 1}, {-1, -1, -1, 1}});
+    BURST::simd::LeafHits hits;
+    EXPECT_EQ(BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(0, 0, 4, 0, 1), hits), 0u) << "Expected no lane to be reported";
+}
+
+// Test that touching and collinear overlapping segments are kept for exact refinement
+TEST(SimdKernelTest, SegmentDegenerateContacts) {
+    BURST::simd::CurveLeaf leaf = segment_leaf({{2, 0, 2, 1}, {1, 0, 3, 0}, {4, 0, 4, 2}, {0, -1, 0, 1}});
+    BURST::simd::LeafHits hits;
+    unsigned mask = BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(0, 0, 4, 0, 1), hits);
+
+    EXPECT_EQ(mask, 0b1111u) << "Expected touching, overlapping, end and origin contacts to be reported";
+    EXPECT_EQ(hits.t_min[1], 0.0) << "Expected a collinear overlap to keep the whole interval";
+    EXPECT_EQ(hits.t_max[1], 1.0) << "Expected a collinear overlap to keep the whole interval";
+}
+
+// Test that padding lanes are never reported
+TEST(SimdKernelTest, PaddingLanesIgnored) {
+    BURST::simd::CurveLeaf leaf = segment_leaf({{2, -1, 2, 1}, {3, -1, 3, 1}, {1, -1, 1, 1}});
+    leaf.count = 1;
+    BURST::simd::LeafHits hits;
+    EXPECT_EQ(BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(0, 0, 4, 0, 1), hits), 1u) << "Expected only the first lane to be reported";
+}
+
+// -- ARC LANE TESTS -----------------------------------------------------------
+
+// Test that a segment crossing a circle is reported with an interval covering both crossings
+TEST(SimdKernelTest, CircleCrossing) {
+    BURST::simd::CurveLeaf leaf = circle_leaf(5, 0, 1);
+    BURST::simd::LeafHits hits;
+    unsigned mask = BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(0, 0, 10, 0, 1), hits);
+
+    ASSERT_EQ(mask, 1u) << "Expected the crossed circle to be reported";
+    EXPECT_LE(hits.t_min[0], 0.4) << "Expected the interval to contain the entry point";
+    EXPECT_GE(hits.t_max[0], 0.6) << "Expected the interval to contain the exit point";
+}
+
+// Test that segments strictly inside or outside a circle are rejected and tangents are kept
+TEST(SimdKernelTest, CircleContainmentAndTangency) {
+    BURST::simd::CurveLeaf leaf = circle_leaf(0, 0, 5);
+    BURST::simd::LeafHits hits;
+    EXPECT_EQ(BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(-1, 0, 1, 0, 5), hits), 0u) << "Expected a segment inside the circle to be rejected";
+    EXPECT_EQ(BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(-10, 6, 10, 6, 5), hits), 0u) << "Expected a segment outside the circle to be rejected";
+    EXPECT_EQ(BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(-10, 5, 10, 5, 5), hits), 1u) << "Expected a tangent segment to be reported";
+}
+
+// -- CONSISTENCY TESTS --------------------------------------------------------
+
+// Test that no true hit is ever filtered out and every hit lies in its reported interval
+TEST(SimdKernelTest, ConservativeAgainstExtendedPrecision) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> coordinate(-10, 10);
+    for (int trial = 0; trial < 20000; ++trial) {
+        BURST::simd::CurveLeaf leaf = random_leaf(generator);
+        double ax = coordinate(generator), ay = coordinate(generator), bx = coordinate(generator), by = coordinate(generator);
+        BURST::simd::LeafHits hits;
+        unsigned mask = BURST::simd::leaf_hits(leaf, BURST::simd::make_ray_segment(ax, ay, bx, by, 10), hits);
+
+        for (std::uint32_t lane = 0; lane < leaf.count; ++lane) {
+            long double ex = bx - ax, ey = by - ay;
+            std::vector<long double> crossings;
+            if (leaf.radius[lane] > 0) {
+                long double fx = ax - leaf.center_x[lane], fy = ay - leaf.center_y[lane];
+                long double a = ex * ex + ey * ey, b = 2 * (ex * fx + ey * fy);
+                long double c = fx * fx + fy * fy - static_cast<long double>(leaf.radius[lane]) * leaf.radius[lane];
+                long double discriminant = b * b - 4 * a * c;
+                if (discriminant >= 0) {
+                    crossings.push_back((-b - std::sqrt(discriminant)) / (2 * a));
+                    crossings.push_back((-b + std::sqrt(discriminant)) / (2 * a));
+                }
+            } else {
+                long double sx = leaf.x1[lane] - leaf.x0[lane], sy = leaf.y1[lane] - leaf.y0[lane];
+                long double denominator = ex * sy - ey * sx;
+                long double qx = leaf.x0[lane] - ax, qy = leaf.y0[lane] - ay;
+                if (denominator != 0) {
+                    long double s = (qx * ey - qy * ex) / denominator;
+                    if (s >= 0 && s <= 1) crossings.push_back((qx * sy - qy * sx) / denominator);
+                }
+            }
+            for (long double t : crossings) {
+                if (t < 0 || t > 1) continue;
+                ASSERT_TRUE(mask & (1u << lane)) << "Expected a true hit in lane " << lane << " of trial " << trial << " to be reported";
+                EXPECT_GE(t, hits.t_min[lane] - 1e-12) << "Expected the hit inside the interval in trial " << trial;
+                EXPECT_LE(t, hits.t_max[lane] + 1e-12) << "Expected the hit inside the interval in trial " << trial;
+            }
+        }
+    }
+}
+
+// Test that every compiled vector kernel agrees with the scalar reference
+TEST(SimdKernelTest, KernelsMatchScalar) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> coordinate(-10, 10);
+    for (int trial = 0; trial < 20000; ++trial) {
+        BURST::simd::CurveLeaf leaf = random_leaf(generator);
+        BURST::simd::RaySegment ray = BURST::simd::make_ray_segment(coordinate(generator), coordinate(generator), coordinate(generator), coordinate(generator), 10);
+        BURST::simd::LeafHits reference;
+        unsigned reference_mask = BURST::simd::leaf_hits_scalar(leaf, ray, reference);
+
+        auto check = [&](unsigned mask, const BURST::simd::LeafHits& hits, const char* kernel) {
+            ASSERT_EQ(mask, reference_mask) << "Expected the " << kernel << " kernel to report the same lanes in trial " << trial;
+            for (std::size_t lane = 0; lane < BURST::simd::LANES; ++lane) {
+                if (!(mask & (1u << lane))) continue;
+                EXPECT_NEAR(hits.t_min[lane], reference.t_min[lane], 1e-12) << "Expected matching intervals from the " << kernel << " kernel";
+                EXPECT_NEAR(hits.t_max[lane], reference.t_max[lane], 1e-12) << "Expected matching intervals from the " << kernel << " kernel";
+            }
+        };
+#ifdef __SSE2__
+        BURST::simd::LeafHits sse2;
+        check(BURST::simd::leaf_hits_sse2(leaf, ray, sse2), sse2, "sse2");
+#endif
+#ifdef __AVX2__
+        BURST::simd::LeafHits avx2;
+        check(BURST::simd::leaf_hits_avx2(leaf, ray, avx2), avx2, "avx2");
+#endif
+        BURST::simd::LeafHits dispatched;
+        check(BURST::simd::leaf_hits(leaf, ray, dispatched), dispatched, BURST::simd::active_kernel());
+    }
+}
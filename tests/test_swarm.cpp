@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <BURST/swarm.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+#include "test_helpers.hpp"
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Use the 10 by 10 room fixture with a shared model for robots of radius 1 in its configuration space
+class SwarmTest : public RoomTest {
+protected:
+    std::shared_ptr<BURST::geometry::ConfigurationSpace> configuration_space;
+    std::shared_ptr<const BURST::RobotModel<>> model;
+
+    void SetUp() override {
+        RoomTest::SetUp();
+        if (this->HasFatalFailure()) return;
+        this->configuration_space = this->robot->getConfigurationEnvironmentPtr();
+
+        std::optional<BURST::RobotModel<>> shared = BURST::RobotModel<>::create(1, 0.1, this->configuration_space);
+        ASSERT_TRUE(shared.has_value()) << "Failed to construct robot model in test fixture setup";
+        this->model = std::make_shared<const BURST::RobotModel<>>(std::move(*shared));
+    }
+
+    // Starts spread evenly along the boundary
+    std::vector<BURST::geometry::Point2D> starts(std::size_t count) const {
+        std::vector<BURST::geometry::Point2D> points;
+        for (std::size_t i = 0; i < count; ++i) points.push_back(*this->configuration_space->pointAtArcLength((i + 0.5) / count));
+        return points;
+    }
+
+    // Heading policy aiming a fixed amount to the left of the room centre
+    static BURST::numeric::fscalar zigzag(const BURST::geometry::Point2D& position) {
+        double x = CGAL::to_double(position.x());
+        double y = CGAL::to_double(position.y());
+        return std::atan2(5 - y, 5 - x) + 0.4;
+    }
+};
+
+// -- COUNTER ENGINE TESTS -----------------------------------------------------
+
+// Test that draws depend only on the stream and counter, so streams can be replayed and skipped
+TEST(CounterEngineTest, StreamsAreReplayable) {
+    BURST::numeric::CounterEngine engine{42};
+    std::vector<std::uint64_t> draws;
+    for (int i = 0; i < 8; ++i) draws.push_back(engine());
+    EXPECT_EQ(engine.counter(), 8u);
+    EXPECT_EQ(engine.stream(), 42u);
+
+    BURST::numeric::CounterEngine skipped{42, 5};
+    EXPECT_EQ(skipped(), draws[5]) << "Expected a jump to reproduce the draw at that counter";
+    EXPECT_EQ(BURST::numeric::CounterEngine::at(42, 3), draws[3]) << "Expected the stateless draw to match the engine";
+    EXPECT_NE(BURST::numeric::CounterEngine::at(43, 3), draws[3]) << "Expected another stream to give another draw";
+
+    // Uniform samples over [-1, 1] average close to zero
+    BURST::numeric::CounterEngine uniform{1};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+    double sum = 0;
+    for (int i = 0; i < 10000; ++i) sum += distribution(uniform);
+    EXPECT_NEAR(sum / 10000, 0, 0.05);
+}
+
+// -- SWARM TESTS --------------------------------------------------------------
+
+// Test that unperturbed swarm steps match stand-alone robots stepped the same way
+TEST_F(SwarmTest, MatchesRobotSteps) {
+    constexpr std::size_t STEPS = 10;
+    std::vector<BURST::geometry::Point2D> points = this->starts(4);
+    std::optional<BURST::Swarm<>> swarm = BURST::Swarm<>::create(this->model, points, 3, 1);
+    ASSERT_TRUE(swarm.has_value());
+    ASSERT_EQ(swarm->size(), points.size());
+
+    std::vector<BURST::Robot<>> robots;
+    for (std::size_t i = 0; i < swarm->size(); ++i) {
+        std::optional<BURST::Robot<>> robot = swarm->robot(i);
+        ASSERT_TRUE(robot.has_value());
+        EXPECT_EQ(robot->getPosition(), points[i]);
+        EXPECT_EQ(robot->getConfigurationEnvironmentPtr(), this->configuration_space) << "Expected the robot to share the configuration space";
+        robots.push_back(*robot);
+    }
+
+    for (std::size_t step = 0; step < STEPS; ++step) {
+        std::vector<BURST::StepResult> results = swarm->step([](const BURST::RobotState& state) { return zigzag(state.position); });
+        ASSERT_EQ(results.size(), robots.size());
+        for (std::size_t i = 0; i < robots.size(); ++i) {
+            BURST::StepResult expected = robots[i].step(zigzag(robots[i].getPosition()));
+            EXPECT_EQ(results[i].status, expected.status);
+            EXPECT_EQ(results[i].position, expected.position);
+            EXPECT_EQ(results[i].curve, expected.curve);
+        }
+    }
+    EXPECT_EQ(swarm->state(0).counter, 0u) << "Expected unperturbed steps not to draw noise";
+}
+
+// Test that perturbed batch steps do not depend on the thread count and can be replayed from a state
+TEST_F(SwarmTest, PerturbedStepsIndependentOfThreads) {
+    constexpr std::size_t ROBOTS = 40;
+    std::vector<BURST::geometry::Point2D> points = this->starts(ROBOTS);
+    std::optional<BURST::Swarm<>> serial = BURST::Swarm<>::create(this->model, points, 11, 1);
+    std::optional<BURST::Swarm<>> parallel = BURST::Swarm<>::create(this->model, points, 11, 4);
+    ASSERT_TRUE(serial.has_value() && parallel.has_value());
+
+    BURST::RobotState replay = serial->state(7);
+    std::vector<BURST::numeric::fscalar> angles;
+    for (const BURST::geometry::Point2D& point : points) angles.push_back(zigzag(point));
+    std::optional<std::vector<BURST::StepResult>> serial_results = serial->step(angles, true);
+    std::optional<std::vector<BURST::StepResult>> parallel_results = parallel->step(angles, true);
+    ASSERT_TRUE(serial_results.has_value() && parallel_results.has_value());
+    for (std::size_t i = 0; i < ROBOTS; ++i) {
+        EXPECT_EQ((*parallel_results)[i].position, (*serial_results)[i].position);
+        EXPECT_EQ((*parallel_results)[i].error, (*serial_results)[i].error);
+        EXPECT_LE(CGAL::abs((*serial_results)[i].error), BURST::numeric::fscalar{0.1}) << "Expected the error within the model's bound";
+    }
+    EXPECT_NE((*serial_results)[0].error, (*serial_results)[1].error) << "Expected robots to draw from different streams";
+    EXPECT_GT(serial->state(7).counter, replay.counter) << "Expected a perturbed step to advance the stream";
+
+    // A copied state replays the same perturbed step through the shared model
+    BURST::StepResult replayed = serial->model().step(replay, angles[7], true);
+    EXPECT_EQ(replayed.error, (*serial_results)[7].error);
+    EXPECT_EQ(replay.position, serial->state(7).position);
+}
+
+// Test that invalid swarms and mismatched headings are rejected
+TEST_F(SwarmTest, InvalidInput) {
+    std::vector<BURST::geometry::Point2D> points = this->starts(2);
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::Swarm<>::create(nullptr, points, 0).has_value()) << "Expected a missing model to be rejected";
+    EXPECT_FALSE(BURST::Swarm<>::create(this->model, std::vector<BURST::geometry::Point2D>{}, 0).has_value()) << "Expected an empty swarm to be rejected";
+    EXPECT_FALSE(BURST::Swarm<>::create(this->model, std::vector<BURST::geometry::Point2D>{BURST::geometry::Point2D{5, 5}}, 0).has_value()) << "Expected a start off the boundary to be rejected";
+    EXPECT_FALSE(BURST::RobotModel<>::create(0, 0.1, this->configuration_space).has_value()) << "Expected a non-positive radius to be rejected";
+    EXPECT_FALSE(BURST::RobotModel<>::create(1, 0.1, nullptr).has_value()) << "Expected a missing configuration space to be rejected";
+
+    std::optional<BURST::Swarm<>> swarm = BURST::Swarm<>::create(this->model, points, 0);
+    ASSERT_TRUE(swarm.has_value());
+    std::vector<BURST::numeric::fscalar> angles{0};
+    EXPECT_FALSE(swarm->step(angles).has_value()) << "Expected one heading per robot";
+    EXPECT_FALSE(swarm->robot(2).has_value()) << "Expected an out-of-range index to be rejected";
+    testing::internal::GetCapturedStderr();
+}
+
+// Test that a swarm takes far less memory per robot than stand-alone robots
+TEST_F(SwarmTest, CompactState) {
+    constexpr std::size_t ROBOTS = 16;
+    std::optional<BURST::Swarm<>> swarm = BURST::Swarm<>::create(this->model, this->starts(ROBOTS), 0);
+    ASSERT_TRUE(swarm.has_value());
+    std::optional<BURST::Robot<>> robot = swarm->robot(0);
+    ASSERT_TRUE(robot.has_value());
+
+    EXPECT_LT(sizeof(BURST::RobotState) * 50, sizeof(BURST::Robot<>)) << "Expected a state to be much smaller than a robot";
+    EXPECT_LT(swarm->memoryUsage().structure, ROBOTS * robot->memoryUsage().structure);
+    EXPECT_EQ(swarm->memoryUsage().exact, ROBOTS * BURST::memory::EXACT_POINT_BYTES) << "Expected one exact point per robot";
+    EXPECT_EQ(robot->memoryUsage().exact, BURST::memory::EXACT_POINT_BYTES + BURST::memory::EXACT_SCALAR_BYTES) << "Expected a robot to hold its own position and radius";
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <BURST/symmetry.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+// Utility includes for tests
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Create a test fixture with layouts of known symmetry built around a 10 by 10 square room
+class SymmetryTest : public ::testing::Test {
+protected:
+    // Rectangular room with an optional square pillar spanning [low, high] on both axes
+    static std::optional<BURST::geometry::WallSpace> room(double width, double height, std::optional<std::pair<double, double>> pillar = std::nullopt) {
+        std::vector<BURST::geometry::Point2D> outer{
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{width, 0},
+            BURST::geometry::Point2D{width, height},
+            BURST::geometry::Point2D{0, height}
+        };
+        if (!pillar) return BURST::geometry::WallSpace::create(outer);
+        auto [low, high] = *pillar;
+        return BURST::geometry::WallSpace::create(outer, {
+            *BURST::geometry::construct_polygon({
+                BURST::geometry::Point2D{low, low},
+                BURST::geometry::Point2D{high, low},
+                BURST::geometry::Point2D{high, high},
+                BURST::geometry::Point2D{low, high}
+            })
+        });
+    }
+};
+
+// -- SYMMETRY GROUP TESTS -----------------------------------------------------
+
+// Test the group orders of rooms with full, partial, and no symmetry
+TEST_F(SymmetryTest, GroupOrders) {
+    std::optional<BURST::geometry::WallSpace> square = room(10, 10);
+    ASSERT_TRUE(square.has_value());
+    BURST::geometry::SymmetryGroup square_group = BURST::geometry::SymmetryGroup::of(*square);
+    EXPECT_EQ(square_group.size(), 8u);
+    EXPECT_EQ(square_group.rotations(), 4u);
+    EXPECT_EQ(square_group.reflections(), 4u);
+
+    std::optional<BURST::geometry::WallSpace> rectangle = room(10, 6);
+    ASSERT_TRUE(rectangle.has_value());
+    BURST::geometry::SymmetryGroup rectangle_group = BURST::geometry::SymmetryGroup::of(*rectangle);
+    EXPECT_EQ(rectangle_group.rotations(), 2u);
+    EXPECT_EQ(rectangle_group.reflections(), 2u);
+
+    // A centred pillar keeps every symmetry of the square
+    std::optional<BURST::geometry::WallSpace> centred = room(10, 10, std::pair{4.0, 6.0});
+    ASSERT_TRUE(centred.has_value());
+    EXPECT_EQ(BURST::geometry::SymmetryGroup::of(*centred).size(), 8u);
+
+    // A pillar on the diagonal keeps only the mirror across that diagonal
+    std::optional<BURST::geometry::WallSpace> diagonal = room(10, 10, std::pair{2.0, 4.0});
+    ASSERT_TRUE(diagonal.has_value());
+    BURST::geometry::SymmetryGroup diagonal_group = BURST::geometry::SymmetryGroup::of(*diagonal);
+    EXPECT_EQ(diagonal_group.rotations(), 1u);
+    EXPECT_EQ(diagonal_group.reflections(), 1u);
+    EXPECT_EQ(diagonal_group[1](BURST::geometry::Point2D{3, 7}), BURST::geometry::Point2D(7, 3));
+
+    // An off-centre pillar in a rectangle breaks every symmetry
+    std::optional<BURST::geometry::WallSpace> asymmetric = BURST::geometry::WallSpace::create({
+        BURST::geometry::Point2D{0, 0},
+        BURST::geometry::Point2D{10, 0},
+        BURST::geometry::Point2D{10, 6},
+        BURST::geometry::Point2D{0, 6}
+    }, {
+        *BURST::geometry::construct_polygon({
+            BURST::geometry::Point2D{2, 2},
+            BURST::geometry::Point2D{3, 2},
+            BURST::geometry::Point2D{3, 3},
+            BURST::geometry::Point2D{2, 3}
+        })
+    });
+    ASSERT_TRUE(asymmetric.has_value());
+    EXPECT_TRUE(BURST::geometry::SymmetryGroup::of(*asymmetric).trivial());
+}
+
+// Test that every element maps the layout's vertices onto its vertices
+TEST_F(SymmetryTest, ElementsPreserveLayout) {
+    std::optional<BURST::geometry::WallSpace> walls = room(10, 10, std::pair{4.0, 6.0});
+    ASSERT_TRUE(walls.has_value());
+    BURST::geometry::SymmetryGroup group = BURST::geometry::SymmetryGroup::of(*walls);
+    std::vector<BURST::geometry::Point2D> vertices{walls->vertices_begin(), walls->vertices_end()};
+    for (const BURST::geometry::SymmetryGroup::Element& element : group) {
+        EXPECT_TRUE(BURST::geometry::is_rigid_motion(element.transformation));
+        for (const BURST::geometry::Point2D& vertex : vertices) {
+            EXPECT_NE(std::find(vertices.begin(), vertices.end(), element(vertex)), vertices.end());
+        }
+    }
+    EXPECT_FALSE(group[0].reflection);
+    EXPECT_EQ(group[0](BURST::geometry::Point2D{1, 2}), BURST::geometry::Point2D(1, 2));
+}
+
+// -- ORBIT TESTS --------------------------------------------------------------
+
+// Test that a quarter turn moves both the position and the heading
+TEST_F(SymmetryTest, HeadingsFollowRotations) {
+    std::optional<BURST::geometry::WallSpace> walls = room(10, 10);
+    ASSERT_TRUE(walls.has_value());
+    BURST::geometry::SymmetryGroup group = BURST::geometry::SymmetryGroup::of(*walls);
+    BURST::geometry::StartState state{BURST::geometry::Point2D{1, 5}, 0};
+
+    bool found = false;
+    for (const BURST::geometry::SymmetryGroup::Element& element : group) {
+        BURST::geometry::StartState image = element(state);
+        if (!element.reflection && image.position == BURST::geometry::Point2D(5, 1)) {
+            EXPECT_NEAR(CGAL::to_double(image.angle), CGAL_PI / 2, 1e-12);
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found) << "No rotation maps the left wall midpoint onto the bottom wall midpoint";
+}
+
+// Test that every state in an orbit shares one canonical representative
+TEST_F(SymmetryTest, CanonicalRepresentatives) {
+    std::optional<BURST::geometry::WallSpace> walls = room(10, 10);
+    ASSERT_TRUE(walls.has_value());
+    BURST::geometry::SymmetryGroup group = BURST::geometry::SymmetryGroup::of(*walls);
+
+    // Heading straight across from the middle of a wall is fixed by the mirror through that point
+    BURST::geometry::StartState centred{BURST::geometry::Point2D{1, 5}, 0};
+    std::vector<BURST::geometry::StartState> orbit = group.orbit(centred);
+    EXPECT_EQ(orbit.size(), 4u);
+    // A generic state has one image per element
+    BURST::geometry::StartState generic{BURST::geometry::Point2D{1, 2}, 0.3};
+    EXPECT_EQ(group.orbitSize(generic), group.size());
+
+    auto [representative, index] = group.canonical(centred);
+    BURST::geometry::StartState mapped = group[index](centred);
+    EXPECT_EQ(mapped.position, representative.position);
+    for (const BURST::geometry::StartState& state : orbit) {
+        auto [other, other_index] = group.canonical(state);
+        EXPECT_EQ(other.position, representative.position);
+        EXPECT_NEAR(std::remainder(CGAL::to_double(other.angle) - CGAL::to_double(representative.angle), 2 * CGAL_PI), 0.0, 1e-12);
+    }
+
+    // Points canonicalize to the smallest image
+    EXPECT_EQ(group.canonical(BURST::geometry::Point2D{9, 8}).first, BURST::geometry::Point2D(1, 2));
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <BURST/tracing.hpp>
+
+// Utility includes for tests
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Tracing state is process-wide, so every test starts from an empty, enabled registry
+class TracingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(BURST::tracing::compiled_in()) << "Tracing tests must be compiled with BURST_ENABLE_TRACING defined";
+        BURST::tracing::set_enabled(true);
+        BURST::tracing::set_buffer_capacity(BURST::tracing::DEFAULT_BUFFER_CAPACITY);
+        BURST::tracing::clear();
+    }
+
+    void TearDown() override {
+        BURST::tracing::set_enabled(true);
+        BURST::tracing::set_buffer_capacity(BURST::tracing::DEFAULT_BUFFER_CAPACITY);
+        BURST::tracing::clear();
+    }
+
+    static std::string exportTrace() {
+        std::ostringstream stream;
+        BURST::tracing::write_chrome_trace(stream);
+        return stream.str();
+    }
+};
+
+// -- SPAN RECORDING TESTS -----------------------------------------------------
+
+// Test that a single span is recorded once it goes out of scope
+TEST_F(TracingTest, SpanRecordedOnScopeExit) {
+    {
+        BURST::tracing::Span span{"TracingTest::single"};
+        EXPECT_EQ(BURST::tracing::event_count(), 0) << "Expected the span to be recorded only once it closes";
+    }
+    EXPECT_EQ(BURST::tracing::event_count(), 1) << "Expected exactly one recorded span";
+}
+
+// Test that nested spans are both recorded
+TEST_F(TracingTest, NestedSpansRecorded) {
+    {
+        BURST::tracing::Span outer{"TracingTest::outer"};
+        {
+            BURST::tracing::Span inner{"TracingTest::inner"};
+        }
+    }
+    EXPECT_EQ(BURST::tracing::event_count(), 2) << "Expected both nested spans to be recorded";
+}
+
+// Test that no spans are recorded while tracing is disabled at runtime
+TEST_F(TracingTest, DisabledTracingRecordsNothing) {
+    BURST::tracing::set_enabled(false);
+    {
+        BURST::tracing::Span span{"TracingTest::disabled"};
+    }
+    EXPECT_EQ(BURST::tracing::event_count(), 0) << "Expected no spans to be recorded while tracing is disabled";
+}
+
+// Test that spans from several threads are all recorded into their own buffers
+TEST_F(TracingTest, SpansRecordedAcrossThreads) {
+    constexpr int THREAD_COUNT = 4;
+    constexpr int SPANS_PER_THREAD = 10;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < SPANS_PER_THREAD; ++i) {
+                BURST::tracing::Span span{"TracingTest::worker"};
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    EXPECT_EQ(BURST::tracing::event_count(), THREAD_COUNT * SPANS_PER_THREAD) << "Expected every span from every thread to be recorded";
+}
+
+// Test that a full ring buffer overwrites its oldest events instead of growing
+TEST_F(TracingTest, RingBufferOverwritesOldest) {
+    // Capacity only applies to threads that record for the first time, so record on a fresh thread
+    BURST::tracing::set_buffer_capacity(4);
+    std::thread worker([]() {
+        for (int i = 0; i < 10; ++i) {
+            BURST::tracing::Span span{"TracingTest::overflow"};
+        }
+    });
+    worker.join();
+
+    EXPECT_EQ(BURST::tracing::event_count(), 4) << "Expected the ring buffer to retain only its capacity worth of events";
+}
+
+// Test that buffers of exited threads are kept until their events are cleared, then released
+TEST_F(TracingTest, ExitedThreadBuffersReleased) {
+    std::size_t live = BURST::tracing::buffer_count();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+        threads.emplace_back([]() {
+            BURST::tracing::Span span{"TracingTest::short_lived"};
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    EXPECT_EQ(BURST::tracing::buffer_count(), live + 3) << "Expected exited threads to keep their events until export";
+    EXPECT_NE(exportTrace().find("TracingTest::short_lived"), std::string::npos) << "Expected events of exited threads to be exported";
+    BURST::tracing::clear();
+    EXPECT_EQ(BURST::tracing::buffer_count(), live) << "Expected the buffers of exited threads to be released on clear";
+}
+
+// -- CHROME TRACE EXPORT TESTS ------------------------------------------------
+
+// Test that the export contains a complete event for each recorded span
+TEST_F(TracingTest, ExportContainsCompleteEvents) {
+    {
+        BURST::tracing::Span span{"TracingTest::exported"};
+    }
+    std::string trace = exportTrace();
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0) << "Expected the export to start with a traceEvents array, but got: " << trace;
+    EXPECT_NE(trace.find("\"name\":\"TracingTest::exported\""), std::string::npos) << "Expected the span name in the export, but got: " << trace;
+    EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos) << "Expected a complete event in the export, but got: " << trace;
+}
+
+// Test that named threads emit thread_name metadata
+TEST_F(TracingTest, ExportContainsThreadNames) {
+    std::thread worker([]() {
+        BURST::tracing::set_thread_name("tracing \"worker\"");
+        BURST::tracing::Span span{"TracingTest::named"};
+    });
+    worker.join();
+    std::string trace = exportTrace();
+
+    EXPECT_NE(trace.find("\"ph\":\"M\""), std::string::npos) << "Expected thread name metadata in the export, but got: " << trace;
+    EXPECT_NE(trace.find("tracing \\\"worker\\\""), std::string::npos) << "Expected the escaped thread name in the export, but got: " << trace;
+}
+
+// Test that clearing the registry empties the export
+TEST_F(TracingTest, ClearRemovesEvents) {
+    {
+        BURST::tracing::Span span{"TracingTest::cleared"};
+    }
+    BURST::tracing::clear();
+
+    EXPECT_EQ(BURST::tracing::event_count(), 0) << "Expected no events after clearing";
+    EXPECT_EQ(exportTrace().find("TracingTest::cleared"), std::string::npos) << "Expected cleared events to be absent from the export";
+}
@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include <BURST/wall_space.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+// Utility includes for tests
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Create a test fixture with a 10 by 6 room and an off-centre pillar, so the layout has no rigid symmetry
+class TransformTest : public ::testing::Test {
+protected:
+    std::optional<BURST::geometry::WallSpace> wall_space;
+    // Quarter turn followed by a translation
+    BURST::geometry::Transformation quarter_turn{0, -1, 20, 1, 0, 5};
+    // Rotation with rational sine and cosine (3-4-5 triangle) followed by a translation, which splits rotated arcs
+    BURST::geometry::Transformation pythagorean_turn{BURST::numeric::fscalar{4} / 5, BURST::numeric::fscalar{-3} / 5, -7, BURST::numeric::fscalar{3} / 5, BURST::numeric::fscalar{4} / 5, 2};
+
+    void SetUp() override {
+        this->wall_space = BURST::geometry::WallSpace::create({
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{10, 0},
+            BURST::geometry::Point2D{10, 6},
+            BURST::geometry::Point2D{0, 6}
+        }, {
+            *BURST::geometry::construct_polygon({
+                BURST::geometry::Point2D{2, 2},
+                BURST::geometry::Point2D{3, 2},
+                BURST::geometry::Point2D{3, 3},
+                BURST::geometry::Point2D{2, 3}
+            })
+        });
+        ASSERT_TRUE(this->wall_space.has_value()) << "Failed to construct wall space in test fixture setup";
+    }
+
+    // Configuration space of `walls` for a robot of radius 0.5, constructed directly
+    static std::shared_ptr<BURST::geometry::ConfigurationSpace> construct(const BURST::geometry::WallSpace& walls) {
+        std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(0.5, BURST::geometry::Point2D{0.5, 0.5}, 0);
+        if (!robot || !walls.generateConfigurationSpace(*robot)) return nullptr;
+        return robot->getConfigurationEnvironmentPtr();
+    }
+
+    // Vertices of a ring in order
+    static std::vector<BURST::geometry::Point2D> ring(const BURST::geometry::Polygon2D& polygon) {
+        return std::vector<BURST::geometry::Point2D>{polygon.vertices_begin(), polygon.vertices_end()};
+    }
+};
+
+// -- CONFIGURATION SPACE TRANSFORM TESTS --------------------------------------
+
+// Test that moving a configuration space matches constructing it for the moved layout
+TEST_F(TransformTest, TransformedMatchesConstruction) {
+    auto base = construct(*this->wall_space);
+    ASSERT_NE(base, nullptr) << "Failed to construct the configuration space";
+    std::mt19937_64 engine{7};
+    std::vector<BURST::geometry::Point2D> samples = base->sampleBoundary(32, engine);
+
+    for (const BURST::geometry::Transformation& transformation : {this->quarter_turn, this->pythagorean_turn}) {
+        auto moved = base->transformed(transformation);
+        ASSERT_NE(moved, nullptr) << "Expected a rigid motion to be accepted";
+        auto moved_walls = this->wall_space->transformed(transformation);
+        ASSERT_TRUE(moved_walls.has_value()) << "Expected a rigid motion of the walls to be accepted";
+        auto direct = construct(*moved_walls);
+        ASSERT_NE(direct, nullptr) << "Failed to construct the configuration space of the moved walls";
+
+        EXPECT_NEAR(moved->approximateArea(), direct->approximateArea(), 1e-5) << "Expected the moved area to match construction";
+        EXPECT_NEAR(moved->perimeter(), direct->perimeter(), 1e-5) << "Expected the moved perimeter to match construction";
+        EXPECT_NEAR(moved->approximateArea(), base->approximateArea(), 1e-9) << "Expected a rigid motion to preserve the area";
+        for (const BURST::geometry::Point2D& sample : samples) {
+            EXPECT_TRUE(moved->onEdge(transformation(sample))) << "Expected the image of (" << sample << ") to lie on the moved boundary";
+        }
+    }
+}
+
+// Test that scalings and reflections are rejected
+TEST_F(TransformTest, RejectsNonRigidTransformations) {
+    auto base = construct(*this->wall_space);
+    ASSERT_NE(base, nullptr) << "Failed to construct the configuration space";
+
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(base->transformed(BURST::geometry::Transformation{CGAL::SCALING, 2}), nullptr) << "Expected a scaling to be rejected";
+    EXPECT_EQ(base->transformed(BURST::geometry::Transformation{1, 0, 0, 0, -1, 0}), nullptr) << "Expected a reflection to be rejected";
+    EXPECT_FALSE(this->wall_space->transformed(BURST::geometry::Transformation{CGAL::SCALING, 2}).has_value()) << "Expected a scaling of the walls to be rejected";
+    std::string errors = testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(errors.empty()) << "Expected the rejected transformations to be reported";
+}
+
+// Test that a rotation built from floating-point sine and cosine is accepted and made exact
+TEST_F(TransformTest, AcceptsFloatingPointRotations) {
+    double angle = 0.3;
+    BURST::geometry::Transformation turn{std::cos(angle), -std::sin(angle), 1, std::sin(angle), std::cos(angle), -2};
+    EXPECT_TRUE(BURST::geometry::is_rigid_motion(turn)) << "Expected a rotation from std::cos and std::sin to be accepted";
+    EXPECT_FALSE(BURST::geometry::is_rigid_motion(BURST::geometry::Transformation{1.001, 0, 0, 0, 1.001, 0})) << "Expected a slight scaling to be rejected";
+
+    BURST::geometry::Transformation exact = BURST::geometry::normalize_rigid_motion(turn);
+    EXPECT_EQ(exact.m(0, 0) * exact.m(0, 0) + exact.m(1, 0) * exact.m(1, 0), 1) << "Expected the normalised rotation to be exact";
+    EXPECT_EQ(exact.m(0, 2), turn.m(0, 2)) << "Expected the translation to be kept";
+    EXPECT_EQ(BURST::geometry::normalize_rigid_motion(this->pythagorean_turn).m(0, 0), this->pythagorean_turn.m(0, 0)) << "Expected an exact rotation to be kept";
+
+    auto base = construct(*this->wall_space);
+    ASSERT_NE(base, nullptr) << "Failed to construct the configuration space";
+    auto moved = base->transformed(turn);
+    ASSERT_NE(moved, nullptr) << "Expected the rotation to move the configuration space";
+    EXPECT_NEAR(moved->approximateArea(), base->approximateArea(), 1e-9) << "Expected the rotation to preserve the area";
+    EXPECT_TRUE(this->wall_space->transformed(turn).has_value()) << "Expected the rotation to move the walls";
+}
+
+// Test that a transformed space reports the same arrangement footprint as the original
+TEST_F(TransformTest, TransformedKeepsMemoryUsage) {
+    auto original = construct(*this->wall_space);
+    ASSERT_NE(original, nullptr) << "Failed to construct the configuration space";
+    BURST::memory::MemoryUsage usage = original->memoryUsage();
+    EXPECT_GT(usage.structure, 0) << "Expected the boundary index to take memory";
+    EXPECT_GT(usage.arrangement, 0) << "Expected the shape to have arrangement records";
+    EXPECT_GT(usage.exact, 0) << "Expected the shape to hold exact numbers";
+
+    auto moved = original->transformed(this->quarter_turn);
+    ASSERT_NE(moved, nullptr) << "Expected a rigid motion to be accepted";
+    EXPECT_EQ(moved->memoryUsage().arrangement, usage.arrangement) << "Expected a quarter turn to keep every arrangement record";
+
+    // Four outer and four pillar vertices
+    EXPECT_EQ(this->wall_space->memoryUsage().exact, 8 * BURST::memory::EXACT_POINT_BYTES) << "Expected one exact point per wall vertex";
+}
+
+// -- CANONICAL POSE TESTS -----------------------------------------------------
+
+// Test that every rigid motion of a layout has the same canonical pose, and that the placement maps it back
+TEST_F(TransformTest, CanonicalPoseIsInvariant) {
+    BURST::geometry::WallSpace canonical = this->wall_space->canonical();
+    EXPECT_EQ(*canonical.vertices_begin(), (BURST::geometry::Point2D{0, 0})) << "Expected the canonical pose to start at the origin";
+
+    for (const BURST::geometry::Transformation& transformation : {this->quarter_turn, this->pythagorean_turn}) {
+        auto moved_walls = this->wall_space->transformed(transformation);
+        ASSERT_TRUE(moved_walls.has_value()) << "Expected a rigid motion of the walls to be accepted";
+        BURST::geometry::WallSpace moved_canonical = moved_walls->canonical();
+        EXPECT_EQ(std::vector<BURST::geometry::Point2D>(moved_canonical.vertices_begin(), moved_canonical.vertices_end()), std::vector<BURST::geometry::Point2D>(canonical.vertices_begin(), canonical.vertices_end())) << "Expected the same canonical outer boundary";
+        ASSERT_EQ(std::distance(moved_canonical.holes_begin(), moved_canonical.holes_end()), 1) << "Expected the pillar to be kept";
+        EXPECT_EQ(ring(*moved_canonical.holes_begin()), ring(*canonical.holes_begin())) << "Expected the same canonical pillar";
+
+        // The placement maps the canonical outline onto the moved outline
+        BURST::geometry::Transformation placement = moved_walls->canonicalPlacement();
+        std::vector<BURST::geometry::Point2D> outline(moved_walls->vertices_begin(), moved_walls->vertices_end());
+        for (auto vertex_it = canonical.vertices_begin(); vertex_it != canonical.vertices_end(); ++vertex_it) {
+            EXPECT_NE(std::find(outline.begin(), outline.end(), placement(*vertex_it)), outline.end()) << "Expected the placed vertex (" << placement(*vertex_it) << ") on the moved outline";
+        }
+    }
+}
+
+// -- CONSTRUCTION CACHE TESTS -------------------------------------------------
+
+// Test that the cache recognises moved copies of a layout and keys on the robot radius
+TEST_F(TransformTest, CacheReusesMovedLayouts) {
+    BURST::geometry::ConfigurationSpaceCache cache;
+    auto original = cache.get(*this->wall_space, 0.5);
+    ASSERT_NE(original, nullptr) << "Expected a configuration space for the original layout";
+    EXPECT_EQ(cache.misses(), 1) << "Expected the first lookup to construct";
+
+    auto moved_walls = this->wall_space->transformed(this->pythagorean_turn);
+    ASSERT_TRUE(moved_walls.has_value()) << "Expected a rigid motion of the walls to be accepted";
+    auto moved = cache.get(*moved_walls, 0.5);
+    ASSERT_NE(moved, nullptr) << "Expected a configuration space for the moved layout";
+    EXPECT_EQ(cache.hits(), 1) << "Expected the moved layout to be found in the cache";
+    EXPECT_EQ(cache.size(), 1) << "Expected one cached configuration space";
+
+    // Repeating a placement returns a copy of the space already moved there
+    auto again = cache.get(*moved_walls, 0.5);
+    ASSERT_NE(again, nullptr) << "Expected the repeated placement to be answered";
+    EXPECT_NE(again, moved) << "Expected an independent copy";
+    EXPECT_EQ(again->approximateArea(), moved->approximateArea()) << "Expected the same placed region";
+    EXPECT_EQ(cache.hits(), 2) << "Expected the repeated placement to hit the cache";
+
+    // Both results are placements of the same cached space, so their boundaries correspond exactly
+    std::mt19937_64 engine{11};
+    for (const BURST::geometry::Point2D& sample : original->sampleBoundary(16, engine)) {
+        EXPECT_TRUE(moved->onEdge(this->pythagorean_turn(sample))) << "Expected the image of (" << sample << ") to lie on the moved boundary";
+    }
+    auto direct = construct(*this->wall_space);
+    ASSERT_NE(direct, nullptr) << "Failed to construct the configuration space";
+    EXPECT_NEAR(original->approximateArea(), direct->approximateArea(), 1e-5) << "Expected the cached area to match construction";
+
+    // A different radius is a different entry
+    EXPECT_NE(cache.get(*moved_walls, 0.25), nullptr) << "Expected a configuration space for a smaller robot";
+    EXPECT_EQ(cache.size(), 2) << "Expected one entry per radius";
+    EXPECT_EQ(cache.misses(), 2) << "Expected the new radius to construct";
+
+    // Robots can be given cached configuration spaces directly
+    std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(0.5, BURST::geometry::Point2D{0.5, 0.5}, 0, BURST::StartPlacement::SnapToBoundary);
+    ASSERT_TRUE(robot.has_value()) << "Failed to construct robot";
+    EXPECT_TRUE(this->wall_space->generateConfigurationSpace(*robot, cache)) << "Expected a cached configuration space to be attached";
+    EXPECT_EQ(cache.hits(), 3) << "Expected the robot's lookup to hit the cache";
+}
+
+// Test that a memory budget evicts the least recently used configuration spaces
+TEST_F(TransformTest, CacheEvictsWithinBudget) {
+    BURST::geometry::ConfigurationSpaceCache cache;
+    ASSERT_NE(cache.get(*this->wall_space, 0.5), nullptr) << "Expected a configuration space for the large robot";
+    std::size_t entry_bytes = cache.memoryUsage().total();
+    EXPECT_GT(entry_bytes, 0) << "Expected a cached space to take memory";
+    ASSERT_NE(cache.get(*this->wall_space, 0.25), nullptr) << "Expected a configuration space for the small robot";
+    EXPECT_EQ(cache.size(), 2) << "Expected no eviction without a budget";
+
+    // Touch the large robot's entry so the small robot's becomes the least recently used
+    ASSERT_NE(cache.get(*this->wall_space, 0.5), nullptr) << "Expected the large robot's space to be cached";
+    cache.setMemoryBudget(cache.memoryUsage().total() - 1);
+    EXPECT_EQ(cache.size(), 1) << "Expected one entry to be evicted to fit the budget";
+    EXPECT_EQ(cache.evictions(), 1) << "Expected one eviction";
+    EXPECT_LE(cache.memoryUsage().total(), cache.memoryBudget()) << "Expected the cache to fit its budget";
+    std::size_t hits = cache.hits();
+    ASSERT_NE(cache.get(*this->wall_space, 0.5), nullptr) << "Expected the large robot's space to survive eviction";
+    EXPECT_EQ(cache.hits(), hits + 1) << "Expected the most recently used entry to be kept";
+
+    // A space larger than the whole budget is returned but not kept
+    cache.setMemoryBudget(1);
+    EXPECT_NE(cache.get(*this->wall_space, 0.25), nullptr) << "Expected a space even when it cannot be cached";
+    EXPECT_EQ(cache.size(), 0) << "Expected nothing to fit a one-byte budget";
+}
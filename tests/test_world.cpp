@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <BURST/world.hpp>
+#include <BURST/numa.hpp>
+#include <BURST/robot.hpp>
+#include <BURST/wall_space.hpp>
+#include <BURST/configuration_space.hpp>
+#include <BURST/geometry.hpp>
+#include <BURST/numeric.hpp>
+
+// Utility includes for tests
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// -- TEST FIXTURE SETUP -------------------------------------------------------
+
+// Create a test fixture with a 20 by 20 room, so robots of radius 1 move in the square [1, 19] x [1, 19]
+class WorldTest : public ::testing::Test {
+protected:
+    std::optional<BURST::geometry::WallSpace> wall_space;
+
+    void SetUp() override {
+        this->wall_space = BURST::geometry::WallSpace::create({
+            BURST::geometry::Point2D{0, 0},
+            BURST::geometry::Point2D{20, 0},
+            BURST::geometry::Point2D{20, 20},
+            BURST::geometry::Point2D{0, 20}
+        });
+        ASSERT_TRUE(this->wall_space.has_value()) << "Failed to construct wall space in test fixture setup";
+    }
+
+    // Robots of radius 1 at `starts` sharing one configuration space, each with its own rotation seed
+    std::vector<BURST::Robot<>> makeRobots(const std::vector<BURST::geometry::Point2D>& starts, double max_rotation_error = 0) {
+        std::vector<BURST::Robot<>> robots;
+        for (size_t i = 0; i < starts.size(); ++i) {
+            std::optional<BURST::Robot<>> robot = BURST::Robot<>::create(1.0, starts[i], max_rotation_error, static_cast<unsigned int>(i + 1));
+            EXPECT_TRUE(robot.has_value()) << "Failed to construct robot " << i;
+            if (robots.empty()) EXPECT_TRUE(this->wall_space->generateConfigurationSpace(*robot)) << "Failed to generate configuration space";
+            else robot->setConfigurationEnvironment(robots.front().getConfigurationEnvironmentPtr());
+            robots.push_back(*robot);
+        }
+        return robots;
+    }
+};
+
+// -- WORLD CONSTRUCTION TESTS -------------------------------------------------
+
+// Test that a world needs robots sharing a configuration space, and one heading per robot
+TEST_F(WorldTest, InvalidConstructionAndStep) {
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(BURST::World<>::create({}).has_value()) << "Expected a world without robots to be rejected";
+
+    std::optional<BURST::Robot<>> detached = BURST::Robot<>::create(1.0, BURST::geometry::Point2D{1, 5}, 0);
+    ASSERT_TRUE(detached.has_value()) << "Failed to construct robot";
+    EXPECT_FALSE(BURST::World<>::create({*detached}).has_value()) << "Expected a robot without a configuration space to be rejected";
+
+    auto world = BURST::World<>::create(this->makeRobots({BURST::geometry::Point2D{1, 5}, BURST::geometry::Point2D{1, 15}}));
+    ASSERT_TRUE(world.has_value()) << "Expected a world for robots sharing a configuration space";
+    std::vector<BURST::numeric::fscalar> angles{0};
+    EXPECT_FALSE(world->step(angles).has_value()) << "Expected a step with too few headings to be rejected";
+    std::string errors = testing::internal::GetCapturedStderr();
+    EXPECT_FALSE(errors.empty()) << "Expected the rejected inputs to be reported";
+}
+
+// Test that overlapping starts are accepted and reported in one warning
+TEST_F(WorldTest, OverlappingStartsReportedOnce) {
+    std::vector<BURST::Robot<>> robots = this->makeRobots({
+        BURST::geometry::Point2D{1, 5},
+        BURST::geometry::Point2D{1, 6},
+        BURST::geometry::Point2D{1, 7},
+        BURST::geometry::Point2D{1, 15}
+    });
+    testing::internal::CaptureStderr();
+    auto world = BURST::World<>::create(std::move(robots), 1);
+    std::string warnings = testing::internal::GetCapturedStderr();
+    ASSERT_TRUE(world.has_value()) << "Expected a world despite the overlapping starts";
+
+    std::size_t count = 0;
+    for (std::size_t at = warnings.find("Warning"); at != std::string::npos; at = warnings.find("Warning", at + 1)) ++count;
+    EXPECT_LE(count, 1u) << "Expected a single summary warning";
+    if (count == 1) EXPECT_NE(warnings.find("2 pair(s)"), std::string::npos) << "Expected the warning to count both overlapping pairs";
+}
+
+// -- WORLD STEP TESTS ---------------------------------------------------------
+
+// Test that a robot stops on contact with another, and that robots later in the step see earlier robots where they ended up
+TEST_F(WorldTest, StopOnContact) {
+    auto world = BURST::World<>::create(this->makeRobots({BURST::geometry::Point2D{1, 10}, BURST::geometry::Point2D{19, 10}}), 1);
+    ASSERT_TRUE(world.has_value()) << "Expected a world for robots sharing a configuration space";
+
+    // The first robot runs into the second before the second moves up out of the way
+    std::vector<BURST::numeric::fscalar> angles{0, CGAL_PI / 2};
+    auto outcomes = world->step(angles);
+    ASSERT_TRUE(outcomes.has_value()) << "Expected the step to succeed";
+    EXPECT_EQ((*outcomes)[0], BURST::MoveOutcome::Contact) << "Expected the first robot to stop on the second";
+    EXPECT_EQ((*outcomes)[1], BURST::MoveOutcome::Boundary) << "Expected the second robot to reach the wall";
+    EXPECT_NEAR(CGAL::to_double(world->robot(0).getPosition().x()), 17, 1e-6) << "Expected the first robot to stop one diameter short of the second";
+    EXPECT_FALSE(world->getConfigurationEnvironmentPtr()->onEdge(world->robot(0).getPosition())) << "Expected the first robot to rest inside the configuration space";
+    EXPECT_EQ(world->robot(1).getPosition(), (BURST::geometry::Point2D{19, 19})) << "Expected the second robot to reach the top wall";
+
+    // The first robot continues from the interior to the wall, then the second runs into it coming down
+    angles = {0, -CGAL_PI / 2};
+    outcomes = world->step(angles);
+    ASSERT_TRUE(outcomes.has_value()) << "Expected the step to succeed";
+    EXPECT_EQ((*outcomes)[0], BURST::MoveOutcome::Boundary) << "Expected the first robot to continue to the wall";
+    EXPECT_EQ(world->robot(0).getPosition(), (BURST::geometry::Point2D{19, 10})) << "Expected the first robot to reach the right wall";
+    EXPECT_EQ((*outcomes)[1], BURST::MoveOutcome::Contact) << "Expected the second robot to stop on the first";
+    EXPECT_NEAR(CGAL::to_double(world->robot(1).getPosition().y()), 12, 1e-6) << "Expected the second robot to stop one diameter above the first";
+}
+
+// Test that touching robots cannot move into each other but can move apart
+TEST_F(WorldTest, BlockedWhileTouching) {
+    auto world = BURST::World<>::create(this->makeRobots({BURST::geometry::Point2D{1, 5}, BURST::geometry::Point2D{1, 7}}), 1);
+    ASSERT_TRUE(world.has_value()) << "Expected a world for robots sharing a configuration space";
+
+    std::vector<BURST::numeric::fscalar> angles{CGAL_PI / 2, -CGAL_PI / 2};
+    auto outcomes = world->step(angles);
+    ASSERT_TRUE(outcomes.has_value()) << "Expected the step to succeed";
+    EXPECT_EQ((*outcomes)[0], BURST::MoveOutcome::Blocked) << "Expected the lower robot to be blocked";
+    EXPECT_EQ((*outcomes)[1], BURST::MoveOutcome::Blocked) << "Expected the upper robot to be blocked";
+    EXPECT_EQ(world->robot(0).getPosition(), (BURST::geometry::Point2D{1, 5})) << "Expected the lower robot not to move";
+    EXPECT_EQ(world->robot(1).getPosition(), (BURST::geometry::Point2D{1, 7})) << "Expected the upper robot not to move";
+
+    angles = {-CGAL_PI / 2, CGAL_PI / 2};
+    outcomes = world->step(angles);
+    ASSERT_TRUE(outcomes.has_value()) << "Expected the step to succeed";
+    EXPECT_EQ(world->robot(0).getPosition(), (BURST::geometry::Point2D{1, 1})) << "Expected the lower robot to move down to the corner";
+    EXPECT_EQ(world->robot(1).getPosition(), (BURST::geometry::Point2D{1, 19})) << "Expected the upper robot to move up to the corner";
+}
+
+// Test that perturbed steps give the same result on any number of threads and never leave robots overlapping
+TEST_F(WorldTest, DeterministicAcrossThreadCounts) {
+    std::vector<BURST::geometry::Point2D> starts;
+    for (double offset : {3.0, 7.0, 11.0, 15.0}) {
+        starts.emplace_back(offset, 1);
+        starts.emplace_back(offset + 1, 19);
+        starts.emplace_back(1, offset + 2);
+        starts.emplace_back(19, offset);
+    }
+    auto serial = BURST::World<>::create(this->makeRobots(starts, 0.3), 1);
+    auto parallel = BURST::World<>::create(this->makeRobots(starts, 0.3), 4);
+    ASSERT_TRUE(serial.has_value() && parallel.has_value()) << "Expected worlds for robots sharing a configuration space";
+    // A copy shares the workers of the world it was copied from
+    BURST::World<> copied = *parallel;
+
+    for (int step = 0; step < 6; ++step) {
+        // Aim every robot at the centre of the room
+        std::vector<BURST::numeric::fscalar> angles;
+        for (const BURST::Robot<>& robot : serial->robots()) {
+            angles.emplace_back(std::atan2(10 - CGAL::to_double(robot.getPosition().y()), 10 - CGAL::to_double(robot.getPosition().x())));
+        }
+        auto serial_outcomes = serial->step(angles, true);
+        auto parallel_outcomes = parallel->step(angles, true);
+        auto copied_outcomes = copied.step(angles, true);
+        ASSERT_TRUE(serial_outcomes.has_value() && parallel_outcomes.has_value() && copied_outcomes.has_value()) << "Expected step " << step << " to succeed";
+        EXPECT_EQ(*serial_outcomes, *parallel_outcomes) << "Expected the same outcomes at step " << step;
+        EXPECT_EQ(*serial_outcomes, *copied_outcomes) << "Expected the copy to step the same at step " << step;
+
+        for (size_t i = 0; i < serial->size(); ++i) {
+            EXPECT_EQ(serial->robot(i).getPosition(), parallel->robot(i).getPosition()) << "Expected robot " << i << " at the same position at step " << step;
+            for (size_t j = i + 1; j < serial->size(); ++j) {
+                double squared_distance = CGAL::to_double(CGAL::squared_distance(serial->robot(i).getPosition(), serial->robot(j).getPosition()));
+                EXPECT_GE(squared_distance, 4 - 1e-9) << "Expected robots " << i << " and " << j << " not to overlap at step " << step;
+            }
+        }
+    }
+}
+
+// -- NUMA REPLICA TESTS -------------------------------------------------------
+
+// Test that per-node replicas leave every step unchanged, and that a single node falls back to the shared space
+TEST_F(WorldTest, NodeReplicasMatchSharedSpace) {
+    std::vector<BURST::geometry::Point2D> starts;
+    for (double offset : {3.0, 7.0, 11.0, 15.0}) {
+        starts.emplace_back(offset, 1);
+        starts.emplace_back(offset + 1, 19);
+        starts.emplace_back(1, offset + 2);
+        starts.emplace_back(19, offset);
+    }
+    auto shared = BURST::World<>::create(this->makeRobots(starts, 0.3), 4);
+    auto replicated = BURST::World<>::create(this->makeRobots(starts, 0.3), 4);
+    ASSERT_TRUE(shared.has_value() && replicated.has_value()) << "Expected worlds for robots sharing a configuration space";
+
+    // Emulate two nodes with the CPUs of this machine's first node
+    BURST::numa::Topology machine = BURST::numa::Topology::detect();
+    std::vector<unsigned> cpus{machine.cpus(0).begin(), machine.cpus(0).end()};
+    EXPECT_EQ(shared->distributeAcrossNodes(BURST::numa::Topology::fromNodes({cpus})), 0u) << "Expected a single node to keep the shared space";
+    EXPECT_EQ(shared->replicas(), 0u);
+    ASSERT_EQ(replicated->distributeAcrossNodes(BURST::numa::Topology::fromNodes({cpus, cpus})), 2u);
+    EXPECT_EQ(replicated->replicas(), 2u);
+
+    for (int step = 0; step < 6; ++step) {
+        std::vector<BURST::numeric::fscalar> angles;
+        for (const BURST::Robot<>& robot : shared->robots()) {
+            angles.emplace_back(std::atan2(10 - CGAL::to_double(robot.getPosition().y()), 10 - CGAL::to_double(robot.getPosition().x())));
+        }
+        auto shared_outcomes = shared->step(angles, true);
+        auto replicated_outcomes = replicated->step(angles, true);
+        ASSERT_TRUE(shared_outcomes.has_value() && replicated_outcomes.has_value()) << "Expected step " << step << " to succeed";
+        EXPECT_EQ(*shared_outcomes, *replicated_outcomes) << "Expected the same outcomes at step " << step;
+        for (size_t i = 0; i < shared->size(); ++i) {
+            EXPECT_EQ(shared->robot(i).getPosition(), replicated->robot(i).getPosition()) << "Expected robot " << i << " at the same position at step " << step;
+        }
+    }
+}